@@ -0,0 +1,89 @@
+# @file compare_benchmarks.py
+#
+# @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+# Licensed under the MIT License. See LICENSE file in the project root for full license information.
+import json
+from argparse import ArgumentParser
+from statistics import median
+
+TIME_UNIT_NANOSECONDS = {'ns': 1.0, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+
+
+def load_timings(path: str) -> dict[str, float]:
+    """
+    Reads a Google Benchmark JSON report. Uses the median aggregate when the run was repeated, otherwise the median of
+    the individual iterations, and normalizes every time to nanoseconds.
+    """
+    with open(path, 'r', encoding='utf-8') as f:
+        report = json.load(f)
+
+    medians: dict[str, float] = {}
+    samples: dict[str, list[float]] = {}
+    for benchmark in report.get('benchmarks', []):
+        if benchmark.get('error_occurred', False):
+            continue
+
+        name = benchmark.get('run_name', benchmark['name'])
+        nanoseconds = benchmark['real_time'] * TIME_UNIT_NANOSECONDS[benchmark.get('time_unit', 'ns')]
+        if benchmark.get('run_type') == 'aggregate':
+            if benchmark.get('aggregate_name') == 'median':
+                medians[name] = nanoseconds
+        else:
+            samples.setdefault(name, []).append(nanoseconds)
+
+    for name, values in samples.items():
+        medians.setdefault(name, median(values))
+
+    return medians
+
+
+def format_nanoseconds(value: float) -> str:
+    for unit, scale in reversed(TIME_UNIT_NANOSECONDS.items()):
+        if value >= scale:
+            return f'{value / scale:.2f} {unit}'
+    return f'{value:.2f} ns'
+
+
+def main():
+    parser = ArgumentParser(description='Compare two retro_benchmarks JSON reports')
+    parser.add_argument('baseline', help='Report from the commit being compared against')
+    parser.add_argument('contender', help='Report from the commit being evaluated')
+    parser.add_argument('--threshold', type=float, default=5.0,
+                        help='Percentage change below which a difference is reported as noise')
+    parser.add_argument('--fail-on-regression', action='store_true', default=False,
+                        help='Exit with an error if any benchmark got slower by more than the threshold')
+    args = parser.parse_args()
+
+    baseline = load_timings(args.baseline)
+    contender = load_timings(args.contender)
+
+    names = sorted(baseline.keys() & contender.keys())
+    width = max((len(name) for name in names), default=0)
+    regressions = 0
+    for name in names:
+        before = baseline[name]
+        after = contender[name]
+        change = (after - before) / before * 100.0 if before > 0 else 0.0
+
+        if change > args.threshold:
+            verdict = 'slower'
+            regressions += 1
+        elif change < -args.threshold:
+            verdict = 'faster'
+        else:
+            verdict = ''
+
+        print(f'{name:<{width}}  {format_nanoseconds(before):>12}  {format_nanoseconds(after):>12}  '
+              f'{change:+7.1f}%  {verdict}')
+
+    for name in sorted(baseline.keys() - contender.keys()):
+        print(f'{name:<{width}}  only in baseline')
+    for name in sorted(contender.keys() - baseline.keys()):
+        print(f'{name:<{width}}  only in contender')
+
+    print(f'\n{len(names)} compared, {regressions} slower by more than {args.threshold}%')
+    exit(1 if args.fail_on_regression and regressions > 0 else 0)
+
+
+if __name__ == "__main__":
+    main()
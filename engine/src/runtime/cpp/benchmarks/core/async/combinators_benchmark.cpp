@@ -0,0 +1,75 @@
+/**
+ * @file combinators_benchmark.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <benchmark/benchmark.h>
+
+import std;
+import retro.core.async.combinators;
+import retro.core.async.task;
+import retro.core.async.task_actions;
+
+using namespace retro;
+
+namespace
+{
+    std::vector<Task<>> spawn_children(const std::int64_t count, std::atomic<std::int64_t> &counter)
+    {
+        std::vector<Task<>> tasks;
+        tasks.reserve(static_cast<std::size_t>(count));
+        for (std::int64_t i = 0; i < count; ++i)
+        {
+            tasks.push_back(run_async([&counter] { counter.fetch_add(1, std::memory_order_relaxed); }));
+        }
+        return tasks;
+    }
+
+    Task<> await_each(std::vector<Task<>> tasks)
+    {
+        for (auto &task : tasks)
+        {
+            co_await std::move(task);
+        }
+    }
+
+    // The hand-rolled pattern, every child is awaited in turn so the parent hops once per child
+    void fan_in_sequential_await(benchmark::State &state)
+    {
+        std::atomic<std::int64_t> counter{0};
+        for (auto _ : state)
+        {
+            await_each(spawn_children(state.range(0), counter)).wait();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void fan_in_when_all(benchmark::State &state)
+    {
+        std::atomic<std::int64_t> counter{0};
+        for (auto _ : state)
+        {
+            when_all(spawn_children(state.range(0), counter)).wait();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void fan_out_parallel_for(benchmark::State &state)
+    {
+        std::vector<std::int64_t> values(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            parallel_for(values, 1, [](std::int64_t &value) { ++value; }).wait();
+        }
+
+        benchmark::DoNotOptimize(values.data());
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+} // namespace
+
+BENCHMARK(fan_in_sequential_await)->RangeMultiplier(8)->Range(8, 4096)->UseRealTime();
+BENCHMARK(fan_in_when_all)->RangeMultiplier(8)->Range(8, 4096)->UseRealTime();
+BENCHMARK(fan_out_parallel_for)->RangeMultiplier(8)->Range(8, 4096)->UseRealTime();
@@ -0,0 +1,148 @@
+/**
+ * @file coroutine_frame_benchmark.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <benchmark/benchmark.h>
+
+import std;
+import retro.core.async.coroutine_frame_allocator;
+import retro.core.async.task;
+import retro.core.memory.arena_allocator;
+
+using namespace retro;
+
+namespace
+{
+    constexpr std::size_t frame_size = 384;
+
+    // Minimal owning coroutine whose frame comes from the global operator new, used as the baseline
+    class HeapCoroutine
+    {
+      public:
+        struct promise_type
+        {
+            int value = 0;
+
+            HeapCoroutine get_return_object() noexcept
+            {
+                return HeapCoroutine{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+
+            static std::suspend_never initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            static std::suspend_always final_suspend() noexcept
+            {
+                return {};
+            }
+
+            void return_value(const int result) noexcept
+            {
+                value = result;
+            }
+
+            [[noreturn]] static void unhandled_exception() noexcept
+            {
+                std::terminate();
+            }
+        };
+
+        HeapCoroutine(const HeapCoroutine &) = delete;
+        HeapCoroutine(HeapCoroutine &&) = delete;
+
+        ~HeapCoroutine()
+        {
+            handle_.destroy();
+        }
+
+        HeapCoroutine &operator=(const HeapCoroutine &) = delete;
+        HeapCoroutine &operator=(HeapCoroutine &&) = delete;
+
+        [[nodiscard]] int get() const noexcept
+        {
+            return handle_.promise().value;
+        }
+
+      private:
+        explicit HeapCoroutine(const std::coroutine_handle<promise_type> handle) noexcept : handle_{handle}
+        {
+        }
+
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    HeapCoroutine heap_value(const int value)
+    {
+        co_return value;
+    }
+
+    Task<int> pooled_value(const int value)
+    {
+        co_return value;
+    }
+
+    Task<int> arena_value(std::allocator_arg_t, SingleArena &, const int value)
+    {
+        co_return value;
+    }
+
+    void coroutine_frame_global_new(benchmark::State &state)
+    {
+        for (auto _ : state)
+        {
+            auto *frame = ::operator new(frame_size);
+            benchmark::DoNotOptimize(frame);
+            ::operator delete(frame, frame_size);
+        }
+    }
+
+    void coroutine_frame_pooled(benchmark::State &state)
+    {
+        for (auto _ : state)
+        {
+            auto *frame = CoroutineFrameAllocator::allocate(frame_size);
+            benchmark::DoNotOptimize(frame);
+            CoroutineFrameAllocator::deallocate(frame, frame_size);
+        }
+    }
+
+    void coroutine_heap_round_trip(benchmark::State &state)
+    {
+        int i = 0;
+        for (auto _ : state)
+        {
+            const HeapCoroutine coroutine = heap_value(++i);
+            benchmark::DoNotOptimize(coroutine.get());
+        }
+    }
+
+    void task_pooled_round_trip(benchmark::State &state)
+    {
+        int i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(pooled_value(++i).get());
+        }
+    }
+
+    void task_arena_round_trip(benchmark::State &state)
+    {
+        SingleArena arena{64 * 1024};
+        int i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(arena_value(std::allocator_arg, arena, ++i).get());
+            arena.reset();
+        }
+    }
+} // namespace
+
+BENCHMARK(coroutine_frame_global_new);
+BENCHMARK(coroutine_frame_pooled);
+BENCHMARK(coroutine_heap_round_trip);
+BENCHMARK(task_pooled_round_trip);
+BENCHMARK(task_arena_round_trip);
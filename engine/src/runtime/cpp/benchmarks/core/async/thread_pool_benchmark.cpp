@@ -0,0 +1,139 @@
+/**
+ * @file thread_pool_benchmark.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <benchmark/benchmark.h>
+
+import std;
+import retro.core.async.thread_pool;
+import retro.core.async.thread_pool_task_scheduler;
+import retro.core.async.task_scheduler;
+
+using namespace retro;
+
+namespace
+{
+    constexpr std::int64_t tasks_per_iteration = 10000;
+
+    // Every task is posted from the benchmark thread, so everything flows through the injection queue
+    void thread_pool_external_post(benchmark::State &state)
+    {
+        ThreadPool pool{static_cast<std::size_t>(state.range(0))};
+        for (auto _ : state)
+        {
+            std::latch done{tasks_per_iteration};
+            for (std::int64_t i = 0; i < tasks_per_iteration; ++i)
+            {
+                pool.post([&done] { done.count_down(); });
+            }
+            done.wait();
+        }
+
+        state.SetItemsProcessed(state.iterations() * tasks_per_iteration);
+    }
+
+    // A single root task fans out from inside the pool, so children land on worker deques and get stolen
+    void thread_pool_nested_fan_out(benchmark::State &state)
+    {
+        ThreadPool pool{static_cast<std::size_t>(state.range(0))};
+        for (auto _ : state)
+        {
+            std::latch done{tasks_per_iteration};
+            pool.post(
+                [&pool, &done]
+                {
+                    for (std::int64_t i = 0; i < tasks_per_iteration; ++i)
+                    {
+                        pool.post([&done] { done.count_down(); });
+                    }
+                });
+            done.wait();
+        }
+
+        state.SetItemsProcessed(state.iterations() * tasks_per_iteration);
+    }
+
+    struct ResumeOnScheduler
+    {
+        TaskScheduler &scheduler;
+
+        static bool await_ready() noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(const std::coroutine_handle<> handle) const
+        {
+            scheduler.enqueue(handle);
+        }
+
+        static void await_resume() noexcept
+        {
+        }
+    };
+
+    struct DetachedCoroutine
+    {
+        struct promise_type
+        {
+            static DetachedCoroutine get_return_object() noexcept
+            {
+                return {};
+            }
+
+            static std::suspend_never initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            static std::suspend_never final_suspend() noexcept
+            {
+                return {};
+            }
+
+            static void return_void() noexcept
+            {
+            }
+
+            [[noreturn]] static void unhandled_exception() noexcept
+            {
+                std::terminate();
+            }
+        };
+    };
+
+    DetachedCoroutine bounce(TaskScheduler &scheduler, const std::int64_t hops, std::latch &done)
+    {
+        for (std::int64_t i = 0; i < hops; ++i)
+        {
+            co_await ResumeOnScheduler{scheduler};
+        }
+        done.count_down();
+    }
+
+    // Coroutines repeatedly re-enqueue themselves, which is the load every resumed Task puts on the scheduler
+    void thread_pool_coroutine_resume(benchmark::State &state)
+    {
+        constexpr std::int64_t coroutine_count = 64;
+        constexpr std::int64_t hops = tasks_per_iteration / coroutine_count;
+
+        ThreadPoolTaskScheduler scheduler{static_cast<std::size_t>(state.range(0))};
+        for (auto _ : state)
+        {
+            std::latch done{coroutine_count};
+            for (std::int64_t i = 0; i < coroutine_count; ++i)
+            {
+                bounce(scheduler, hops, done);
+            }
+            done.wait();
+        }
+
+        state.SetItemsProcessed(state.iterations() * coroutine_count * hops);
+    }
+} // namespace
+
+BENCHMARK(thread_pool_external_post)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK(thread_pool_nested_fan_out)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK(thread_pool_coroutine_resume)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
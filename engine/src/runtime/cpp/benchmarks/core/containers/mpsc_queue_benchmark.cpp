@@ -0,0 +1,128 @@
+/**
+ * @file mpsc_queue_benchmark.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <benchmark/benchmark.h>
+
+import std;
+import retro.core.containers.mpsc_queue;
+
+using namespace retro;
+
+namespace
+{
+    constexpr std::int64_t items_per_producer = 20000;
+
+    // The hand-off the queue replaces, a mutex around a vector that the consumer swaps out
+    class LockedQueue
+    {
+      public:
+        void push(const std::int64_t value)
+        {
+            std::scoped_lock lock{mutex_};
+            pending_.push_back(value);
+        }
+
+        template <typename Consumer>
+        void drain(Consumer &&consumer)
+        {
+            {
+                std::scoped_lock lock{mutex_};
+                draining_.swap(pending_);
+            }
+
+            for (const auto value : draining_)
+            {
+                consumer(value);
+            }
+            draining_.clear();
+        }
+
+      private:
+        std::mutex mutex_;
+        std::vector<std::int64_t> pending_;
+        std::vector<std::int64_t> draining_;
+    };
+
+    template <typename Push, typename Drain>
+    void run_contention(benchmark::State &state, Push push, Drain drain)
+    {
+        const auto producer_count = state.range(0);
+        const auto total = producer_count * items_per_producer;
+        for (auto _ : state)
+        {
+            std::int64_t received = 0;
+            std::vector<std::jthread> producers;
+            for (std::int64_t p = 0; p < producer_count; ++p)
+            {
+                producers.emplace_back(
+                    [&push]
+                    {
+                        for (std::int64_t i = 0; i < items_per_producer; ++i)
+                        {
+                            push(i);
+                        }
+                    });
+            }
+
+            // The consumer plays the game thread, draining as fast as it can while producers hammer the queue
+            while (received < total)
+            {
+                drain(received);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * total);
+    }
+
+    void mpsc_locked_vector(benchmark::State &state)
+    {
+        LockedQueue queue;
+        run_contention(
+            state,
+            [&queue](const std::int64_t value) { queue.push(value); },
+            [&queue](std::int64_t &received) { queue.drain([&received](std::int64_t) { ++received; }); });
+    }
+
+    void mpsc_unbounded(benchmark::State &state)
+    {
+        MpscQueue<std::int64_t> queue;
+        run_contention(
+            state,
+            [&queue](const std::int64_t value) { queue.push(value); },
+            [&queue](std::int64_t &received)
+            {
+                while (queue.pop().has_value())
+                {
+                    ++received;
+                }
+            });
+    }
+
+    void mpsc_bounded(benchmark::State &state)
+    {
+        BoundedMpscQueue<std::int64_t, 4096> queue;
+        run_contention(
+            state,
+            [&queue](const std::int64_t value)
+            {
+                while (!queue.try_push(value))
+                {
+                    std::this_thread::yield();
+                }
+            },
+            [&queue](std::int64_t &received)
+            {
+                while (queue.pop().has_value())
+                {
+                    ++received;
+                }
+            });
+    }
+} // namespace
+
+BENCHMARK(mpsc_locked_vector)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(mpsc_unbounded)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(mpsc_bounded)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
@@ -0,0 +1,117 @@
+/**
+ * @file delegate_benchmark.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <benchmark/benchmark.h>
+
+import std;
+import retro.core.functional.delegate;
+
+using namespace retro;
+
+namespace
+{
+    template <typename Policy>
+    using BenchmarkDelegate = MulticastDelegate<void(std::int32_t), Policy>;
+
+    template <typename Policy>
+    void populate(BenchmarkDelegate<Policy> &delegate, const std::int64_t subscribers, std::atomic<std::int64_t> &sink)
+    {
+        for (std::int64_t i = 0; i < subscribers; ++i)
+        {
+            delegate.add([&sink](const std::int32_t value) { sink.fetch_add(value, std::memory_order_relaxed); });
+        }
+    }
+
+    template <typename Policy>
+    void multicast_broadcast(benchmark::State &state)
+    {
+        static BenchmarkDelegate<Policy> delegate;
+        static std::atomic<std::int64_t> sink{0};
+        if (state.thread_index() == 0)
+        {
+            delegate.clear();
+            populate(delegate, state.range(0), sink);
+        }
+
+        for (auto _ : state)
+        {
+            delegate.broadcast(1);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    /**
+     * Broadcasts from the benchmark threads while one more thread keeps subscribing and unsubscribing, which is where
+     * the lock-based policy stalls its readers.
+     */
+    template <typename Policy>
+    void multicast_broadcast_with_churn(benchmark::State &state)
+    {
+        BenchmarkDelegate<Policy> delegate;
+        std::atomic<std::int64_t> sink{0};
+        populate(delegate, state.range(0), sink);
+
+        const auto subscriber = [&sink](const std::int32_t value) { sink.fetch_add(value, std::memory_order_relaxed); };
+        std::jthread churn{[&delegate, &subscriber](const std::stop_token &stop_token)
+                           {
+                               while (!stop_token.stop_requested())
+                               {
+                                   delegate.remove(delegate.add(subscriber));
+                               }
+                           }};
+
+        for (auto _ : state)
+        {
+            delegate.broadcast(1);
+        }
+
+        churn.request_stop();
+        churn.join();
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void delegate_execute(benchmark::State &state)
+    {
+        std::int32_t offset = 3;
+        using BenchmarkFunction = Delegate<std::int32_t(std::int32_t)>;
+        const auto delegate = BenchmarkFunction::create([&offset](const std::int32_t value) { return value + offset; });
+
+        std::int32_t value = 0;
+        for (auto _ : state)
+        {
+            value = delegate.execute(value);
+            benchmark::DoNotOptimize(value);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Baseline for delegate_execute
+    void std_function_invoke(benchmark::State &state)
+    {
+        std::int32_t offset = 3;
+        const std::function<std::int32_t(std::int32_t)> function = [&offset](const std::int32_t value)
+        { return value + offset; };
+
+        std::int32_t value = 0;
+        for (auto _ : state)
+        {
+            value = function(value);
+            benchmark::DoNotOptimize(value);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+} // namespace
+
+BENCHMARK(delegate_execute);
+BENCHMARK(std_function_invoke);
+BENCHMARK(multicast_broadcast<NoLockPolicy>)->RangeMultiplier(4)->Range(1, 64);
+BENCHMARK(multicast_broadcast<SharedLockPolicy>)->RangeMultiplier(4)->Range(1, 64)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(multicast_broadcast<CopyOnWritePolicy>)->RangeMultiplier(4)->Range(1, 64)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(multicast_broadcast_with_churn<SharedLockPolicy>)->Arg(8)->UseRealTime();
+BENCHMARK(multicast_broadcast_with_churn<CopyOnWritePolicy>)->Arg(8)->UseRealTime();
@@ -0,0 +1,109 @@
+/**
+ * @file small_containers_benchmark.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <benchmark/benchmark.h>
+
+import std;
+import retro.core.containers.inline_list;
+import retro.core.memory.small_unique_ptr;
+
+using namespace retro;
+
+namespace
+{
+    struct Shape
+    {
+        virtual ~Shape() = default;
+
+        [[nodiscard]] virtual std::int32_t area() const = 0;
+    };
+
+    template <std::size_t Padding>
+    struct Rectangle final : Shape
+    {
+        explicit Rectangle(const std::int32_t side) : side_{side}
+        {
+        }
+
+        [[nodiscard]] std::int32_t area() const override
+        {
+            return side_ * side_;
+        }
+
+      private:
+        std::array<std::byte, Padding> padding_{};
+        std::int32_t side_;
+    };
+
+    // Fits into the inline buffer of the default SmallUniquePtr, the large one always falls back to the heap
+    using SmallRectangle = Rectangle<16>;
+    using LargeRectangle = Rectangle<256>;
+
+    template <typename T>
+    void small_unique_ptr_round_trip(benchmark::State &state)
+    {
+        std::int32_t side = 0;
+        for (auto _ : state)
+        {
+            const auto shape = make_unique_small<T, Shape>(++side);
+            benchmark::DoNotOptimize(shape->area());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Baseline for small_unique_ptr_round_trip
+    template <typename T>
+    void std_unique_ptr_round_trip(benchmark::State &state)
+    {
+        std::int32_t side = 0;
+        for (auto _ : state)
+        {
+            const std::unique_ptr<Shape> shape = std::make_unique<T>(++side);
+            benchmark::DoNotOptimize(shape->area());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    constexpr std::size_t list_capacity = 16;
+
+    template <typename List>
+    void fill_and_sum(benchmark::State &state)
+    {
+        const auto count = static_cast<std::int32_t>(state.range(0));
+        for (auto _ : state)
+        {
+            List list;
+            for (std::int32_t i = 0; i < count; ++i)
+            {
+                list.emplace_back(i);
+            }
+
+            benchmark::DoNotOptimize(std::ranges::fold_left(list, 0, std::plus{}));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void inline_list_fill(benchmark::State &state)
+    {
+        fill_and_sum<InlineList<std::int32_t, list_capacity>>(state);
+    }
+
+    // Baseline for inline_list_fill
+    void std_vector_fill(benchmark::State &state)
+    {
+        fill_and_sum<std::vector<std::int32_t>>(state);
+    }
+} // namespace
+
+BENCHMARK(small_unique_ptr_round_trip<SmallRectangle>);
+BENCHMARK(small_unique_ptr_round_trip<LargeRectangle>);
+BENCHMARK(std_unique_ptr_round_trip<SmallRectangle>);
+BENCHMARK(std_unique_ptr_round_trip<LargeRectangle>);
+BENCHMARK(inline_list_fill)->Arg(4)->Arg(list_capacity);
+BENCHMARK(std_vector_fill)->Arg(4)->Arg(list_capacity);
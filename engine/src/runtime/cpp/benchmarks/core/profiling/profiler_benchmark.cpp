@@ -0,0 +1,50 @@
+/**
+ * @file profiler_benchmark.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <benchmark/benchmark.h>
+
+import std;
+import retro.core.profiling;
+
+using namespace retro;
+
+namespace
+{
+    /**
+     * The cost instrumented code pays while no capture is running, which is the state shipped builds spend their time
+     * in.
+     */
+    void profile_zone_idle(benchmark::State &state)
+    {
+        for (auto _ : state)
+        {
+            const ProfileZone zone{"Idle"};
+            benchmark::ClobberMemory();
+        }
+    }
+
+    void profile_zone_capturing(benchmark::State &state)
+    {
+        if (state.thread_index() == 0)
+        {
+            begin_profile_capture();
+        }
+
+        for (auto _ : state)
+        {
+            const ProfileZone zone{"Capturing"};
+            benchmark::ClobberMemory();
+        }
+
+        if (state.thread_index() == 0)
+        {
+            static_cast<void>(end_profile_capture());
+        }
+    }
+} // namespace
+
+BENCHMARK(profile_zone_idle);
+BENCHMARK(profile_zone_capturing)->ThreadRange(1, 8)->UseRealTime();
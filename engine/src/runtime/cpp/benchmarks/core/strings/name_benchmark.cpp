@@ -0,0 +1,135 @@
+/**
+ * @file name_benchmark.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <benchmark/benchmark.h>
+
+import std;
+import retro.core.strings.name;
+
+using namespace retro;
+
+namespace
+{
+    constexpr std::size_t existing_name_count = 4096;
+
+    // Shared by every thread, so the lookups land on the same entries the way asset loading does
+    const std::vector<std::string> &existing_names()
+    {
+        static const auto names = []
+        {
+            std::vector<std::string> result;
+            result.reserve(existing_name_count);
+            for (std::size_t i = 0; i < existing_name_count; ++i)
+            {
+                result.push_back(std::format("Asset/Texture_{}", i * 7919));
+                std::ignore = Name{result.back()};
+            }
+            return result;
+        }();
+        return names;
+    }
+
+    std::atomic<std::uint64_t> next_unique_name{0};
+
+    void name_create_new(benchmark::State &state)
+    {
+        std::array<char, 64> buffer{};
+        constexpr std::string_view prefix = "Generated/Node";
+        std::ranges::copy(prefix, buffer.begin());
+
+        for (auto _ : state)
+        {
+            const auto id = next_unique_name.fetch_add(1, std::memory_order_relaxed);
+            const auto [end, error] = std::to_chars(buffer.data() + prefix.size(), buffer.data() + buffer.size(), id);
+            benchmark::DoNotOptimize(Name{std::string_view{buffer.data(), end}});
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void name_lookup_existing(benchmark::State &state)
+    {
+        const auto &names = existing_names();
+        auto index = static_cast<std::size_t>(state.thread_index()) * 613;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Name{names[index % names.size()]});
+            ++index;
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void name_lookup_repeated(benchmark::State &state)
+    {
+        const auto &names = existing_names();
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Name{names[state.thread_index() % 16]});
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void name_intern_batch(benchmark::State &state)
+    {
+        const auto &names = existing_names();
+        const std::vector<std::string_view> batch{names.begin(), names.end()};
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Name::intern(batch));
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(batch.size()));
+    }
+
+    void name_to_string(benchmark::State &state)
+    {
+        const auto &names = existing_names();
+        const Name name{names[static_cast<std::size_t>(state.thread_index())]};
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(name.to_string());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void name_compare(benchmark::State &state)
+    {
+        const auto &names = existing_names();
+        const Name lhs{names[0]};
+        const Name rhs{names[1]};
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(lhs == rhs);
+            benchmark::DoNotOptimize(lhs < rhs);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void name_compare_to_string(benchmark::State &state)
+    {
+        const auto &names = existing_names();
+        const Name name{names[0]};
+        const std::string_view other = names[0];
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(name == other);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+} // namespace
+
+BENCHMARK(name_create_new)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(name_lookup_existing)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(name_lookup_repeated)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(name_intern_batch)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(name_to_string)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(name_compare);
+BENCHMARK(name_compare_to_string);
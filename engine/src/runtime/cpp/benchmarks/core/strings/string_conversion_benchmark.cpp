@@ -0,0 +1,68 @@
+/**
+ * @file string_conversion_benchmark.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <benchmark/benchmark.h>
+
+import std;
+import retro.core.strings.encoding;
+
+using namespace retro;
+
+namespace
+{
+    /**
+     * Mostly ASCII with some multibyte characters mixed in, which is what UI text and asset paths coming over from
+     * the managed side usually look like.
+     */
+    std::u16string make_text(const std::size_t length)
+    {
+        constexpr std::u16string_view pattern = u"Retro Engine: café 日本語 / Sprite_042. ";
+        std::u16string text;
+        text.reserve(length);
+        while (text.size() < length)
+        {
+            text.append(pattern.substr(0, std::min(pattern.size(), length - text.size())));
+        }
+        return text;
+    }
+
+    void convert_utf16_to_utf8(benchmark::State &state)
+    {
+        const auto source = make_text(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(convert_string<char>(std::u16string_view{source}));
+        }
+
+        state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(char16_t)));
+    }
+
+    void convert_utf8_to_utf16(benchmark::State &state)
+    {
+        const auto source = convert_string<char>(make_text(static_cast<std::size_t>(state.range(0))));
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(convert_string<char16_t>(std::string_view{source}));
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(source.size()));
+    }
+
+    void convert_utf8_to_utf32(benchmark::State &state)
+    {
+        const auto source = convert_string<char>(make_text(static_cast<std::size_t>(state.range(0))));
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(convert_string<char32_t>(std::string_view{source}));
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(source.size()));
+    }
+} // namespace
+
+BENCHMARK(convert_utf16_to_utf8)->Arg(32)->Arg(4096);
+BENCHMARK(convert_utf8_to_utf16)->Arg(32)->Arg(4096);
+BENCHMARK(convert_utf8_to_utf32)->Arg(32)->Arg(4096);
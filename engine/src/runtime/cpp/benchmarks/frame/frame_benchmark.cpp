@@ -0,0 +1,413 @@
+/**
+ * @file frame_benchmark.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+import std;
+import retro.core.math.transform;
+import retro.core.math.vector;
+import retro.core.memory.frame_allocator;
+import retro.core.memory.memory_tracking;
+import retro.core.memory.ref_counted_ptr;
+import retro.platform.backend;
+import retro.platform.window;
+import retro.runtime.event_manager;
+import retro.runtime.rendering.headless_render_backend;
+import retro.runtime.rendering.objects.geometry;
+import retro.runtime.rendering.objects.sprite;
+import retro.runtime.rendering.objects.text_block;
+import retro.runtime.rendering.pipeline_manager;
+import retro.runtime.rendering.pipeline_manager.render_manager;
+import retro.runtime.rendering.recording_renderer2d;
+import retro.runtime.rendering.render_pipeline;
+import retro.runtime.rendering.text.font;
+import retro.runtime.rendering.texture;
+import retro.runtime.world.scene;
+import retro.runtime.world.viewport;
+
+using namespace retro;
+
+namespace
+{
+    // Only allocations made through the executable's allocator are seen, which with shared libraries on Windows
+    // leaves out the engine's own. The tagged allocation count from the memory tracker covers every platform.
+    std::atomic<std::uint64_t> heap_allocations{0};
+} // namespace
+
+void *operator new(const std::size_t size)
+{
+    heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto *ptr = std::malloc(size == 0 ? 1 : size); ptr != nullptr)
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+    struct HarnessConfig
+    {
+        std::size_t sprites = 10000;
+        std::size_t text_blocks = 100;
+        std::size_t geometry = 1000;
+        std::size_t viewports = 2;
+        std::size_t textures = 16;
+        std::size_t frames = 600;
+        std::size_t warmup_frames = 60;
+        std::filesystem::path font = RETRO_FRAME_BENCHMARK_DEFAULT_FONT;
+        std::optional<std::filesystem::path> json_output;
+    };
+
+    struct FrameSample
+    {
+        double sync_ms;
+        double render_ms;
+        std::uint64_t heap_allocations;
+        std::uint64_t tagged_allocations;
+        RecordedFrameStats draw_stats;
+
+        [[nodiscard]] double total_ms() const noexcept
+        {
+            return sync_ms + render_ms;
+        }
+    };
+
+    struct Percentiles
+    {
+        double p50;
+        double p90;
+        double p99;
+        double max;
+    };
+
+    void print_usage()
+    {
+        std::println("Usage: retro_frame_benchmark [--sprites=N] [--text-blocks=N] [--geometry=N] [--viewports=N]");
+        std::println("                             [--textures=N] [--frames=N] [--warmup=N] [--font=PATH]");
+        std::println("                             [--json=PATH]");
+    }
+
+    std::optional<HarnessConfig> parse_args(const std::span<char *const> args)
+    {
+        HarnessConfig config;
+        for (const std::string_view arg : args | std::views::drop(1))
+        {
+            const auto separator = arg.find('=');
+            const auto key = arg.substr(0, separator);
+            const auto value = separator == std::string_view::npos ? std::string_view{} : arg.substr(separator + 1);
+
+            const auto parse_count = [&value](std::size_t &target)
+            {
+                const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), target);
+                return error == std::errc{} && end == value.data() + value.size();
+            };
+
+            bool valid = true;
+            if (key == "--sprites")
+                valid = parse_count(config.sprites);
+            else if (key == "--text-blocks")
+                valid = parse_count(config.text_blocks);
+            else if (key == "--geometry")
+                valid = parse_count(config.geometry);
+            else if (key == "--viewports")
+                valid = parse_count(config.viewports) && config.viewports > 0;
+            else if (key == "--textures")
+                valid = parse_count(config.textures) && config.textures > 0;
+            else if (key == "--frames")
+                valid = parse_count(config.frames) && config.frames > 0;
+            else if (key == "--warmup")
+                valid = parse_count(config.warmup_frames);
+            else if (key == "--font" && !value.empty())
+                config.font = value;
+            else if (key == "--json" && !value.empty())
+                config.json_output = value;
+            else
+                valid = false;
+
+            if (!valid)
+            {
+                std::println(std::cerr, "Invalid argument: {}", arg);
+                return std::nullopt;
+            }
+        }
+
+        return config;
+    }
+
+    std::vector<std::byte> read_binary_file(const std::filesystem::path &path)
+    {
+        std::ifstream file{path, std::ios::binary | std::ios::ate};
+        if (!file.is_open())
+            return {};
+
+        std::vector<std::byte> bytes(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0, std::ios::beg);
+        file.read(reinterpret_cast<char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        return bytes;
+    }
+
+    std::uint64_t total_tagged_allocations() noexcept
+    {
+        std::uint64_t total = 0;
+        for (std::size_t tag = 0; tag < memory_tag_count; ++tag)
+        {
+            total += memory_tag_stats(static_cast<MemoryTag>(tag)).total_allocations;
+        }
+        return total;
+    }
+
+    Percentiles percentiles(std::vector<double> values)
+    {
+        std::ranges::sort(values);
+        const auto at = [&values](const double fraction)
+        {
+            const auto rank = static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(values.size())));
+            return values[std::clamp<std::size_t>(rank, 1, values.size()) - 1];
+        };
+        return Percentiles{.p50 = at(0.5), .p90 = at(0.9), .p99 = at(0.99), .max = values.back()};
+    }
+
+    /**
+     * One scene per viewport, with the objects dealt out between them. Everything lives for the whole run.
+     */
+    struct SyntheticWorld
+    {
+        std::vector<std::unique_ptr<Scene>> scenes;
+        std::vector<RefCountPtr<Texture>> textures;
+        RefCountPtr<Font> font;
+        std::vector<SceneNode *> moving_nodes;
+    };
+
+    Vector2f grid_position(const std::size_t index)
+    {
+        return Vector2f{static_cast<float>(index % 128) * 12.0f, static_cast<float>(index / 128 % 96) * 12.0f};
+    }
+
+    SyntheticWorld build_world(const HarnessConfig &config,
+                               HeadlessRenderBackend &render_backend,
+                               const FontService &font_service,
+                               ViewportManager &viewports)
+    {
+        SyntheticWorld world;
+        for (std::size_t i = 0; i < config.viewports; ++i)
+        {
+            auto &scene = *world.scenes.emplace_back(std::make_unique<Scene>());
+            viewports.create_viewport(AnchorData{}, static_cast<std::int32_t>(i)).set_scene(&scene);
+        }
+        const auto scene_for = [&world](const std::size_t index) -> Scene &
+        { return *world.scenes[index % world.scenes.size()]; };
+
+        const std::vector<std::byte> pixels(64 * 64 * 4, std::byte{0xFF});
+        for (std::size_t i = 0; i < config.textures; ++i)
+        {
+            world.textures.push_back(
+                render_backend.upload_texture(pixels, 64, 64, TextureFormat::rgba8, TextureFilter::nearest, {}).get());
+        }
+
+        for (std::size_t i = 0; i < config.sprites; ++i)
+        {
+            auto &sprite = scene_for(i).create_node<Sprite>();
+            sprite.set_texture(world.textures[i % world.textures.size()]);
+            sprite.set_size(Vector2f{16, 16});
+            sprite.set_transform(Transform2f{grid_position(i)});
+            world.moving_nodes.push_back(&sprite);
+        }
+
+        for (std::size_t i = 0; i < config.geometry; ++i)
+        {
+            auto &geometry = scene_for(i).create_node<GeometryObject>();
+            geometry.set_geometry(i % 2 == 0 ? GeometryType::rectangle : GeometryType::triangle);
+            geometry.set_size(Vector2f{24, 24});
+            geometry.set_transform(Transform2f{grid_position(i)});
+            world.moving_nodes.push_back(&geometry);
+        }
+
+        if (config.text_blocks > 0)
+        {
+            world.font = font_service.load_font(read_binary_file(config.font)).get();
+            for (std::size_t i = 0; i < config.text_blocks; ++i)
+            {
+                auto &text_block = scene_for(i).create_node<TextBlock>();
+                text_block.set_font(world.font);
+                text_block.set_pixel_size(24);
+                text_block.set_text(std::format("Label {} - Score: {}", i, i * 37));
+                text_block.set_transform(Transform2f{grid_position(i)});
+            }
+        }
+
+        return world;
+    }
+
+    void animate(const SyntheticWorld &world, const std::size_t frame)
+    {
+        const auto offset = Vector2f{static_cast<float>(frame % 64), 0};
+        for (const auto [index, node] : world.moving_nodes | std::views::enumerate)
+        {
+            node->set_transform(Transform2f{grid_position(static_cast<std::size_t>(index)) + offset});
+        }
+    }
+
+    void print_percentiles(const std::string_view label, const Percentiles &values)
+    {
+        std::println("{:<14} p50 {:8.3f} ms  p90 {:8.3f} ms  p99 {:8.3f} ms  max {:8.3f} ms",
+                     label,
+                     values.p50,
+                     values.p90,
+                     values.p99,
+                     values.max);
+    }
+
+    void write_percentiles_json(std::ostream &out, const std::string_view name, const Percentiles &values)
+    {
+        std::print(out,
+                   R"("{}": {{"p50": {}, "p90": {}, "p99": {}, "max": {}}})",
+                   name,
+                   values.p50,
+                   values.p90,
+                   values.p99,
+                   values.max);
+    }
+} // namespace
+
+int main(const int argc, char **argv)
+{
+    const auto config = parse_args(std::span{argv, static_cast<std::size_t>(argc)});
+    if (!config.has_value())
+    {
+        print_usage();
+        return 1;
+    }
+
+    if (config->text_blocks > 0 && !std::filesystem::exists(config->font))
+    {
+        std::println(std::cerr, "Font {} does not exist, pass --font or --text-blocks=0", config->font.string());
+        return 1;
+    }
+
+    const auto platform_backend = PlatformBackend::create(PlatformBackendInfo{.kind = PlatformBackendKind::headless});
+    EventManager event_manager;
+    ViewportManager viewports{event_manager};
+    HeadlessRenderBackend render_backend{HeadlessRenderMode::record};
+    const FontService font_service{render_backend};
+
+    SpriteRenderPipeline sprite_pipeline;
+    GeometryRenderPipeline geometry_pipeline;
+    TextBlockRenderPipeline text_block_pipeline;
+    std::array<RenderPipeline *, 3> pipelines{&sprite_pipeline, &geometry_pipeline, &text_block_pipeline};
+
+    RenderManager render_manager{*platform_backend, render_backend, viewports, PipelineManager{pipelines}, true};
+    render_manager.create_new_window(WindowDesc{.width = 1920, .height = 1080, .title = "Frame Benchmark"});
+    auto &recorder = dynamic_cast<RecordingRenderer2D &>(*render_manager.primary_renderer());
+
+    const auto world = build_world(*config, render_backend, font_service, viewports);
+
+    std::vector<FrameSample> samples;
+    samples.reserve(config->frames);
+    for (std::size_t frame = 0; frame < config->warmup_frames + config->frames; ++frame)
+    {
+        animate(world, frame);
+
+        const auto heap_before = heap_allocations.load(std::memory_order_relaxed);
+        const auto tagged_before = total_tagged_allocations();
+        const auto start = std::chrono::steady_clock::now();
+
+        FrameAllocator::begin_frame();
+        render_manager.sync_renderer_state();
+        const auto synced = std::chrono::steady_clock::now();
+        render_manager.render();
+        const auto rendered = std::chrono::steady_clock::now();
+
+        if (frame < config->warmup_frames)
+            continue;
+
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+        samples.push_back(FrameSample{
+            .sync_ms = Milliseconds{synced - start}.count(),
+            .render_ms = Milliseconds{rendered - synced}.count(),
+            .heap_allocations = heap_allocations.load(std::memory_order_relaxed) - heap_before,
+            .tagged_allocations = total_tagged_allocations() - tagged_before,
+            .draw_stats = recorder.last_frame(),
+        });
+    }
+
+    render_manager.on_engine_shutdown();
+
+    const auto frame_percentiles = [&samples](auto projection)
+    { return percentiles(samples | std::views::transform(projection) | std::ranges::to<std::vector>()); };
+    const auto total = frame_percentiles(&FrameSample::total_ms);
+    const auto sync = frame_percentiles(&FrameSample::sync_ms);
+    const auto render = frame_percentiles(&FrameSample::render_ms);
+
+    const auto mean = [&samples](auto projection)
+    {
+        return static_cast<double>(std::ranges::fold_left(samples | std::views::transform(projection),
+                                                          std::uint64_t{0},
+                                                          std::plus{})) /
+               static_cast<double>(samples.size());
+    };
+    const auto heap_per_frame = mean(&FrameSample::heap_allocations);
+    const auto tagged_per_frame = mean(&FrameSample::tagged_allocations);
+    const auto &draw_stats = samples.back().draw_stats;
+
+    std::println("{} sprites, {} text blocks, {} geometry objects across {} viewports, {} frames after {} warmup",
+                 config->sprites,
+                 config->text_blocks,
+                 config->geometry,
+                 config->viewports,
+                 config->frames,
+                 config->warmup_frames);
+    print_percentiles("Frame", total);
+    print_percentiles("Sync", sync);
+    print_percentiles("Render", render);
+    std::println("Allocations    {:.1f} heap / {:.1f} tagged per frame", heap_per_frame, tagged_per_frame);
+    std::println("Draw commands  {} sets, {} sources, {} commands, {} instances, {} bytes uploaded",
+                 draw_stats.draw_command_sets,
+                 draw_stats.draw_command_sources,
+                 draw_stats.draw_commands,
+                 draw_stats.instances,
+                 draw_stats.uploaded_bytes);
+
+    if (config->json_output.has_value())
+    {
+        std::ofstream out{*config->json_output};
+        std::print(out,
+                   R"({{"config": {{"sprites": {}, "text_blocks": {}, "geometry": {}, "viewports": {}, )"
+                   R"("frames": {}}}, )",
+                   config->sprites,
+                   config->text_blocks,
+                   config->geometry,
+                   config->viewports,
+                   config->frames);
+        std::print(out, R"("frame_time_ms": {{)");
+        write_percentiles_json(out, "total", total);
+        std::print(out, ", ");
+        write_percentiles_json(out, "sync", sync);
+        std::print(out, ", ");
+        write_percentiles_json(out, "render", render);
+        std::print(out,
+                   R"(}}, "allocations_per_frame": {{"heap": {}, "tagged": {}}}, )",
+                   heap_per_frame,
+                   tagged_per_frame);
+        std::println(out,
+                     R"("draw_commands": {{"sets": {}, "sources": {}, "commands": {}, "instances": {}, )"
+                     R"("uploaded_bytes": {}}}}})",
+                     draw_stats.draw_command_sets,
+                     draw_stats.draw_command_sources,
+                     draw_stats.draw_commands,
+                     draw_stats.instances,
+                     draw_stats.uploaded_bytes);
+    }
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file entity_manager_benchmark.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <benchmark/benchmark.h>
+
+import std;
+import retro.runtime.ecs.entity;
+import retro.runtime.ecs.entity_manager;
+
+using namespace retro;
+
+namespace
+{
+    struct Position
+    {
+        float x = 0;
+        float y = 0;
+    };
+
+    struct Velocity
+    {
+        float x = 1;
+        float y = 1;
+    };
+
+    /**
+     * Every entity gets a position, every other one a velocity as well, so two-component views have to skip half of
+     * what they walk.
+     */
+    std::vector<Entity> populate(EntityManager &manager, const std::int64_t count)
+    {
+        std::vector<Entity> entities;
+        entities.reserve(static_cast<std::size_t>(count));
+        for (std::int64_t i = 0; i < count; ++i)
+        {
+            const auto entity = manager.create_entity();
+            manager.add<Position>(entity, Position{.x = static_cast<float>(i)});
+            if (i % 2 == 0)
+            {
+                manager.add<Velocity>(entity);
+            }
+            entities.push_back(entity);
+        }
+        return entities;
+    }
+
+    void entity_create_add_destroy(benchmark::State &state)
+    {
+        EntityManager manager;
+        std::vector<Entity> entities(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            for (auto &entity : entities)
+            {
+                entity = manager.create_entity();
+                manager.add<Position>(entity);
+                manager.add<Velocity>(entity);
+            }
+
+            for (const auto entity : entities)
+            {
+                manager.destroy_entity(entity);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void entity_get(benchmark::State &state)
+    {
+        EntityManager manager;
+        const auto entities = populate(manager, state.range(0));
+        for (auto _ : state)
+        {
+            for (const auto entity : entities)
+            {
+                benchmark::DoNotOptimize(manager.get<Position>(entity));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void entity_view_single(benchmark::State &state)
+    {
+        EntityManager manager;
+        populate(manager, state.range(0));
+        for (auto _ : state)
+        {
+            for (auto [entity, position] : manager.view<Position>())
+            {
+                position.x += 1;
+            }
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void entity_view_pair(benchmark::State &state)
+    {
+        EntityManager manager;
+        populate(manager, state.range(0));
+        for (auto _ : state)
+        {
+            for (auto [entity, position, velocity] : manager.view<Position, Velocity>())
+            {
+                position.x += velocity.x;
+                position.y += velocity.y;
+            }
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+} // namespace
+
+BENCHMARK(entity_create_add_destroy)->Arg(1024)->Arg(65536);
+BENCHMARK(entity_get)->Arg(1024)->Arg(65536);
+BENCHMARK(entity_view_single)->Arg(1024)->Arg(65536);
+BENCHMARK(entity_view_pair)->Arg(1024)->Arg(65536);
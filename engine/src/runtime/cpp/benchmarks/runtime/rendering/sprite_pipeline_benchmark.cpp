@@ -0,0 +1,108 @@
+/**
+ * @file sprite_pipeline_benchmark.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <benchmark/benchmark.h>
+
+import std;
+import retro.core.math.transform;
+import retro.core.math.vector;
+import retro.core.memory.arena_allocator;
+import retro.core.memory.ref_counted_ptr;
+import retro.runtime.rendering.objects.sprite;
+import retro.runtime.rendering.texture;
+import retro.runtime.world.scene;
+import retro.runtime.world.viewport;
+
+using namespace retro;
+
+namespace
+{
+    class BenchmarkTexture final : public Texture
+    {
+      public:
+        BenchmarkTexture() noexcept : Texture{64, 64, TextureFormat::rgba8, TextureFilter::nearest}
+        {
+        }
+    };
+
+    constexpr Vector2u viewport_size{1920, 1080};
+
+    /**
+     * A scene of range(0) sprites spread across range(1) textures, roughly what a tile map plus its actors looks like.
+     */
+    struct SyntheticScene
+    {
+        Scene scene;
+        Viewport viewport{AnchorData{}, 0};
+        std::vector<Sprite *> sprites;
+
+        explicit SyntheticScene(const benchmark::State &state)
+        {
+            const auto sprite_count = static_cast<std::size_t>(state.range(0));
+            std::vector<RefCountPtr<Texture>> textures(static_cast<std::size_t>(state.range(1)));
+            for (auto &texture : textures)
+            {
+                texture = make_ref_counted<BenchmarkTexture>();
+            }
+
+            sprites.resize(sprite_count);
+            scene.create_nodes<Sprite>(std::span{sprites});
+            for (const auto [index, sprite] : sprites | std::views::enumerate)
+            {
+                sprite->set_texture(textures[static_cast<std::size_t>(index) % textures.size()]);
+                sprite->set_transform(Transform2f{Vector2f{static_cast<float>(index % 256) * 16.0f,
+                                                           static_cast<float>(index / 256) * 16.0f}});
+            }
+        }
+    };
+
+    void sprite_collect_static(benchmark::State &state)
+    {
+        SyntheticScene synthetic{state};
+        SpriteRenderPipeline pipeline;
+        MultiArenaMemoryResource memory_resource{std::in_place, 1024 * 1024};
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(pipeline.collect_draw_calls_source(synthetic.scene.nodes(),
+                                                                        viewport_size,
+                                                                        synthetic.viewport,
+                                                                        memory_resource));
+            memory_resource.reset();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    /**
+     * Every sprite moves each frame, so their cached quads have to be rebuilt before they are batched.
+     */
+    void sprite_collect_moving(benchmark::State &state)
+    {
+        SyntheticScene synthetic{state};
+        SpriteRenderPipeline pipeline;
+        MultiArenaMemoryResource memory_resource{std::in_place, 1024 * 1024};
+        float offset = 0;
+        for (auto _ : state)
+        {
+            offset += 1.0f;
+            for (auto *sprite : synthetic.sprites)
+            {
+                sprite->set_transform(Transform2f{sprite->transform().translation() + Vector2f{offset, 0}});
+            }
+
+            benchmark::DoNotOptimize(pipeline.collect_draw_calls_source(synthetic.scene.nodes(),
+                                                                        viewport_size,
+                                                                        synthetic.viewport,
+                                                                        memory_resource));
+            memory_resource.reset();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+} // namespace
+
+BENCHMARK(sprite_collect_static)->Args({1024, 1})->Args({1024, 16})->Args({30000, 1})->Args({30000, 16});
+BENCHMARK(sprite_collect_moving)->Args({1024, 16})->Args({30000, 16});
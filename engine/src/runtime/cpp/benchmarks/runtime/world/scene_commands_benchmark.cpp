@@ -0,0 +1,88 @@
+/**
+ * @file scene_commands_benchmark.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <benchmark/benchmark.h>
+
+import std;
+import retro.core.math.vector;
+import retro.core.util.color;
+import retro.runtime.rendering.objects.sprite;
+import retro.runtime.world.scene;
+import retro.runtime.world.scene_commands;
+
+using namespace retro;
+
+namespace
+{
+    constexpr std::size_t commands_per_sprite = 3;
+
+    std::vector<SceneCommand> build_commands(const std::span<Sprite *const> sprites, const float time)
+    {
+        std::vector<SceneCommand> commands;
+        commands.reserve(sprites.size() * commands_per_sprite);
+        for (auto [i, sprite] : sprites | std::views::enumerate)
+        {
+            const auto offset = static_cast<float>(i);
+
+            SceneCommand transform{.node = sprite, .type = SceneCommandType::set_transform};
+            transform.transform = {.position = {offset, time}, .rotation = time, .scale = {1, 1}};
+            commands.push_back(transform);
+
+            SceneCommand z_order{.node = sprite, .type = SceneCommandType::set_z_order};
+            z_order.z_order = 1;
+            commands.push_back(z_order);
+
+            SceneCommand tint{.node = sprite, .type = SceneCommandType::set_sprite_tint};
+            tint.color = Color{1, 1, 1, time};
+            commands.push_back(tint);
+        }
+
+        return commands;
+    }
+
+    /**
+     * Every record goes through its own exported call, which is the shape of the per-property interop functions.
+     */
+    void scene_commands_per_call(benchmark::State &state)
+    {
+        Scene scene;
+        for (std::int64_t i = 0; i < state.range(0); ++i)
+        {
+            scene.create_node<Sprite>();
+        }
+
+        const auto commands = build_commands(scene.nodes_of_type<Sprite>(), 0.5f);
+        for (auto _ : state)
+        {
+            for (const auto &command : commands)
+            {
+                apply_scene_commands(std::span{&command, 1});
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(commands.size()));
+    }
+
+    void scene_commands_batched(benchmark::State &state)
+    {
+        Scene scene;
+        for (std::int64_t i = 0; i < state.range(0); ++i)
+        {
+            scene.create_node<Sprite>();
+        }
+
+        const auto commands = build_commands(scene.nodes_of_type<Sprite>(), 0.5f);
+        for (auto _ : state)
+        {
+            apply_scene_commands(commands);
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(commands.size()));
+    }
+} // namespace
+
+BENCHMARK(scene_commands_per_call)->Arg(1024)->Arg(30000);
+BENCHMARK(scene_commands_batched)->Arg(1024)->Arg(30000);
@@ -0,0 +1,61 @@
+/**
+ * @file scene_nodes_benchmark.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <benchmark/benchmark.h>
+
+import std;
+import retro.runtime.rendering.objects.sprite;
+import retro.runtime.world.scene;
+import retro.runtime.world.scene_node;
+
+using namespace retro;
+
+namespace
+{
+    /**
+     * Spawns and then despawns a burst of sprites one node at a time, the way per-node interop calls do.
+     */
+    void scene_nodes_one_at_a_time(benchmark::State &state)
+    {
+        Scene scene;
+        const auto count = static_cast<std::size_t>(state.range(0));
+        std::vector<Sprite *> sprites(count);
+        for (auto _ : state)
+        {
+            for (auto &sprite : sprites)
+            {
+                sprite = &scene.create_node<Sprite>();
+            }
+
+            for (auto *sprite : sprites)
+            {
+                scene.destroy_node(*sprite);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void scene_nodes_batched(benchmark::State &state)
+    {
+        Scene scene;
+        const auto count = static_cast<std::size_t>(state.range(0));
+        std::vector<Sprite *> sprites(count);
+        std::vector<SceneNode *> nodes(count);
+        for (auto _ : state)
+        {
+            scene.create_nodes<Sprite>(std::span{sprites});
+
+            std::ranges::copy(sprites, nodes.begin());
+            scene.destroy_nodes(nodes);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+} // namespace
+
+BENCHMARK(scene_nodes_one_at_a_time)->Arg(1024)->Arg(30000);
+BENCHMARK(scene_nodes_batched)->Arg(1024)->Arg(30000);
@@ -0,0 +1,135 @@
+/**
+ * @file coroutine_frame_allocator.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module retro.core.async.coroutine_frame_allocator;
+
+namespace retro
+{
+    namespace
+    {
+        constexpr std::size_t block_size(const std::size_t size_class) noexcept
+        {
+            return CoroutineFrameAllocator::min_size_class << size_class;
+        }
+
+        struct FreeFrame
+        {
+            FreeFrame *next;
+        };
+
+        struct FrameCache
+        {
+            std::array<FreeFrame *, CoroutineFrameAllocator::size_class_count> free_lists{};
+            std::array<std::size_t, CoroutineFrameAllocator::size_class_count> cached{};
+            std::size_t allocations = 0;
+            std::size_t recycled = 0;
+
+            FrameCache() = default;
+            FrameCache(const FrameCache &) = delete;
+            FrameCache(FrameCache &&) = delete;
+            ~FrameCache();
+            FrameCache &operator=(const FrameCache &) = delete;
+            FrameCache &operator=(FrameCache &&) = delete;
+
+            void release_all() noexcept
+            {
+                for (std::size_t i = 0; i < free_lists.size(); ++i)
+                {
+                    while (free_lists[i] != nullptr)
+                    {
+                        auto *frame = std::exchange(free_lists[i], free_lists[i]->next);
+                        ::operator delete(frame, block_size(i));
+                    }
+                    cached[i] = 0;
+                }
+            }
+        };
+
+        // Frames may still be freed by other thread_local destructors after the cache is gone
+        thread_local constinit bool cache_destroyed = false;
+        thread_local FrameCache cache;
+
+        FrameCache::~FrameCache()
+        {
+            release_all();
+            cache_destroyed = true;
+        }
+    } // namespace
+
+    void *CoroutineFrameAllocator::allocate(const std::size_t size)
+    {
+        const auto size_class = size_class_of(size);
+        if (size_class >= size_class_count)
+        {
+            return write_header(::operator new(size + header_size), CoroutineFrameSource::heap);
+        }
+
+        if (!cache_destroyed)
+        {
+            ++cache.allocations;
+            if (auto *frame = cache.free_lists[size_class]; frame != nullptr)
+            {
+                cache.free_lists[size_class] = frame->next;
+                --cache.cached[size_class];
+                ++cache.recycled;
+                return write_header(frame, CoroutineFrameSource::pooled);
+            }
+        }
+
+        return write_header(::operator new(block_size(size_class)), CoroutineFrameSource::pooled);
+    }
+
+    void CoroutineFrameAllocator::deallocate(void *frame, const std::size_t size) noexcept
+    {
+        auto *block = static_cast<std::byte *>(frame) - header_size;
+        switch (std::launder(reinterpret_cast<Header *>(block))->source)
+        {
+            case CoroutineFrameSource::arena:
+                // Released when the owning arena is reset
+                return;
+            case CoroutineFrameSource::heap:
+                ::operator delete(block, size + header_size);
+                return;
+            case CoroutineFrameSource::pooled:
+                break;
+        }
+
+        const auto size_class = size_class_of(size);
+        if (cache_destroyed || cache.cached[size_class] >= max_cached_per_class)
+        {
+            ::operator delete(block, block_size(size_class));
+            return;
+        }
+
+        auto &head = cache.free_lists[size_class];
+        head = std::construct_at(reinterpret_cast<FreeFrame *>(block), head);
+        ++cache.cached[size_class];
+    }
+
+    CoroutineFrameSource CoroutineFrameAllocator::source(const void *frame) noexcept
+    {
+        const auto *block = static_cast<const std::byte *>(frame) - header_size;
+        return std::launder(reinterpret_cast<const Header *>(block))->source;
+    }
+
+    CoroutineFrameStats CoroutineFrameAllocator::thread_stats() noexcept
+    {
+        if (cache_destroyed)
+            return {};
+
+        return CoroutineFrameStats{.allocations = cache.allocations,
+                                   .recycled = cache.recycled,
+                                   .cached = std::ranges::fold_left(cache.cached, std::size_t{0}, std::plus{})};
+    }
+
+    void CoroutineFrameAllocator::trim() noexcept
+    {
+        if (!cache_destroyed)
+        {
+            cache.release_all();
+        }
+    }
+} // namespace retro
@@ -11,21 +11,20 @@ namespace retro
 {
     void ManualTaskScheduler::enqueue(std::coroutine_handle<> coroutine)
     {
-        std::scoped_lock lock{mutex_};
-        queue_.emplace_back(coroutine);
+        queue_.emplace(coroutine);
     }
 
     void ManualTaskScheduler::enqueue(SimpleDelegate delegate, std::stop_token stop_token)
     {
-        std::scoped_lock lock{mutex_};
-        queue_.emplace_back(std::in_place_type<DelegateCallback>, std::move(delegate), std::move(stop_token));
+        queue_.emplace(std::in_place_type<DelegateCallback>, std::move(delegate), std::move(stop_token));
     }
 
     std::size_t ManualTaskScheduler::pump(const std::size_t max)
     {
+        // Snapshot what is queued right now, leftovers from a capped pump stay in front so the order is preserved
+        while (auto work = queue_.pop())
         {
-            std::scoped_lock lock{mutex_};
-            pumping_.swap(queue_);
+            pumping_.push_back(std::move(*work));
         }
 
         std::size_t ran = 0;
@@ -55,17 +54,6 @@ namespace retro
             ran++;
         }
 
-        if (!pumping_.empty())
-        {
-            std::scoped_lock lock{mutex_};
-
-            while (!pumping_.empty())
-            {
-                queue_.push_front(std::move(pumping_.back()));
-                pumping_.pop_back();
-            }
-        }
-
         return ran;
     }
 } // namespace retro
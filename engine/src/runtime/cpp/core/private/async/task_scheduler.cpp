@@ -25,6 +25,22 @@ namespace retro
     {
         return current_scheduler;
     }
+
+    void TaskScheduler::enqueue(SimpleDelegate delegate, std::stop_token stop_token, TaskPriority)
+    {
+        enqueue(std::move(delegate), std::move(stop_token));
+    }
+
+    bool TaskScheduler::should_yield(TaskPriority) const noexcept
+    {
+        return false;
+    }
+
+    std::size_t TaskScheduler::concurrency() const noexcept
+    {
+        return 1;
+    }
+
     TaskScheduler &TaskScheduler::default_scheduler()
     {
         static ThreadPoolTaskScheduler singleton;
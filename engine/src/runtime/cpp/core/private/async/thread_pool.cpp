@@ -4,49 +4,235 @@
  * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
  * Licensed under the MIT License. See LICENSE file in the project root for full license information.
  */
+module;
+
+#include "retro/core/profiling.hpp"
+
 module retro.core.async.thread_pool;
 
+import retro.core.profiling;
+
 namespace retro
 {
+    namespace
+    {
+        constexpr std::size_t spin_limit = 64;
+
+        thread_local const void *current_pool = nullptr;
+        thread_local std::size_t current_worker = 0;
+    } // namespace
 
     ThreadPool::ThreadPool(const std::size_t thread_count)
     {
-        threads_.reserve(thread_count);
+        // Every deque has to exist before any worker starts looking for something to steal
+        workers_.reserve(thread_count);
         for (std::size_t i = 0; i < thread_count; ++i)
         {
-            threads_.emplace_back(&ThreadPool::run, this);
+            workers_.push_back(std::make_unique<Worker>());
+        }
+
+        for (std::size_t i = 0; i < thread_count; ++i)
+        {
+            workers_[i]->thread = std::jthread{&ThreadPool::run, this, i};
         }
     }
 
     ThreadPool::~ThreadPool()
     {
         is_active_ = false;
-        cv_.notify_all();
+        wake_epoch_.fetch_add(1, std::memory_order_release);
+        wake_epoch_.notify_all();
+
+        for (const auto &worker : workers_)
+        {
+            if (worker->thread.joinable())
+                worker->thread.join();
+        }
+
+        for (const auto &worker : workers_)
+        {
+            while (auto item = worker->deque.pop())
+                discard(*item);
+        }
+
+        for (auto &queue : injection_)
+        {
+            std::ranges::for_each(queue.items, &ThreadPool::discard);
+        }
     }
 
-    void ThreadPool::post(std::packaged_task<void()> task, std::stop_token stop_token)
+    void ThreadPool::post(Job job, std::stop_token stop_token, const TaskPriority priority)
     {
-        std::unique_lock lock{guard_};
-        pending_jobs_.emplace_back(std::move(task), std::move(stop_token));
-        cv_.notify_one();
+        auto *queued = new QueuedJob{.job = std::move(job), .stop_token = std::move(stop_token)};
+        push(reinterpret_cast<WorkItem>(queued), priority);
     }
 
-    void ThreadPool::run() noexcept
+    void ThreadPool::post(const std::coroutine_handle<> coroutine, const TaskPriority priority)
     {
-        while (is_active_)
+        push(reinterpret_cast<WorkItem>(coroutine.address()) | coroutine_tag, priority);
+    }
+
+    bool ThreadPool::has_pending_above(const TaskPriority priority) const noexcept
+    {
+        for (std::size_t lane = 0; lane < std::to_underlying(priority); ++lane)
         {
-            thread_local std::pair<std::packaged_task<void()>, std::stop_token> job;
+            if (pending_counts_[lane].load(std::memory_order_relaxed) > 0)
+                return true;
+        }
+
+        return false;
+    }
+
+    void ThreadPool::push(const WorkItem item, const TaskPriority priority)
+    {
+        const auto lane = std::to_underlying(priority);
+        pending_counts_[lane].fetch_add(1, std::memory_order_relaxed);
+
+        if (priority == TaskPriority::normal && current_pool == this)
+        {
+            workers_[current_worker]->deque.push(item);
+        }
+        else
+        {
+            auto &queue = injection_[lane];
+            std::scoped_lock lock{queue.mutex};
+            queue.items.push_back(item);
+            queue.size.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Pairs with the fence in park, either the sleeper sees the new work or we see the sleeper
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_relaxed) > 0)
+            wake_one();
+    }
+
+    void ThreadPool::run(const std::size_t index) noexcept
+    {
+        current_pool = this;
+        current_worker = index;
+        set_profile_thread_name(std::format("Worker {}", index));
+
+        std::size_t idle_spins = 0;
+        while (is_active_.load(std::memory_order_relaxed))
+        {
+            if (const auto item = find_work(index); item.has_value())
+            {
+                execute(*item);
+                idle_spins = 0;
+                continue;
+            }
+
+            if (++idle_spins < spin_limit)
             {
-                std::unique_lock lock{guard_};
-                cv_.wait(lock, [&] { return !pending_jobs_.empty() || !is_active_; });
-                if (!is_active_)
-                    break;
-                job.swap(pending_jobs_.front());
-                pending_jobs_.pop_front();
-                if (job.second.stop_requested())
-                    continue;
+                std::this_thread::yield();
+                continue;
             }
-            job.first();
+
+            park();
+            idle_spins = 0;
         }
+
+        current_pool = nullptr;
+    }
+
+    Optional<ThreadPool::WorkItem> ThreadPool::find_work(const std::size_t index) noexcept
+    {
+        if (auto item = take_injected(TaskPriority::high); item.has_value())
+            return item;
+
+        constexpr auto normal_lane = std::to_underlying(TaskPriority::normal);
+        if (auto item = workers_[index]->deque.pop(); item.has_value())
+        {
+            pending_counts_[normal_lane].fetch_sub(1, std::memory_order_relaxed);
+            return item;
+        }
+
+        if (auto item = take_injected(TaskPriority::normal); item.has_value())
+            return item;
+
+        for (std::size_t offset = 1; offset < workers_.size(); ++offset)
+        {
+            auto &victim = workers_[(index + offset) % workers_.size()]->deque;
+            if (auto item = victim.steal(); item.has_value())
+            {
+                pending_counts_[normal_lane].fetch_sub(1, std::memory_order_relaxed);
+                return item;
+            }
+        }
+
+        return take_injected(TaskPriority::low);
+    }
+
+    Optional<ThreadPool::WorkItem> ThreadPool::take_injected(const TaskPriority priority) noexcept
+    {
+        const auto lane = std::to_underlying(priority);
+        auto &queue = injection_[lane];
+        if (queue.size.load(std::memory_order_relaxed) == 0)
+            return std::nullopt;
+
+        std::scoped_lock lock{queue.mutex};
+        if (queue.items.empty())
+            return std::nullopt;
+
+        const auto item = queue.items.front();
+        queue.items.pop_front();
+        queue.size.fetch_sub(1, std::memory_order_relaxed);
+        pending_counts_[lane].fetch_sub(1, std::memory_order_relaxed);
+        return item;
+    }
+
+    void ThreadPool::park() noexcept
+    {
+        const auto epoch = wake_epoch_.load(std::memory_order_acquire);
+        sleeping_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (is_active_.load(std::memory_order_relaxed) && !has_pending_work())
+            wake_epoch_.wait(epoch, std::memory_order_acquire);
+
+        sleeping_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void ThreadPool::wake_one() noexcept
+    {
+        wake_epoch_.fetch_add(1, std::memory_order_release);
+        wake_epoch_.notify_one();
+    }
+
+    bool ThreadPool::has_pending_work() const noexcept
+    {
+        return std::ranges::any_of(pending_counts_,
+                                   [](const auto &count) { return count.load(std::memory_order_relaxed) > 0; });
+    }
+
+    void ThreadPool::execute(const WorkItem item) noexcept
+    {
+        RETRO_PROFILE_SCOPE("ThreadPool::execute");
+        if ((item & coroutine_tag) != 0)
+        {
+            const auto coroutine = std::coroutine_handle<>::from_address(reinterpret_cast<void *>(item & ~coroutine_tag));
+            if (coroutine && !coroutine.done())
+                coroutine.resume();
+            return;
+        }
+
+        const std::unique_ptr<QueuedJob> job{reinterpret_cast<QueuedJob *>(item)};
+        if (job->stop_token.stop_requested())
+            return;
+
+        try
+        {
+            job->job();
+        }
+        catch (...)
+        {
+            // A job throwing must not take the worker down with it
+        }
+    }
+
+    void ThreadPool::discard(const WorkItem item) noexcept
+    {
+        if ((item & coroutine_tag) == 0)
+            delete reinterpret_cast<QueuedJob *>(item);
     }
 } // namespace retro
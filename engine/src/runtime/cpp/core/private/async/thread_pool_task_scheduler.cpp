@@ -11,17 +11,30 @@ namespace retro
 
     void ThreadPoolTaskScheduler::enqueue(std::coroutine_handle<> coroutine)
     {
-        thread_pool_.post(
-            [coroutine]
-            {
-                if (coroutine && !coroutine.done())
-                    coroutine.resume();
-            });
+        thread_pool_.post(coroutine);
     }
 
     void ThreadPoolTaskScheduler::enqueue(SimpleDelegate delegate, std::stop_token stop_token)
+    {
+        enqueue(std::move(delegate), std::move(stop_token), TaskPriority::normal);
+    }
+
+    void ThreadPoolTaskScheduler::enqueue(SimpleDelegate delegate,
+                                          std::stop_token stop_token,
+                                          const TaskPriority priority)
     {
         thread_pool_.post([delegate = std::move(delegate)] { std::ignore = delegate.execute_if_bound(); },
-                          std::move(stop_token));
+                          std::move(stop_token),
+                          priority);
+    }
+
+    bool ThreadPoolTaskScheduler::should_yield(const TaskPriority priority) const noexcept
+    {
+        return thread_pool_.has_pending_above(priority);
+    }
+
+    std::size_t ThreadPoolTaskScheduler::concurrency() const noexcept
+    {
+        return thread_pool_.thread_count();
     }
 } // namespace retro
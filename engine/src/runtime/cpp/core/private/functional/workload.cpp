@@ -5,12 +5,116 @@
  * Licensed under the MIT License. See LICENSE file in the project root for full license information.
  */
 module retro.core.async.workload;
-import retro.core.async.task_actions;
 import retro.core.util.exceptions;
-import retro.core.async.concepts;
+import retro.core.functional.delegate;
 
 namespace retro
 {
+    namespace
+    {
+        struct ParallelWorkload
+        {
+            const std::function<bool(std::size_t, std::size_t)> &worker_function;
+            std::size_t chunks;
+            std::size_t thread_count;
+            TaskPriority priority;
+            std::stop_token stop_token;
+            std::atomic<bool> result{true};
+            std::atomic<std::size_t> next{0};
+            std::atomic<std::size_t> active_workers{0};
+            std::atomic_flag has_exception;
+            std::exception_ptr exception;
+            TaskCompletionSource<void> completion;
+        };
+
+        std::pair<std::size_t, std::size_t> claim_chunks(ParallelWorkload &workload) noexcept
+        {
+            auto begin = workload.next.load(std::memory_order_relaxed);
+            std::size_t count;
+            do
+            {
+                if (begin >= workload.chunks)
+                    return {workload.chunks, workload.chunks};
+
+                // Guided scheduling, early claims take large batches so cheap chunks don't pay for an atomic each,
+                // while the tail is split finely enough to keep every worker busy until the end
+                count = std::max<std::size_t>(1, (workload.chunks - begin) / (workload.thread_count * 2));
+            } while (!workload.next.compare_exchange_weak(begin, begin + count, std::memory_order_relaxed));
+
+            return {begin, begin + count};
+        }
+
+        struct WorkloadRunner
+        {
+            ParallelWorkload *workload;
+            std::size_t thread_no;
+            std::size_t begin = 0;
+            std::size_t end = 0;
+
+            void operator()() const noexcept
+            {
+                auto &scheduler = TaskScheduler::default_scheduler();
+                auto current = begin;
+                auto last = end;
+                try
+                {
+                    while (workload->result.load(std::memory_order_relaxed) &&
+                           !workload->stop_token.stop_requested())
+                    {
+                        if (current == last)
+                        {
+                            std::tie(current, last) = claim_chunks(*workload);
+                            if (current == last)
+                                break;
+                        }
+
+                        if (!workload->worker_function(current++, thread_no))
+                            workload->result.store(false, std::memory_order_relaxed);
+
+                        // Give the thread back to more important work between chunks, the thread number stays with
+                        // this runner so any per-thread scratch space is still exclusively ours when we resume
+                        if (scheduler.should_yield(workload->priority))
+                        {
+                            scheduler.enqueue(
+                                SimpleDelegate::create(WorkloadRunner{workload, thread_no, current, last}),
+                                {},
+                                workload->priority);
+                            return;
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    workload->result.store(false, std::memory_order_relaxed);
+                    if (!workload->has_exception.test_and_set(std::memory_order_relaxed))
+                        workload->exception = std::current_exception();
+                }
+
+                finish_worker();
+            }
+
+          private:
+            void finish_worker() const noexcept
+            {
+                if (workload->active_workers.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                    return;
+
+                if (workload->exception != nullptr)
+                {
+                    workload->completion.set_exception(workload->exception);
+                }
+                else if (workload->stop_token.stop_requested())
+                {
+                    workload->completion.set_cancelled(workload->stop_token);
+                }
+                else
+                {
+                    workload->completion.set_result();
+                }
+            }
+        };
+    } // namespace
+
     bool Workload::finish(const std::int32_t thread_count) const
     {
         if (chunks_ == 0)
@@ -58,26 +162,25 @@ namespace retro
     Task<bool> Workload::finish_parallel(const std::int32_t thread_count, std::stop_token stop_token) const
     {
         throw_if_stop_requested(stop_token);
-        std::atomic result{true};
-        std::atomic<std::size_t> next{0};
-        auto thread_worker = [this, &result, &next](const std::size_t thread_no)
-        {
-            for (std::size_t i = next++; i < chunks_ && result; i = next++)
-            {
-                if (!worker_function_(i, thread_no))
-                    result = false;
-            }
-        };
+        const auto worker_count = std::min(static_cast<std::size_t>(thread_count), chunks_);
+        ParallelWorkload workload{.worker_function = worker_function_,
+                                  .chunks = chunks_,
+                                  .thread_count = worker_count,
+                                  .priority = priority_,
+                                  .stop_token = stop_token};
+        workload.active_workers.store(worker_count, std::memory_order_relaxed);
+        auto task = workload.completion.get_task();
 
-        std::vector<Task<>> tasks;
-        tasks.reserve(thread_count);
-        for (std::size_t i = 0; i < thread_count; ++i)
-            tasks.push_back(run_async(thread_worker, i, stop_token));
-        for (auto &task : tasks)
+        // Workers count themselves down, so the last one out completes the task instead of awaiting each in turn
+        auto &scheduler = TaskScheduler::default_scheduler();
+        for (std::size_t i = 0; i < worker_count; ++i)
         {
-            co_await std::move(task).configure_await(false);
+            scheduler.enqueue(SimpleDelegate::create(WorkloadRunner{.workload = &workload, .thread_no = i}),
+                              {},
+                              priority_);
         }
 
-        co_return result;
+        co_await std::move(task).configure_await(false);
+        co_return workload.result.load(std::memory_order_relaxed);
     }
 } // namespace retro
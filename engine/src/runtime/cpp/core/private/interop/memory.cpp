@@ -0,0 +1,36 @@
+/**
+ * @file memory.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include "retro/core/exports.h"
+
+import std;
+import retro.core.memory.frame_allocator;
+import retro.core.memory.memory_tracking;
+
+using namespace retro;
+
+extern "C"
+{
+    RETRO_API void retro_frame_allocator_begin_frame()
+    {
+        FrameAllocator::begin_frame();
+    }
+
+    RETRO_API const char *retro_memory_get_tag_name(const MemoryTag tag)
+    {
+        return memory_tag_name(tag);
+    }
+
+    RETRO_API void retro_memory_get_tag_stats(const MemoryTag tag, MemoryTagStats *stats)
+    {
+        *stats = memory_tag_stats(tag);
+    }
+
+    RETRO_API void retro_memory_reset_peaks()
+    {
+        reset_memory_peaks();
+    }
+}
@@ -97,4 +97,29 @@ extern "C"
         std::memcpy(buffer, utf16_string.data(), string_length * sizeof(char16_t));
         return static_cast<std::int32_t>(string_length);
     }
+
+    RETRO_API void retro_name_table_save_snapshot(const char16_t *path,
+                                                  const std::int32_t length,
+                                                  retro::InteropError *error)
+    {
+        retro::try_execute(
+            [&] {
+                retro::save_name_table_snapshot(std::u16string_view{path, static_cast<std::size_t>(length)});
+            },
+            *error);
+    }
+
+    RETRO_API std::int32_t retro_name_table_load_snapshot(const char16_t *path,
+                                                          const std::int32_t length,
+                                                          retro::InteropError *error)
+    {
+        std::int32_t loaded = 0;
+        retro::try_execute(
+            [&] {
+                loaded = static_cast<std::int32_t>(
+                    retro::load_name_table_snapshot(std::u16string_view{path, static_cast<std::size_t>(length)}));
+            },
+            *error);
+        return loaded;
+    }
 }
@@ -0,0 +1,77 @@
+/**
+ * @file profiling.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include "retro/core/exports.h"
+
+import std;
+import retro.core.profiling;
+import retro.core.interop.interop_error;
+
+using namespace retro;
+
+extern "C"
+{
+    RETRO_API bool retro_profiling_is_capturing()
+    {
+        return is_profiling();
+    }
+
+    RETRO_API void retro_profiling_begin_capture()
+    {
+        begin_profile_capture();
+    }
+
+    RETRO_API void retro_profiling_end_capture(const char16_t *path, const std::int32_t length, InteropError *error)
+    {
+        try_execute(
+            [&]
+            {
+                const auto capture = end_profile_capture();
+                save_chrome_trace(capture, std::u16string_view{path, static_cast<std::size_t>(length)});
+            },
+            *error);
+    }
+
+    RETRO_API void retro_profiling_mark_frame(const std::uint64_t frame)
+    {
+        mark_profile_frame(frame);
+    }
+
+    RETRO_API bool retro_profiling_is_gpu_timing_enabled()
+    {
+        return is_gpu_timing_enabled();
+    }
+
+    RETRO_API void retro_profiling_set_gpu_timing_enabled(const bool enabled)
+    {
+        set_gpu_timing_enabled(enabled);
+    }
+
+    /**
+     * Copies up to capacity entries and returns how many there are in total, so the caller can retry with a larger
+     * buffer. The names stay valid for the lifetime of the process.
+     */
+    RETRO_API std::int32_t retro_profiling_get_gpu_timings(GpuTimingStats *stats,
+                                                           const std::int32_t capacity,
+                                                           InteropError *error)
+    {
+        std::int32_t count = 0;
+        try_execute(
+            [&]
+            {
+                const auto timings = gpu_timing_stats();
+                std::ranges::copy(timings | std::views::take(capacity), stats);
+                count = static_cast<std::int32_t>(timings.size());
+            },
+            *error);
+        return count;
+    }
+
+    RETRO_API void retro_profiling_reset_gpu_timings(InteropError *error)
+    {
+        try_execute([] { reset_gpu_timing_stats(); }, *error);
+    }
+}
@@ -0,0 +1,163 @@
+/**
+ * @file frame_allocator.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module;
+
+#include <cassert>
+
+module retro.core.memory.frame_allocator;
+
+import retro.core.memory.arena_allocator;
+import retro.core.memory.memory_tracking;
+
+namespace retro
+{
+    namespace
+    {
+        // Enough blocks for a busy frame stay cached, anything past that goes back to the heap on reset
+        constexpr std::size_t retained_blocks_per_frame = 8;
+
+        struct FrameSlot
+        {
+            MultiArena arena{FrameAllocator::block_capacity,
+                             1,
+                             std::numeric_limits<std::size_t>::max(),
+                             retained_blocks_per_frame,
+                             MemoryTag::frame_arenas};
+        };
+
+        std::atomic<std::size_t> global_high_water_bytes{0};
+
+        class ThreadFrames;
+
+        class FrameMemoryResource final : public std::pmr::memory_resource
+        {
+          public:
+            explicit FrameMemoryResource(ThreadFrames &frames) noexcept : frames_{frames}
+            {
+            }
+
+          protected:
+            void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+            void do_deallocate(void *, std::size_t, std::size_t) override
+            {
+                // Reclaimed wholesale when the frame comes back around
+            }
+
+            [[nodiscard]] bool do_is_equal(const memory_resource &other) const noexcept override
+            {
+                return this == &other;
+            }
+
+          private:
+            ThreadFrames &frames_;
+        };
+
+        class ThreadFrames
+        {
+          public:
+            ThreadFrames() = default;
+            ThreadFrames(const ThreadFrames &) = delete;
+            ThreadFrames(ThreadFrames &&) = delete;
+            ~ThreadFrames() = default;
+            ThreadFrames &operator=(const ThreadFrames &) = delete;
+            ThreadFrames &operator=(ThreadFrames &&) = delete;
+
+            void begin_frame() noexcept
+            {
+                high_water_ = std::max(high_water_, bytes_this_frame_);
+
+                auto observed = global_high_water_bytes.load(std::memory_order_relaxed);
+                while (observed < bytes_this_frame_ &&
+                       !global_high_water_bytes.compare_exchange_weak(observed,
+                                                                      bytes_this_frame_,
+                                                                      std::memory_order_relaxed))
+                {
+                }
+
+                ++frame_index_;
+                bytes_this_frame_ = 0;
+                current_slot().arena.reset();
+            }
+
+            void *allocate(const std::size_t size, const std::size_t alignment)
+            {
+                auto *result = current_slot().arena.allocate(size, alignment);
+                bytes_this_frame_ += size;
+                return result;
+            }
+
+            [[nodiscard]] std::pmr::memory_resource &resource() noexcept
+            {
+                return resource_;
+            }
+
+            [[nodiscard]] FrameAllocatorStats stats() const noexcept
+            {
+                return FrameAllocatorStats{.frame_index = frame_index_,
+                                           .bytes_this_frame = bytes_this_frame_,
+                                           .high_water = std::max(high_water_, bytes_this_frame_)};
+            }
+
+          private:
+            FrameSlot &current_slot() noexcept
+            {
+                return slots_[frame_index_ % FrameAllocator::frames_in_flight];
+            }
+
+            std::array<FrameSlot, FrameAllocator::frames_in_flight> slots_;
+            std::uint64_t frame_index_ = 0;
+            std::size_t bytes_this_frame_ = 0;
+            std::size_t high_water_ = 0;
+            FrameMemoryResource resource_{*this};
+        };
+
+        void *FrameMemoryResource::do_allocate(const std::size_t bytes, const std::size_t alignment)
+        {
+            return frames_.allocate(bytes, alignment);
+        }
+
+        // Only threads that actually run frames pay for the arenas
+        thread_local std::optional<ThreadFrames> frames;
+    } // namespace
+
+    void FrameAllocator::begin_frame()
+    {
+        if (!frames.has_value())
+        {
+            frames.emplace();
+        }
+
+        frames->begin_frame();
+    }
+
+    bool FrameAllocator::in_frame() noexcept
+    {
+        return frames.has_value();
+    }
+
+    void *FrameAllocator::allocate(const std::size_t size, const std::size_t alignment)
+    {
+        assert(frames.has_value());
+        return frames->allocate(size, alignment);
+    }
+
+    std::pmr::memory_resource &FrameAllocator::resource() noexcept
+    {
+        return frames.has_value() ? frames->resource() : *std::pmr::get_default_resource();
+    }
+
+    FrameAllocatorStats FrameAllocator::thread_stats() noexcept
+    {
+        return frames.has_value() ? frames->stats() : FrameAllocatorStats{};
+    }
+
+    std::size_t FrameAllocator::global_high_water() noexcept
+    {
+        return std::max(global_high_water_bytes.load(std::memory_order_relaxed), thread_stats().high_water);
+    }
+} // namespace retro
@@ -0,0 +1,128 @@
+/**
+ * @file mapped_file.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module;
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+module retro.core.memory.mapped_file;
+
+import retro.core.util.deferred;
+import retro.core.util.exceptions;
+
+namespace retro
+{
+#ifdef _WIN32
+    MappedFile::MappedFile(const std::filesystem::path &path)
+    {
+        HANDLE file = CreateFileW(path.c_str(),
+                                  GENERIC_READ,
+                                  FILE_SHARE_READ,
+                                  nullptr,
+                                  OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL,
+                                  nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            throw IoException{std::format("Failed to open {}", path.string())};
+
+        Deferred close_file{[file] { CloseHandle(file); }};
+
+        LARGE_INTEGER file_size{};
+        if (!GetFileSizeEx(file, &file_size))
+            throw IoException{std::format("Failed to read the size of {}", path.string())};
+
+        // Empty files can't be mapped, they just have no data
+        if (file_size.QuadPart == 0)
+            return;
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr)
+            throw IoException{std::format("Failed to map {}", path.string())};
+
+        // The view keeps the mapping alive on its own
+        Deferred close_mapping{[mapping] { CloseHandle(mapping); }};
+        const auto *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr)
+            throw IoException{std::format("Failed to map {}", path.string())};
+
+        data_ = static_cast<const std::byte *>(view);
+        size_ = static_cast<std::size_t>(file_size.QuadPart);
+    }
+
+    void MappedFile::unmap() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            UnmapViewOfFile(data_);
+        }
+    }
+#else
+    MappedFile::MappedFile(const std::filesystem::path &path)
+    {
+        const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file < 0)
+            throw IoException{std::format("Failed to open {}", path.string())};
+
+        Deferred close_file{[file] { ::close(file); }};
+
+        struct stat info{};
+        if (::fstat(file, &info) != 0)
+            throw IoException{std::format("Failed to read the size of {}", path.string())};
+
+        // Empty files can't be mapped, they just have no data
+        if (info.st_size == 0)
+            return;
+
+        // The mapping stays valid after the descriptor is closed
+        const auto size = static_cast<std::size_t>(info.st_size);
+        void *view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (view == MAP_FAILED)
+            throw IoException{std::format("Failed to map {}", path.string())};
+
+        data_ = static_cast<const std::byte *>(view);
+        size_ = size;
+    }
+
+    void MappedFile::unmap() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(const_cast<std::byte *>(data_), size_);
+        }
+    }
+#endif
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept
+        : data_{std::exchange(other.data_, nullptr)}, size_{std::exchange(other.size_, 0)}
+    {
+    }
+
+    MappedFile::~MappedFile()
+    {
+        unmap();
+    }
+
+    MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+    {
+        if (this != &other)
+        {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+
+        return *this;
+    }
+} // namespace retro
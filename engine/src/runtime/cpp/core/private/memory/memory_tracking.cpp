@@ -0,0 +1,130 @@
+/**
+ * @file memory_tracking.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module retro.core.memory.memory_tracking;
+
+import retro.core.profiling;
+
+namespace retro
+{
+    namespace
+    {
+        struct alignas(64) TagCounters
+        {
+            std::atomic<std::size_t> live_bytes{0};
+            std::atomic<std::size_t> peak_bytes{0};
+            std::atomic<std::size_t> live_allocations{0};
+            std::atomic<std::uint64_t> total_allocations{0};
+        };
+
+        struct TagInfo
+        {
+            const char *name;
+            const char *counter_name;
+        };
+
+        constexpr std::array<TagInfo, memory_tag_count> tag_info = {{
+            {.name = "Untagged", .counter_name = "Memory: Untagged"},
+            {.name = "Names", .counter_name = "Memory: Names"},
+            {.name = "EcsPools", .counter_name = "Memory: EcsPools"},
+            {.name = "SceneNodes", .counter_name = "Memory: SceneNodes"},
+            {.name = "FontAtlases", .counter_name = "Memory: FontAtlases"},
+            {.name = "Textures", .counter_name = "Memory: Textures"},
+            {.name = "GpuBuffers", .counter_name = "Memory: GpuBuffers"},
+            {.name = "FrameArenas", .counter_name = "Memory: FrameArenas"},
+        }};
+
+        // Allocations may happen during static initialization, so the counters are constant initialized
+        constinit std::array<TagCounters, memory_tag_count> tag_counters{};
+
+        TagCounters &counters(const MemoryTag tag) noexcept
+        {
+            return tag_counters[std::to_underlying(tag)];
+        }
+
+        void add_live_bytes(TagCounters &tag, const std::size_t bytes) noexcept
+        {
+            const auto live = tag.live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+            auto peak = tag.peak_bytes.load(std::memory_order_relaxed);
+            while (live > peak && !tag.peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+            {
+            }
+        }
+    } // namespace
+
+    void track_allocation(const MemoryTag tag, const std::size_t bytes) noexcept
+    {
+        auto &tag_counter = counters(tag);
+        add_live_bytes(tag_counter, bytes);
+        tag_counter.live_allocations.fetch_add(1, std::memory_order_relaxed);
+        tag_counter.total_allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void track_deallocation(const MemoryTag tag, const std::size_t bytes) noexcept
+    {
+        auto &tag_counter = counters(tag);
+        tag_counter.live_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+        tag_counter.live_allocations.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void track_resize(const MemoryTag tag, const std::size_t old_bytes, const std::size_t new_bytes) noexcept
+    {
+        if (old_bytes == new_bytes)
+            return;
+
+        if (old_bytes == 0)
+        {
+            track_allocation(tag, new_bytes);
+        }
+        else if (new_bytes == 0)
+        {
+            track_deallocation(tag, old_bytes);
+        }
+        else if (new_bytes > old_bytes)
+        {
+            add_live_bytes(counters(tag), new_bytes - old_bytes);
+        }
+        else
+        {
+            counters(tag).live_bytes.fetch_sub(old_bytes - new_bytes, std::memory_order_relaxed);
+        }
+    }
+
+    MemoryTagStats memory_tag_stats(const MemoryTag tag) noexcept
+    {
+        const auto &tag_counter = counters(tag);
+        return MemoryTagStats{.live_bytes = tag_counter.live_bytes.load(std::memory_order_relaxed),
+                              .peak_bytes = tag_counter.peak_bytes.load(std::memory_order_relaxed),
+                              .live_allocations = tag_counter.live_allocations.load(std::memory_order_relaxed),
+                              .total_allocations = tag_counter.total_allocations.load(std::memory_order_relaxed)};
+    }
+
+    const char *memory_tag_name(const MemoryTag tag) noexcept
+    {
+        return tag_info[std::to_underlying(tag)].name;
+    }
+
+    void reset_memory_peaks() noexcept
+    {
+        for (auto &tag_counter : tag_counters)
+        {
+            tag_counter.peak_bytes.store(tag_counter.live_bytes.load(std::memory_order_relaxed),
+                                         std::memory_order_relaxed);
+        }
+    }
+
+    void record_memory_counters() noexcept
+    {
+        if (!is_profiling())
+            return;
+
+        for (const auto [info, tag_counter] : std::views::zip(tag_info, tag_counters))
+        {
+            record_profile_counter(info.counter_name,
+                                   static_cast<double>(tag_counter.live_bytes.load(std::memory_order_relaxed)));
+        }
+    }
+} // namespace retro
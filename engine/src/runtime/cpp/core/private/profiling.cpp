@@ -0,0 +1,444 @@
+/**
+ * @file profiling.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module retro.core.profiling;
+
+import retro.core.memory.memory_tracking;
+import retro.core.util.exceptions;
+
+namespace retro
+{
+    namespace
+    {
+        constexpr std::size_t events_per_block = 2048;
+
+        // Caps a thread at about 20 MB of events per capture, anything past that is dropped
+        constexpr std::size_t max_blocks_per_thread = 256;
+
+        struct EventBlock
+        {
+            std::array<ProfileEvent, events_per_block> events{};
+            std::atomic<std::size_t> count{0};
+            std::atomic<EventBlock *> next{nullptr};
+            std::unique_ptr<EventBlock> owned_next;
+        };
+
+        /**
+         * The events of one thread. Only that thread appends, and it publishes each event by bumping the count of its
+         * block, so a capture can be collected by copying out the published prefix while the thread keeps running.
+         * Blocks are kept between captures and reused.
+         */
+        struct ThreadBuffer
+        {
+            std::uint32_t id = 0;
+            std::string name;
+            EventBlock head;
+            EventBlock *tail = &head;
+            std::size_t block_count = 1;
+
+            // The capture the buffer currently holds events for, the owning thread clears it once a newer one starts
+            std::atomic<std::uint64_t> generation{0};
+            std::atomic<bool> retired{false};
+
+            void append(const ProfileEvent &event) noexcept
+            {
+                auto count = tail->count.load(std::memory_order_relaxed);
+                if (count == events_per_block)
+                {
+                    auto *next = tail->next.load(std::memory_order_relaxed);
+                    if (next == nullptr)
+                    {
+                        if (block_count == max_blocks_per_thread)
+                            return;
+
+                        tail->owned_next.reset(new (std::nothrow) EventBlock);
+                        if (tail->owned_next == nullptr)
+                            return;
+
+                        next = tail->owned_next.get();
+                        ++block_count;
+                        tail->next.store(next, std::memory_order_release);
+                    }
+
+                    tail = next;
+                    count = 0;
+                }
+
+                tail->events[count] = event;
+                tail->count.store(count + 1, std::memory_order_release);
+            }
+
+            void reset(const std::uint64_t new_generation) noexcept
+            {
+                for (auto *block = &head; block != nullptr; block = block->next.load(std::memory_order_relaxed))
+                {
+                    block->count.store(0, std::memory_order_relaxed);
+                }
+
+                tail = &head;
+                generation.store(new_generation, std::memory_order_release);
+            }
+
+            [[nodiscard]] std::vector<ProfileEvent> collect() const
+            {
+                std::vector<ProfileEvent> events;
+                for (auto *block = &head; block != nullptr; block = block->next.load(std::memory_order_acquire))
+                {
+                    const auto count = block->count.load(std::memory_order_acquire);
+                    events.insert(events.end(), block->events.begin(), block->events.begin() + count);
+                    if (count < events_per_block)
+                        break;
+                }
+
+                return events;
+            }
+        };
+
+        struct Profiler
+        {
+            // Guards the list of buffers and thread names, never taken on the recording path once a thread is known
+            std::mutex mutex;
+            std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+            std::uint32_t next_thread_id = 1;
+
+            std::atomic<bool> active{false};
+            std::atomic<std::uint64_t> generation{0};
+            std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+        };
+
+        Profiler &profiler()
+        {
+            static Profiler instance;
+            return instance;
+        }
+
+        constexpr double gpu_average_weight = 0.1;
+
+        struct GpuTimingEntry
+        {
+            // Captures show these as counters, so they get their own name to keep them apart from the CPU zones
+            std::string counter_name;
+            GpuTimingStats stats;
+        };
+
+        struct GpuTimings
+        {
+            std::mutex mutex;
+            std::map<std::string_view, GpuTimingEntry, std::less<>> entries;
+            std::atomic<bool> enabled{false};
+        };
+
+        GpuTimings &gpu_timings()
+        {
+            static GpuTimings instance;
+            return instance;
+        }
+
+        /**
+         * Flags the buffer once its thread exits, so the next capture can free it.
+         */
+        struct ThreadBufferHandle
+        {
+            ThreadBuffer *buffer = nullptr;
+
+            ~ThreadBufferHandle()
+            {
+                if (buffer != nullptr)
+                {
+                    buffer->retired.store(true, std::memory_order_release);
+                    buffer = nullptr;
+                }
+            }
+        };
+
+        thread_local ThreadBufferHandle current_buffer;
+        thread_local std::string current_thread_name;
+
+        ThreadBuffer &thread_buffer()
+        {
+            if (current_buffer.buffer != nullptr)
+                return *current_buffer.buffer;
+
+            auto &state = profiler();
+            std::scoped_lock lock{state.mutex};
+            auto &buffer = state.buffers.emplace_back(std::make_unique<ThreadBuffer>());
+            buffer->id = state.next_thread_id++;
+            buffer->name = current_thread_name.empty() ? std::format("Thread {}", buffer->id) : current_thread_name;
+            current_buffer.buffer = buffer.get();
+            return *buffer;
+        }
+
+        void append_json_number(std::string &out, const double value)
+        {
+            // JSON has no spelling for NaN or infinity, and a single bare one makes the whole trace unreadable
+            if (std::isfinite(value))
+            {
+                std::format_to(std::back_inserter(out), "{}", value);
+            }
+            else
+            {
+                out += "null";
+            }
+        }
+
+        void append_json_string(std::string &out, const std::string_view value)
+        {
+            out.push_back('"');
+            for (const auto c : value)
+            {
+                switch (c)
+                {
+                    case '"':
+                        out += "\\\"";
+                        break;
+                    case '\\':
+                        out += "\\\\";
+                        break;
+                    case '\n':
+                        out += "\\n";
+                        break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20)
+                        {
+                            std::format_to(std::back_inserter(out), "\\u{:04x}", static_cast<unsigned char>(c));
+                        }
+                        else
+                        {
+                            out.push_back(c);
+                        }
+                        break;
+                }
+            }
+            out.push_back('"');
+        }
+
+        double to_microseconds(const std::uint64_t nanoseconds)
+        {
+            return static_cast<double>(nanoseconds) / 1000.0;
+        }
+    } // namespace
+
+    bool is_profiling() noexcept
+    {
+        return profiler().active.load(std::memory_order_relaxed);
+    }
+
+    void begin_profile_capture()
+    {
+        auto &state = profiler();
+        std::scoped_lock lock{state.mutex};
+        std::erase_if(state.buffers,
+                      [](const std::unique_ptr<ThreadBuffer> &buffer)
+                      { return buffer->retired.load(std::memory_order_acquire); });
+
+        state.generation.fetch_add(1, std::memory_order_release);
+        state.active.store(true, std::memory_order_release);
+    }
+
+    ProfileCapture end_profile_capture()
+    {
+        auto &state = profiler();
+        std::scoped_lock lock{state.mutex};
+        state.active.store(false, std::memory_order_release);
+
+        // Threads may still append after this, but only past the counts read here, which keeps the copy consistent
+        const auto generation = state.generation.load(std::memory_order_relaxed);
+        ProfileCapture capture;
+        for (const auto &buffer : state.buffers)
+        {
+            if (buffer->generation.load(std::memory_order_acquire) != generation)
+                continue;
+
+            capture.threads.push_back(
+                ProfileThread{.id = buffer->id, .name = buffer->name, .events = buffer->collect()});
+        }
+
+        return capture;
+    }
+
+    std::uint64_t profile_timestamp() noexcept
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - profiler().epoch;
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    void record_profile_event(const ProfileEvent &event) noexcept
+    {
+        auto &state = profiler();
+        if (!state.active.load(std::memory_order_relaxed))
+            return;
+
+        // Registering a new thread allocates, a thread that cannot be registered simply goes unrecorded
+        ThreadBuffer *buffer;
+        try
+        {
+            buffer = &thread_buffer();
+        }
+        catch (...)
+        {
+            return;
+        }
+
+        if (const auto generation = state.generation.load(std::memory_order_acquire);
+            buffer->generation.load(std::memory_order_relaxed) != generation)
+        {
+            buffer->reset(generation);
+        }
+
+        buffer->append(event);
+    }
+
+    void set_profile_thread_name(const std::string_view name)
+    {
+        current_thread_name = name;
+
+        // Threads that never record anything are never registered, the name is picked up if they ever do
+        if (current_buffer.buffer == nullptr)
+            return;
+
+        std::scoped_lock lock{profiler().mutex};
+        current_buffer.buffer->name = name;
+    }
+
+    void mark_profile_frame(const std::uint64_t frame) noexcept
+    {
+        record_profile_event(ProfileEvent{.name = "Frame",
+                                          .start_ns = profile_timestamp(),
+                                          .value = static_cast<double>(frame),
+                                          .kind = ProfileEventKind::frame});
+
+        // Sampling once a frame keeps the memory graphs readable without touching the allocation paths
+        record_memory_counters();
+    }
+
+    void record_profile_counter(const char *name, const double value) noexcept
+    {
+        record_profile_event(ProfileEvent{.name = name,
+                                          .start_ns = profile_timestamp(),
+                                          .value = value,
+                                          .kind = ProfileEventKind::counter});
+    }
+
+    bool is_gpu_timing_enabled() noexcept
+    {
+        return gpu_timings().enabled.load(std::memory_order_relaxed);
+    }
+
+    void set_gpu_timing_enabled(const bool enabled) noexcept
+    {
+        gpu_timings().enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void record_gpu_timing(const char *name, const double milliseconds)
+    {
+        auto &timings = gpu_timings();
+        std::scoped_lock lock{timings.mutex};
+        auto entry = timings.entries.find(name);
+        if (entry == timings.entries.end())
+        {
+            entry = timings.entries
+                        .emplace(name,
+                                 GpuTimingEntry{.counter_name = std::format("GPU {} (ms)", name),
+                                                .stats = GpuTimingStats{.name = name}})
+                        .first;
+        }
+
+        auto &stats = entry->second.stats;
+        stats.last_ms = milliseconds;
+        stats.average_ms = stats.samples == 0
+                               ? milliseconds
+                               : std::lerp(stats.average_ms, milliseconds, gpu_average_weight);
+        ++stats.samples;
+
+        record_profile_counter(entry->second.counter_name.c_str(), milliseconds);
+    }
+
+    std::vector<GpuTimingStats> gpu_timing_stats()
+    {
+        auto &timings = gpu_timings();
+        std::scoped_lock lock{timings.mutex};
+        return timings.entries | std::views::values |
+               std::views::transform([](const GpuTimingEntry &entry) { return entry.stats; }) |
+               std::ranges::to<std::vector>();
+    }
+
+    void reset_gpu_timing_stats()
+    {
+        auto &timings = gpu_timings();
+        std::scoped_lock lock{timings.mutex};
+        for (auto &entry : timings.entries | std::views::values)
+        {
+            entry.stats = GpuTimingStats{.name = entry.stats.name};
+        }
+    }
+
+    void write_chrome_trace(const ProfileCapture &capture, std::ostream &stream)
+    {
+        std::string out = R"({"displayTimeUnit":"ms","traceEvents":[)";
+        auto first = true;
+        const auto begin_event = [&]
+        {
+            if (!std::exchange(first, false))
+            {
+                out += ",\n";
+            }
+        };
+
+        for (const auto &thread : capture.threads)
+        {
+            begin_event();
+            std::format_to(std::back_inserter(out),
+                           R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":)",
+                           thread.id);
+            append_json_string(out, thread.name);
+            out += "}}";
+
+            for (const auto &event : thread.events)
+            {
+                begin_event();
+                out += R"({"name":)";
+                append_json_string(out, event.name);
+                switch (event.kind)
+                {
+                    case ProfileEventKind::zone:
+                        std::format_to(std::back_inserter(out),
+                                       R"(,"cat":"retro","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+                                       thread.id,
+                                       to_microseconds(event.start_ns),
+                                       to_microseconds(event.duration_ns));
+                        break;
+                    case ProfileEventKind::frame:
+                        std::format_to(std::back_inserter(out),
+                                       R"(,"ph":"i","s":"g","pid":1,"tid":{},"ts":{:.3f},"args":{{"frame":{}}}}})",
+                                       thread.id,
+                                       to_microseconds(event.start_ns),
+                                       static_cast<std::uint64_t>(event.value));
+                        break;
+                    case ProfileEventKind::counter:
+                        std::format_to(std::back_inserter(out),
+                                       R"(,"ph":"C","pid":1,"tid":{},"ts":{:.3f},"args":{{"value":)",
+                                       thread.id,
+                                       to_microseconds(event.start_ns));
+                        append_json_number(out, event.value);
+                        out += "}}";
+                        break;
+                }
+            }
+        }
+
+        out += "]}\n";
+        stream.write(out.data(), static_cast<std::streamsize>(out.size()));
+    }
+
+    void save_chrome_trace(const ProfileCapture &capture, const std::filesystem::path &path)
+    {
+        std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+        if (!stream)
+            throw IoException{std::format("Failed to create trace file {}", path.string())};
+
+        write_chrome_trace(capture, stream);
+    }
+} // namespace retro
@@ -4,14 +4,15 @@
  * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
  * Licensed under the MIT License. See LICENSE file in the project root for full license information.
  */
-module;
-
-#include <cassert>
-
 module retro.core.strings.name;
 
 import std;
 import retro.core.containers.optional;
+import retro.core.containers.hash_index_table;
+import retro.core.strings.string_hashing;
+import retro.core.memory.mapped_file;
+import retro.core.memory.memory_tracking;
+import retro.core.util.exceptions;
 
 namespace retro
 {
@@ -32,95 +33,189 @@ namespace retro
         }
     } // namespace
 
-    struct NameHash
-    {
-        std::size_t hash{};
-        std::uint32_t length{};
-
-        friend bool operator==(NameHash lhs, NameHash rhs) = default;
-        friend std::strong_ordering operator<=>(NameHash lhs, NameHash rhs) = default;
-    };
-} // namespace retro
-
-template <>
-struct std::hash<retro::NameHash>
-{
-    std::size_t operator()(const retro::NameHash &name) const noexcept
-    {
-        return retro::hash_combine(name.hash, name.length);
-    }
-};
-
-namespace retro
-{
     template <NameCase CaseSensitivity>
         requires(CaseSensitivity == NameCase::case_sensitive || CaseSensitivity == NameCase::ignore_case)
     struct NameEntryComparer
     {
-        static NameHash hash(const std::string_view name)
+        static std::size_t hash(const std::string_view name)
+        {
+            return hash_string<to_string_comparison(CaseSensitivity)>(name);
+        }
+
+        static std::strong_ordering compare(const std::string_view a, const std::string_view b)
+        {
+            return retro::compare<to_string_comparison(CaseSensitivity)>(a, b);
+        }
+
+        static bool equals(const std::string_view a, const std::string_view b)
         {
             if constexpr (CaseSensitivity == NameCase::case_sensitive)
             {
-                return NameHash{std::hash<std::string_view>{}(name), static_cast<std::uint32_t>(name.size())};
+                return a == b;
             }
             else
             {
-                InlineArena<name_inline_buffer_size> arena;
-                const auto as_lower = to_lower(name, make_allocator<char>(arena));
-                return NameHash{std::hash<std::string_view>{}(as_lower), static_cast<std::uint32_t>(name.size())};
+                return compare(a, b) == std::strong_ordering::equal;
             }
         }
+    };
 
-        static std::strong_ordering compare(const std::string_view a, const std::string_view b)
+    /**
+     * Append-only storage for the entries, indexed by id. Chunks are never moved or freed, so any id handed out by the
+     * table can be resolved without taking a lock.
+     */
+    class NameEntryArray
+    {
+        static constexpr std::size_t chunk_bits = 16;
+        static constexpr std::size_t chunk_size = std::size_t{1} << chunk_bits;
+        static constexpr std::size_t max_chunks =
+            (static_cast<std::size_t>(std::numeric_limits<std::uint32_t>::max()) + 1) / chunk_size;
+
+        struct Chunk
+        {
+            std::array<std::atomic<const NameEntry *>, chunk_size> entries{};
+        };
+
+      public:
+        NameEntryArray() : chunks_{std::make_unique<std::atomic<Chunk *>[]>(max_chunks)}
         {
-            return retro::compare<to_string_comparison(CaseSensitivity)>(a, b);
         }
+
+        NameEntryArray(const NameEntryArray &) = delete;
+        NameEntryArray(NameEntryArray &&) = delete;
+
+        ~NameEntryArray()
+        {
+            for (std::size_t i = 0; i < max_chunks; ++i)
+            {
+                delete chunks_[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        NameEntryArray &operator=(const NameEntryArray &) = delete;
+        NameEntryArray &operator=(NameEntryArray &&) = delete;
+
+        NameEntryId push(const NameEntry &entry)
+        {
+            const auto index = next_index_.fetch_add(1, std::memory_order_relaxed);
+            if (index >= max_chunks * chunk_size)
+                throw std::length_error{"Name table is full"};
+
+            chunk_for(index).entries[index & (chunk_size - 1)].store(&entry, std::memory_order_release);
+            return NameEntryId{static_cast<std::uint32_t>(index)};
+        }
+
+        /**
+         * Resolves an id, returning null for ids that have not been published yet.
+         */
+        [[nodiscard]] const NameEntry *get(const std::size_t index) const noexcept
+        {
+            if (index >= max_chunks * chunk_size)
+                return nullptr;
+
+            const auto *chunk = chunks_[index >> chunk_bits].load(std::memory_order_acquire);
+            return chunk != nullptr ? chunk->entries[index & (chunk_size - 1)].load(std::memory_order_acquire)
+                                    : nullptr;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return next_index_.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] std::vector<const NameEntry *> snapshot() const
+        {
+            const auto count = next_index_.load(std::memory_order_acquire);
+            std::vector<const NameEntry *> result;
+            result.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (const auto *entry = get(i); entry != nullptr)
+                {
+                    result.push_back(entry);
+                }
+            }
+            return result;
+        }
+
+      private:
+        Chunk &chunk_for(const std::size_t index)
+        {
+            auto &slot = chunks_[index >> chunk_bits];
+            auto *chunk = slot.load(std::memory_order_acquire);
+            if (chunk != nullptr)
+                return *chunk;
+
+            // Whoever crosses into a new chunk first installs it, everyone else uses theirs
+            auto new_chunk = std::make_unique<Chunk>();
+            if (slot.compare_exchange_strong(chunk, new_chunk.get(), std::memory_order_acq_rel))
+            {
+                return *new_chunk.release();
+            }
+
+            return *chunk;
+        }
+
+        std::unique_ptr<std::atomic<Chunk *>[]> chunks_;
+        std::atomic<std::size_t> next_index_{0};
     };
 
+    /**
+     * Maps names onto entry ids. Hashes are only a hint, a hit is always confirmed against the entry's characters so
+     * distinct names that happen to collide still get distinct ids.
+     */
     template <NameCase CaseSensitivity>
     class NameTableSet
     {
       public:
         using Comparer = NameEntryComparer<CaseSensitivity>;
 
-        [[nodiscard]] Optional<NameEntryId> find(std::string_view str)
+        [[nodiscard]] Optional<NameEntryId> find(const std::size_t hash,
+                                                 const std::string_view str,
+                                                 const NameEntryArray &entries) const
         {
-            const NameHash hash = Comparer::hash(str);
-            if (const auto existing = entry_indexes_.find(hash); existing != entry_indexes_.end())
-            {
-                return existing->second;
-            }
-
-            return std::nullopt;
+            return entry_indexes_.find(hash, matching(str, entries));
         }
 
         template <typename Factory>
             requires std::invocable<Factory, std::string_view>
-        NameEntryId find_or_add(std::string_view str, Factory &&factory)
+        NameEntryId find_or_add(const std::size_t hash,
+                                const std::string_view str,
+                                const NameEntryArray &entries,
+                                Factory &&factory)
         {
-            const NameHash hash = Comparer::hash(str);
-            if (const auto existing = entry_indexes_.find(hash); existing != entry_indexes_.end())
-            {
-                return existing->second;
-            }
+            return entry_indexes_.find_or_insert(hash,
+                                                 matching(str, entries),
+                                                 [&] { return std::forward<Factory>(factory)(str); });
+        }
 
-            const auto new_id = std::forward<Factory>(factory)(str);
-            entry_indexes_.emplace(hash, new_id);
-            return new_id;
+        void insert(const std::size_t hash, const NameEntryId id)
+        {
+            entry_indexes_.insert(hash, id);
+        }
+
+        void reserve_additional(const std::size_t count)
+        {
+            entry_indexes_.reserve(entry_indexes_.size() + count);
         }
 
         template <typename Factory>
             requires std::invocable<Factory, std::string_view>
-        NameEntryId add(std::string_view str, Factory &&factory)
+        NameEntryId add(const std::size_t hash, const std::string_view str, Factory &&factory)
         {
-            const NameHash hash = Comparer::hash(str);
             const auto new_id = std::forward<Factory>(factory)(str);
-            entry_indexes_.emplace(hash, new_id);
+            entry_indexes_.insert(hash, new_id);
             return new_id;
         }
 
       private:
-        std::flat_map<NameHash, NameEntryId> entry_indexes_;
+        static auto matching(const std::string_view str, const NameEntryArray &entries)
+        {
+            return [str, &entries](const NameEntryId id)
+            { return Comparer::equals(entries.get(id.value())->name(), str); };
+        }
+
+        HashIndexTable<NameEntryId> entry_indexes_;
     };
 
     class NameAllocator
@@ -139,19 +234,195 @@ namespace retro
             return *ptr;
         }
 
+        [[nodiscard]] ArenaStats stats() const noexcept
+        {
+            return arena_.stats();
+        }
+
       private:
-        static constexpr std::size_t BLOCK_SIZE = 1024 * 64;
+        static constexpr std::size_t BLOCK_SIZE = 1024 * 32;
         static constexpr std::size_t INITIAL_BLOCKS = 16;
         static constexpr std::size_t MAX_BLOCKS = 1024;
 
-        MultiArena arena_{BLOCK_SIZE, INITIAL_BLOCKS, MAX_BLOCKS};
+        MultiArena arena_{BLOCK_SIZE,
+                          INITIAL_BLOCKS,
+                          MAX_BLOCKS,
+                          std::numeric_limits<std::size_t>::max(),
+                          MemoryTag::names};
+    };
+
+    template <NameCase CaseSensitivity>
+    struct NameTableShard
+    {
+        mutable std::shared_mutex mutex;
+        NameTableSet<CaseSensitivity> set;
+    };
+
+    /**
+     * Ids resolved by the calling thread, keyed on the exact spelling. Entries are never removed, so a cached id can
+     * never go stale.
+     */
+    class NameLookupCache
+    {
+        static constexpr std::size_t slot_count = 256;
+
+        struct Slot
+        {
+            std::size_t hash = 0;
+            const NameEntry *entry = nullptr;
+            NameIndices indices{};
+        };
+
+      public:
+        [[nodiscard]] Optional<NameIndices> find(const std::size_t hash, const std::string_view str) const noexcept
+        {
+            const auto &slot = slots_[hash % slot_count];
+            if (slot.entry != nullptr && slot.hash == hash && slot.entry->name() == str)
+                return slot.indices;
+
+            return std::nullopt;
+        }
+
+        void store(const std::size_t hash, const NameEntry &entry, const NameIndices &indices) noexcept
+        {
+            slots_[hash % slot_count] = Slot{.hash = hash, .entry = &entry, .indices = indices};
+        }
+
+      private:
+        std::array<Slot, slot_count> slots_{};
     };
 
+    thread_local NameLookupCache lookup_cache;
+
+    namespace
+    {
+        constexpr std::array snapshot_magic{'R', 'N', 'M', 'T'};
+        constexpr std::uint32_t snapshot_version = 1;
+        constexpr std::uint32_t snapshot_case_preserving = 1;
+        constexpr std::uint32_t snapshot_record_comparison = 1;
+
+#if RETRO_WITH_CASE_PRESERVING_NAME
+        constexpr std::uint32_t snapshot_build_flags = snapshot_case_preserving;
+#else
+        constexpr std::uint32_t snapshot_build_flags = 0;
+#endif
+
+        /**
+         * The snapshot is written in the native layout: a header, one record per entry id, then the entries themselves
+         * laid out exactly like NameEntry so they can be used straight out of the mapped file.
+         */
+        struct NameSnapshotHeader
+        {
+            std::array<char, 4> magic;
+            std::uint32_t version;
+            std::uint32_t flags;
+            std::uint32_t entry_count;
+            std::uint64_t hash_check;
+            std::uint64_t records_offset;
+            std::uint64_t entries_offset;
+            std::uint64_t entries_size;
+        };
+
+        struct NameSnapshotRecord
+        {
+            std::uint64_t entry_offset;
+            std::uint64_t comparison_hash;
+            std::uint64_t exact_hash;
+            std::uint32_t flags;
+            std::uint32_t reserved;
+        };
+
+        static_assert(std::is_trivially_copyable_v<NameSnapshotHeader> &&
+                      std::is_trivially_copyable_v<NameSnapshotRecord>);
+
+        constexpr std::size_t align_offset(const std::size_t offset, const std::size_t alignment) noexcept
+        {
+            return (offset + alignment - 1) & ~(alignment - 1);
+        }
+
+        /**
+         * The stored hashes are only usable if this build hashes names the same way as the one that wrote them.
+         */
+        std::uint64_t snapshot_hash_check()
+        {
+            constexpr std::string_view probe = "Retro Name Snapshot";
+            return hash_string<StringComparison::case_sensitive>(probe) ^
+                   (hash_string<StringComparison::case_insensitive>(probe) << 1);
+        }
+
+        template <typename T>
+        T read_snapshot_value(const std::span<const std::byte> data, const std::size_t offset)
+        {
+            T value;
+            std::memcpy(&value, data.data() + offset, sizeof(T));
+            return value;
+        }
+
+        /**
+         * Holds the names registered before the table was created, so they can go into its first batch.
+         */
+        class StartupNameRegistry
+        {
+          public:
+            static StartupNameRegistry &instance()
+            {
+                static StartupNameRegistry instance;
+                return instance;
+            }
+
+            /**
+             * Returns false once the table exists, the names then have to be interned directly.
+             */
+            bool try_queue(const std::span<const std::string_view> names)
+            {
+                std::scoped_lock lock{mutex_};
+                if (closed_)
+                    return false;
+
+                pending_.insert(pending_.end(), names.begin(), names.end());
+                return true;
+            }
+
+            std::vector<std::string> close()
+            {
+                std::scoped_lock lock{mutex_};
+                closed_ = true;
+                return std::move(pending_);
+            }
+
+          private:
+            std::mutex mutex_;
+            std::vector<std::string> pending_;
+            bool closed_ = false;
+        };
+    } // namespace
+
+    /**
+     * Entries are spread over shards by hash, each with its own lock, and the entries themselves live in an array that
+     * readers index without locking. The ignore-case shards own the entries, a new spelling of an existing name is
+     * allocated by the shard of the name it belongs to. When both are needed the comparison shard is always locked
+     * before the display shard.
+     */
     class NameTable
     {
+        static constexpr std::size_t shard_count = 16;
+
         NameTable()
         {
+            // None is never added through the batch path, every other predefined name follows it in one batch. Nothing
+            // else can reach the table yet, so each one gets its index in the list as its id.
             get_or_add_entry_internal(none_string, FindType::add);
+            const auto predefined = get_or_add_entries(std::span{predefined_names}.subspan(1));
+            for (std::size_t i = 0; i < predefined.size(); ++i)
+            {
+                if (predefined[i].comparison_index != NameEntryId{static_cast<std::uint32_t>(i + 1)})
+                    throw std::logic_error{"Predefined name did not get its reserved id"};
+            }
+
+            // Names registered by games follow right after, so they are interned before anything looks them up
+            const auto registered = StartupNameRegistry::instance().close();
+            const std::vector<std::string_view> registered_views{registered.begin(), registered.end()};
+            get_or_add_entries(registered_views);
         }
 
       public:
@@ -164,20 +435,32 @@ namespace retro
         NameIndices get_or_add_entry(const std::string_view str, const FindType find_type)
         {
 
-            if (retro::compare<StringComparison::case_insensitive>(str, none_string) == std::strong_ordering::equal)
+            if (is_none_string(str))
             {
-                return NameIndices
-                {
-                    .comparison_index = NameEntryId::none(),
-#if RETRO_WITH_CASE_PRESERVING_NAME
-                    .display_index = NameEntryId::none()
-#endif
-                };
+                return none_indices();
             }
 
             return get_or_add_entry_internal(str, find_type);
         }
 
+        /**
+         * Adds a whole batch with every shard locked once, rather than locking per name. The shards are locked in the
+         * same order as single insertions lock them, so this can't deadlock against those.
+         */
+        std::vector<NameIndices> get_or_add_entries(const std::span<const std::string_view> values)
+        {
+            const auto locks = lock_all_shards<std::unique_lock<std::shared_mutex>>();
+
+            std::vector<NameIndices> result;
+            result.reserve(values.size());
+            for (const auto value : values)
+            {
+                result.push_back(is_none_string(value) ? none_indices() : add_locked(value));
+            }
+
+            return result;
+        }
+
         [[nodiscard]] std::string_view get(const NameEntryId id) const
         {
             if (id.is_none())
@@ -185,9 +468,7 @@ namespace retro
                 return none_string;
             }
 
-            std::shared_lock lock{mutex_};
-            auto &entry = *entries_[id.value()];
-            return entry.name();
+            return entries_.get(id.value())->name();
         }
 
         template <NameCase CaseSensitivity>
@@ -206,90 +487,388 @@ namespace retro
 
         [[nodiscard]] bool is_within_bounds(const NameEntryId index) const noexcept
         {
-            std::shared_lock lock{mutex_};
-            return index.value() < entries_.size();
+            return entries_.get(index.value()) != nullptr;
         }
 
-        [[nodiscard]] const std::vector<const NameEntry *> &entries() const noexcept
+        [[nodiscard]] std::vector<const NameEntry *> entries() const
         {
-            return entries_;
+            return entries_.snapshot();
         }
 
-      private:
-        NameIndices get_or_add_entry_internal(std::string_view str, const FindType find_type)
+        void save_snapshot(const std::filesystem::path &path) const
+        {
+            std::vector<NameSnapshotRecord> records;
+            std::vector<std::byte> entry_data;
+            {
+                // Nothing can be added while every shard is held, so every id below the count is published
+                const auto locks = lock_all_shards<std::shared_lock<std::shared_mutex>>();
+                const auto count = entries_.size();
+                records.reserve(count);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const auto name = entries_.get(i)->name();
+                    const auto comparison_hash = NameEntryComparer<NameCase::ignore_case>::hash(name);
+                    const auto owner =
+                        comparison_shards_[shard_of(comparison_hash)].set.find(comparison_hash, name, entries_);
+                    const bool is_comparison = owner.has_value() && owner->value() == i;
+
+                    const auto offset = align_offset(entry_data.size(), alignof(NameEntry));
+                    entry_data.resize(offset + NameEntry::data_offset() + name.size() + 1);
+                    const NameEntryHeader header{.length = name.size()};
+                    std::memcpy(entry_data.data() + offset, &header, sizeof(header));
+                    std::memcpy(entry_data.data() + offset + NameEntry::data_offset(), name.data(), name.size());
+
+                    records.push_back(NameSnapshotRecord{
+                        .entry_offset = offset,
+                        .comparison_hash = comparison_hash,
+                        .exact_hash = NameEntryComparer<NameCase::case_sensitive>::hash(name),
+                        .flags = is_comparison ? snapshot_record_comparison : 0,
+                        .reserved = 0});
+                }
+            }
+
+            const auto records_offset = align_offset(sizeof(NameSnapshotHeader), alignof(NameSnapshotRecord));
+            const auto entries_offset =
+                align_offset(records_offset + records.size() * sizeof(NameSnapshotRecord), alignof(NameEntry));
+            const NameSnapshotHeader header{.magic = snapshot_magic,
+                                            .version = snapshot_version,
+                                            .flags = snapshot_build_flags,
+                                            .entry_count = static_cast<std::uint32_t>(records.size()),
+                                            .hash_check = snapshot_hash_check(),
+                                            .records_offset = records_offset,
+                                            .entries_offset = entries_offset,
+                                            .entries_size = entry_data.size()};
+
+            std::vector<std::byte> file_data(entries_offset + entry_data.size());
+            std::memcpy(file_data.data(), &header, sizeof(header));
+            std::memcpy(file_data.data() + records_offset, records.data(), records.size() * sizeof(NameSnapshotRecord));
+            std::ranges::copy(entry_data, file_data.begin() + static_cast<std::ptrdiff_t>(entries_offset));
+
+            // Entries loaded from a snapshot point into its mapping, so the target is never rewritten in place. The new
+            // file is written next to it and renamed over it, the old mapping keeps the file it was made from alive.
+            auto temp_path = path;
+            temp_path += ".tmp";
+            {
+                std::ofstream file{temp_path, std::ios::binary | std::ios::trunc};
+                file.write(reinterpret_cast<const char *>(file_data.data()),
+                           static_cast<std::streamsize>(file_data.size()));
+                file.close();
+                if (!file)
+                {
+                    std::error_code error;
+                    std::filesystem::remove(temp_path, error);
+                    throw IoException{std::format("Failed to write name table snapshot {}", path.string())};
+                }
+            }
+
+            std::error_code error;
+            std::filesystem::rename(temp_path, path, error);
+            if (error)
+            {
+                std::error_code remove_error;
+                std::filesystem::remove(temp_path, remove_error);
+                throw IoException{
+                    std::format("Failed to replace name table snapshot {}: {}", path.string(), error.message())};
+            }
+        }
+
+        std::size_t load_snapshot(const std::filesystem::path &path)
         {
+            MappedFile file{path};
+            const auto data = file.data();
+            if (data.size() < sizeof(NameSnapshotHeader))
+                throw IoException{std::format("{} is not a name table snapshot", path.string())};
+
+            const auto header = read_snapshot_value<NameSnapshotHeader>(data, 0);
+            if (header.magic != snapshot_magic || header.version != snapshot_version)
+                throw IoException{std::format("{} is not a supported name table snapshot", path.string())};
+
+            if (header.flags != snapshot_build_flags || header.hash_check != snapshot_hash_check())
+                throw IoException{std::format("{} was written by an incompatible build", path.string())};
+
+            const auto records_size = static_cast<std::uint64_t>(header.entry_count) * sizeof(NameSnapshotRecord);
+            if (header.records_offset % alignof(NameSnapshotRecord) != 0 || header.records_offset > data.size() ||
+                records_size > data.size() - header.records_offset ||
+                header.entries_offset % alignof(NameEntry) != 0 || header.entries_offset > data.size() ||
+                header.entries_size > data.size() - header.entries_offset)
+                throw IoException{std::format("{} is truncated or corrupt", path.string())};
 
-            if (find_type == FindType::add)
+            const auto *records =
+                std::launder(reinterpret_cast<const NameSnapshotRecord *>(data.data() + header.records_offset));
+            const auto entry_data = data.subspan(header.entries_offset, header.entries_size);
+            const auto entry_at = [&entry_data](const NameSnapshotRecord &record)
+            { return std::launder(reinterpret_cast<const NameEntry *>(entry_data.data() + record.entry_offset)); };
+
+            // Everything is checked up front, so a bad file leaves the table untouched
+            for (std::uint32_t i = 0; i < header.entry_count; ++i)
             {
-                std::unique_lock lock{mutex_};
-                const auto next_index = static_cast<std::uint32_t>(entries_.size());
-                const auto comparison_index =
-                    comparison_entries_.find_or_add(str, std::bind_front(&NameTable::create_new_entry, this));
+                const auto &record = records[i];
+                if (record.entry_offset % alignof(NameEntry) != 0 ||
+                    record.entry_offset + NameEntry::data_offset() > entry_data.size())
+                    throw IoException{std::format("{} is truncated or corrupt", path.string())};
+
+                const auto length = read_snapshot_value<NameEntryHeader>(entry_data, record.entry_offset).length;
+                const auto characters = record.entry_offset + NameEntry::data_offset();
+                if (length > max_name_length || length >= entry_data.size() - characters ||
+                    entry_data[characters + length] != std::byte{0})
+                    throw IoException{std::format("{} is truncated or corrupt", path.string())};
+            }
+
+            // Ids are only stable if everything already in the table is where the snapshot expects it
+            const auto locks = lock_all_shards<std::unique_lock<std::shared_mutex>>();
+            const auto existing = static_cast<std::uint32_t>(entries_.size());
+            if (existing > header.entry_count)
+                throw InvalidStateException{"The name table has more entries than the snapshot"};
+
+            for (std::uint32_t i = 0; i < existing; ++i)
+            {
+                if (entries_.get(i)->name() != entry_at(records[i])->name())
+                    throw InvalidStateException{"The name table has diverged from the snapshot"};
+            }
+
+            if (existing == header.entry_count)
+                return 0;
+
+            // Moving the mapping doesn't move the pages, everything read from it so far stays valid
+            snapshot_files_.push_back(std::move(file));
+
+            std::array<std::size_t, shard_count> comparison_counts{};
 #if RETRO_WITH_CASE_PRESERVING_NAME
-                if (comparison_index.value() == next_index)
+            std::array<std::size_t, shard_count> display_counts{};
+#endif
+            for (auto i = existing; i < header.entry_count; ++i)
+            {
+                if ((records[i].flags & snapshot_record_comparison) != 0)
                 {
-                    const auto display_index =
-                        display_entries_.add(str, [&comparison_index](std::string_view) { return comparison_index; });
-                    assert(comparison_index == display_index);
-                    return NameIndices{.comparison_index = comparison_index, .display_index = display_index};
+                    ++comparison_counts[shard_of(records[i].comparison_hash)];
                 }
+#if RETRO_WITH_CASE_PRESERVING_NAME
+                ++display_counts[shard_of(records[i].exact_hash)];
+#endif
+            }
 
-                const auto display_index =
-                    display_entries_.find_or_add(str, std::bind_front(&NameTable::create_new_entry, this));
+            for (std::size_t shard = 0; shard < shard_count; ++shard)
+            {
+                comparison_shards_[shard].set.reserve_additional(comparison_counts[shard]);
+#if RETRO_WITH_CASE_PRESERVING_NAME
+                display_shards_[shard].set.reserve_additional(display_counts[shard]);
 #endif
+            }
 
-                return NameIndices
+            for (auto i = existing; i < header.entry_count; ++i)
+            {
+                const auto &record = records[i];
+                const auto id = entries_.push(*entry_at(record));
+                if ((record.flags & snapshot_record_comparison) != 0)
                 {
-                    .comparison_index = comparison_index,
+                    comparison_shards_[shard_of(record.comparison_hash)].set.insert(record.comparison_hash, id);
+                }
 #if RETRO_WITH_CASE_PRESERVING_NAME
-                    .display_index = display_index
+                display_shards_[shard_of(record.exact_hash)].set.insert(record.exact_hash, id);
 #endif
-                };
             }
 
-            std::shared_lock lock{mutex_};
-            return comparison_entries_.find(str)
-                .transform(
-                    [&](NameEntryId comparison_index)
+            return header.entry_count - existing;
+        }
+
+        [[nodiscard]] ArenaStats arena_stats() const noexcept
+        {
+            ArenaStats total{};
+            for (std::size_t i = 0; i < shard_count; ++i)
+            {
+                std::shared_lock lock{comparison_shards_[i].mutex};
+                const auto stats = allocators_[i].stats();
+                total.bytes_used += stats.bytes_used;
+                total.bytes_reserved += stats.bytes_reserved;
+                total.peak_bytes_used += stats.peak_bytes_used;
+                total.blocks_live += stats.blocks_live;
+                total.blocks_retained += stats.blocks_retained;
+                total.oversized_allocations += stats.oversized_allocations;
+                total.resets += stats.resets;
+            }
+            return total;
+        }
+
+      private:
+        /**
+         * Locks every shard, in the same order single insertions take them.
+         */
+        template <typename Lock>
+        [[nodiscard]] std::vector<Lock> lock_all_shards() const
+        {
+            std::vector<Lock> locks;
+            locks.reserve(shard_count * 2);
+            for (auto &shard : comparison_shards_)
+            {
+                locks.emplace_back(shard.mutex);
+            }
+#if RETRO_WITH_CASE_PRESERVING_NAME
+            for (auto &shard : display_shards_)
+            {
+                locks.emplace_back(shard.mutex);
+            }
+#endif
+            return locks;
+        }
+
+        static bool is_none_string(const std::string_view str)
+        {
+            return retro::compare<StringComparison::case_insensitive>(str, none_string) == std::strong_ordering::equal;
+        }
+
+        static constexpr NameIndices none_indices() noexcept
+        {
+            return NameIndices
+            {
+                .comparison_index = NameEntryId::none(),
+#if RETRO_WITH_CASE_PRESERVING_NAME
+                .display_index = NameEntryId::none()
+#endif
+            };
+        }
+
+        static std::size_t shard_of(const std::size_t hash) noexcept
+        {
+            // The low bits pick the slot inside the shard's table, so shard on the high ones
+            return (hash >> (std::numeric_limits<std::size_t>::digits - 4)) % shard_count;
+        }
+
+        NameIndices get_or_add_entry_internal(std::string_view str, const FindType find_type)
+        {
+            const auto exact_hash = NameEntryComparer<NameCase::case_sensitive>::hash(str);
+            if (const auto cached = lookup_cache.find(exact_hash, str); cached.has_value())
+            {
+                return *cached;
+            }
+
+            const auto comparison_hash = NameEntryComparer<NameCase::ignore_case>::hash(str);
+            const auto comparison_shard = shard_of(comparison_hash);
+            auto &comparison = comparison_shards_[comparison_shard];
+#if RETRO_WITH_CASE_PRESERVING_NAME
+            const auto display_hash = exact_hash;
+            auto &display = display_shards_[shard_of(display_hash)];
+#endif
+
+            // Almost every lookup is for a name that already exists, so try that under shared locks first
+            {
+                std::shared_lock lock{comparison.mutex};
+                if (const auto comparison_index = comparison.set.find(comparison_hash, str, entries_);
+                    comparison_index.has_value())
+                {
+#if RETRO_WITH_CASE_PRESERVING_NAME
+                    std::shared_lock display_lock{display.mutex};
+                    if (const auto display_index = display.set.find(display_hash, str, entries_);
+                        display_index.has_value())
                     {
-                        return NameIndices
-                        {
-                            .comparison_index = comparison_index,
+                        return remember(exact_hash,
+                                        NameIndices{.comparison_index = *comparison_index,
+                                                    .display_index = *display_index});
+                    }
+
+                    // Not cached, adding this exact spelling later has to create its display entry
+                    if (find_type == FindType::find)
+                    {
+                        return NameIndices{.comparison_index = *comparison_index,
+                                           .display_index = *comparison_index};
+                    }
+#else
+                    return remember(exact_hash, NameIndices{.comparison_index = *comparison_index});
+#endif
+                }
+                else if (find_type == FindType::find)
+                {
+                    return none_indices();
+                }
+            }
+
+            std::unique_lock lock{comparison.mutex};
+#if RETRO_WITH_CASE_PRESERVING_NAME
+            std::unique_lock display_lock{display.mutex};
+#endif
+            return add_locked(str, exact_hash, comparison_hash);
+        }
+
+        /**
+         * Finds or creates the entries for a name. The caller must hold the unique locks of the shards it hashes to.
+         */
+        NameIndices add_locked(const std::string_view str)
+        {
+            return add_locked(str,
+                              NameEntryComparer<NameCase::case_sensitive>::hash(str),
+                              NameEntryComparer<NameCase::ignore_case>::hash(str));
+        }
+
+        NameIndices add_locked(const std::string_view str,
+                               const std::size_t exact_hash,
+                               const std::size_t comparison_hash)
+        {
+            const auto comparison_shard = shard_of(comparison_hash);
+            auto &comparison = comparison_shards_[comparison_shard];
+            const auto create_entry = [this, comparison_shard](const std::string_view name)
+            { return create_new_entry(allocators_[comparison_shard], name); };
+
+            bool created = false;
+            const auto create_comparison_entry = [&created, &create_entry](const std::string_view name)
+            {
+                created = true;
+                return create_entry(name);
+            };
+            const auto comparison_index =
+                comparison.set.find_or_add(comparison_hash, str, entries_, create_comparison_entry);
 #if RETRO_WITH_CASE_PRESERVING_NAME
-                            .display_index = display_entries_.find(str).value_or(comparison_index)
+            const auto display_hash = exact_hash;
+            auto &display = display_shards_[shard_of(display_hash)];
+            if (created)
+            {
+                const auto display_index = display.set.add(display_hash,
+                                                           str,
+                                                           [&comparison_index](std::string_view)
+                                                           { return comparison_index; });
+                return remember(exact_hash,
+                                NameIndices{.comparison_index = comparison_index, .display_index = display_index});
+            }
+
+            const auto display_index = display.set.find_or_add(display_hash, str, entries_, create_entry);
+            return remember(exact_hash,
+                            NameIndices{.comparison_index = comparison_index, .display_index = display_index});
+#else
+            return remember(exact_hash, NameIndices{.comparison_index = comparison_index});
 #endif
-                        };
-                    })
-                .value_or(NameIndices {
-                    .comparison_index = NameEntryId::none(),
+        }
+
+        NameIndices remember(const std::size_t exact_hash, const NameIndices &indices) const noexcept
+        {
 #if RETRO_WITH_CASE_PRESERVING_NAME
-                    .display_index = NameEntryId::none()
+            const auto entry_id = indices.display_index;
+#else
+            const auto entry_id = indices.comparison_index;
 #endif
-                });
+            lookup_cache.store(exact_hash, *entries_.get(entry_id.value()), indices);
+            return indices;
         }
 
-        NameEntryId create_new_entry(const std::string_view str)
+        NameEntryId create_new_entry(NameAllocator &allocator, const std::string_view str)
         {
             if (str.size() > max_name_length)
                 throw std::length_error{"Name too long"};
 
             const std::size_t byte_size = (str.size() + 1) * sizeof(char);
-            auto &header = allocator_.allocate_with_tail<NameEntryHeader>(byte_size, str.size());
+            auto &header = allocator.allocate_with_tail<NameEntryHeader>(byte_size, str.size());
             auto &entry = *std::launder(reinterpret_cast<NameEntry *>(&header));
-            std::memcpy(entry.characters_, str.data(), byte_size);
+            std::memcpy(entry.characters_, str.data(), str.size() * sizeof(char));
             entry.characters_[str.size()] = '\0';
-            const auto entry_id = NameEntryId{static_cast<std::uint32_t>(entries_.size())};
-            entries_.push_back(&entry);
-            return entry_id;
+            return entries_.push(entry);
         }
 
-        mutable std::shared_mutex mutex_{};
-        NameAllocator allocator_;
-        NameTableSet<NameCase::ignore_case> comparison_entries_;
+        std::array<NameTableShard<NameCase::ignore_case>, shard_count> comparison_shards_;
+        std::array<NameAllocator, shard_count> allocators_;
 #if RETRO_WITH_CASE_PRESERVING_NAME
-        NameTableSet<NameCase::case_sensitive> display_entries_;
+        std::array<NameTableShard<NameCase::case_sensitive>, shard_count> display_shards_;
 #endif
-        std::vector<const NameEntry *> entries_{};
+        NameEntryArray entries_;
+
+        // Entries loaded from snapshots point straight into these mappings
+        std::vector<MappedFile> snapshot_files_;
     };
 
     std::strong_ordering NameEntryId::compare_lexical(const NameEntryId other) const noexcept
@@ -346,16 +925,40 @@ namespace retro
         return NameTable::instance().is_within_bounds(index);
     }
 
-    // NOLINTNEXTLINE
-    Name::LookupResult Name::lookup_name(std::string_view value, const FindType find_type)
+    namespace
     {
-        // If the name is too long, just truncate it
-        if (value.size() > max_name_length)
+        struct SplitName
+        {
+            std::string_view base;
+            std::int32_t number = name_no_number_internal;
+        };
+
+        /**
+         * Truncates overlong names and splits off the number suffix. Empty names have no base at all.
+         */
+        Optional<SplitName> split_name(std::string_view value)
         {
-            value = value.substr(0, max_name_length);
+            // If the name is too long, just truncate it
+            if (value.size() > max_name_length)
+            {
+                value = value.substr(0, max_name_length);
+            }
+
+            if (value.empty())
+            {
+                return std::nullopt;
+            }
+
+            const auto [internal_number, new_length] = parse_number_from_name(value);
+            return SplitName{.base = value.substr(0, new_length), .number = internal_number};
         }
+    } // namespace
 
-        if (value.empty())
+    // NOLINTNEXTLINE
+    Name::LookupResult Name::lookup_name(const std::string_view value, const FindType find_type)
+    {
+        const auto split = split_name(value);
+        if (!split.has_value())
         {
             return LookupResult{.indices =
                                     NameIndices{
@@ -367,15 +970,72 @@ namespace retro
                                 .number = name_no_number_internal};
         }
 
-        auto [internal_number, new_length] = parse_number_from_name(value);
-        const auto new_slice = value.substr(0, new_length);
+        return LookupResult{.indices = NameTable::instance().get_or_add_entry(split->base, find_type),
+                            .number = split->number};
+    }
 
-        return LookupResult{.indices = NameTable::instance().get_or_add_entry(new_slice, find_type),
-                            .number = internal_number};
+    std::vector<Name> Name::intern(const std::span<const std::string_view> values)
+    {
+        std::vector<SplitName> splits;
+        splits.reserve(values.size());
+        std::vector<std::string_view> bases;
+        bases.reserve(values.size());
+        for (const auto value : values)
+        {
+            // Empty names come back as none, the same as looking them up one at a time
+            const auto split = split_name(value).value_or(SplitName{.base = none_string});
+            splits.push_back(split);
+            bases.push_back(split.base);
+        }
+
+        const auto indices = NameTable::instance().get_or_add_entries(bases);
+
+        std::vector<Name> result;
+        result.reserve(values.size());
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            result.push_back(Name{LookupResult{.indices = indices[i], .number = splits[i].number}});
+        }
+
+        return result;
     }
 
-    const std::vector<const NameEntry *> &debug_get_name_entries()
+    std::vector<const NameEntry *> debug_get_name_entries()
     {
         return NameTable::instance().entries();
     }
+
+    void register_startup_names(const std::span<const std::string_view> names)
+    {
+        // The table stores base names, the numbers only live in the Name values
+        std::vector<std::string_view> bases;
+        bases.reserve(names.size());
+        for (const auto name : names)
+        {
+            if (const auto split = split_name(name); split.has_value())
+            {
+                bases.push_back(split->base);
+            }
+        }
+
+        if (!StartupNameRegistry::instance().try_queue(bases))
+        {
+            std::ignore = Name::intern(names);
+        }
+    }
+
+    void save_name_table_snapshot(const std::filesystem::path &path)
+    {
+        NameTable::instance().save_snapshot(path);
+    }
+
+    std::size_t load_name_table_snapshot(const std::filesystem::path &path)
+    {
+        return NameTable::instance().load_snapshot(path);
+    }
+
+    ArenaStats debug_get_name_arena_stats()
+    {
+        return NameTable::instance().arena_stats();
+    }
 } // namespace retro
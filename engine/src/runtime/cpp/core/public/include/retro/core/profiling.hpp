@@ -0,0 +1,25 @@
+/**
+ * @file profiling.hpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#pragma once
+
+#include "retro/core/macros.hpp"
+
+#ifndef RETRO_ENABLE_PROFILING
+#define RETRO_ENABLE_PROFILING 1
+#endif
+
+// The translation unit using these has to import retro.core.profiling. Zone names must be string literals, they are
+// stored as pointers and only read when a capture is exported.
+#if RETRO_ENABLE_PROFILING
+#define RETRO_PROFILE_SCOPE(name) const ::retro::ProfileZone RETRO_CONCAT(retro_profile_zone_, __LINE__){name}
+#define RETRO_PROFILE_FRAME(frame) ::retro::mark_profile_frame(frame)
+#define RETRO_PROFILE_COUNTER(name, value) ::retro::record_profile_counter(name, static_cast<double>(value))
+#else
+#define RETRO_PROFILE_SCOPE(name) static_cast<void>(0)
+#define RETRO_PROFILE_FRAME(frame) static_cast<void>(0)
+#define RETRO_PROFILE_COUNTER(name, value) static_cast<void>(0)
+#endif
@@ -0,0 +1,463 @@
+/**
+ * @file combinators.ixx
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+export module retro.core.async.combinators;
+
+import std;
+import retro.core.async.task;
+import retro.core.async.task_scheduler;
+import retro.core.async.workload;
+import retro.core.async.concepts;
+import retro.core.containers.optional;
+import retro.core.util.exceptions;
+
+namespace retro
+{
+    /**
+     * The per-task result of when_all, void tasks occupy their slot with std::monostate.
+     */
+    export template <typename T>
+    using WhenAllValue = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+    export template <typename T>
+    using WhenAllRangeResult = std::conditional_t<std::is_void_v<T>, void, std::vector<T>>;
+
+    export template <typename T>
+    struct WhenAnyResult
+    {
+        std::size_t index;
+        T value;
+    };
+
+    export template <>
+    struct WhenAnyResult<void>
+    {
+        std::size_t index;
+    };
+
+    template <typename T>
+    struct TaskResultOf
+    {
+    };
+
+    template <typename T>
+    struct TaskResultOf<Task<T>>
+    {
+        using Type = T;
+    };
+
+    export template <typename R>
+    concept TaskRange =
+        std::ranges::input_range<R> && requires { typename TaskResultOf<std::ranges::range_value_t<R>>::Type; };
+
+    template <TaskRange R>
+    using TaskRangeResult = TaskResultOf<std::ranges::range_value_t<R>>::Type;
+
+    /**
+     * Shared state of a fan-in. Every child settles into it and counts down once, the last one to arrive completes the
+     * combined task, so there is no chain of awaits no matter how many children there are.
+     */
+    template <typename Result>
+    class FanInState
+    {
+      public:
+        FanInState(const std::size_t count, std::stop_source stop_source)
+            : remaining_{count}, stop_source_{std::move(stop_source)}
+        {
+        }
+
+        FanInState(const FanInState &) = delete;
+        FanInState(FanInState &&) = delete;
+        ~FanInState() = default;
+        FanInState &operator=(const FanInState &) = delete;
+        FanInState &operator=(FanInState &&) = delete;
+
+        Task<Result> get_task()
+        {
+            return completion_.get_task();
+        }
+
+        void request_stop() noexcept
+        {
+            stop_source_.request_stop();
+        }
+
+        void record_failure(std::exception_ptr exception) noexcept
+        {
+            if (!has_failure_.test_and_set(std::memory_order_relaxed))
+                failure_ = std::move(exception);
+        }
+
+      protected:
+        [[nodiscard]] bool arrive_last() noexcept
+        {
+            return remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+
+        [[nodiscard]] const std::exception_ptr &failure() const noexcept
+        {
+            return failure_;
+        }
+
+        TaskCompletionSource<Result> &completion() noexcept
+        {
+            return completion_;
+        }
+
+      private:
+        std::atomic<std::size_t> remaining_;
+        std::stop_source stop_source_;
+        std::atomic_flag has_failure_;
+        std::exception_ptr failure_;
+        TaskCompletionSource<Result> completion_;
+    };
+
+    template <typename... T>
+    class WhenAllTupleState final : public FanInState<std::tuple<WhenAllValue<T>...>>
+    {
+      public:
+        using FanInState<std::tuple<WhenAllValue<T>...>>::FanInState;
+
+        template <std::size_t I, typename... Args>
+        void succeed(std::integral_constant<std::size_t, I>, Args &&...args)
+        {
+            std::get<I>(values_).emplace(std::forward<Args>(args)...);
+        }
+
+        template <std::size_t I>
+        void fail(std::integral_constant<std::size_t, I>, std::exception_ptr exception) noexcept
+        {
+            this->record_failure(std::move(exception));
+            this->request_stop();
+        }
+
+        void arrive()
+        {
+            if (!this->arrive_last())
+                return;
+
+            if (this->failure() != nullptr)
+            {
+                this->completion().set_exception(this->failure());
+                return;
+            }
+
+            this->completion().set_result(std::apply([](auto &...values)
+                                                     { return std::tuple<WhenAllValue<T>...>{std::move(*values)...}; },
+                                                     values_));
+        }
+
+      private:
+        std::tuple<Optional<WhenAllValue<T>>...> values_;
+    };
+
+    template <typename T>
+    class WhenAllRangeState final : public FanInState<WhenAllRangeResult<T>>
+    {
+      public:
+        WhenAllRangeState(const std::size_t count, std::stop_source stop_source)
+            : FanInState<WhenAllRangeResult<T>>{count, std::move(stop_source)}, values_(count)
+        {
+        }
+
+        template <typename... Args>
+        void succeed(const std::size_t index, Args &&...args)
+        {
+            values_[index].emplace(std::forward<Args>(args)...);
+        }
+
+        void fail(std::size_t, std::exception_ptr exception) noexcept
+        {
+            this->record_failure(std::move(exception));
+            this->request_stop();
+        }
+
+        void arrive()
+        {
+            if (!this->arrive_last())
+                return;
+
+            if (this->failure() != nullptr)
+            {
+                this->completion().set_exception(this->failure());
+            }
+            else if constexpr (std::is_void_v<T>)
+            {
+                this->completion().set_result();
+            }
+            else
+            {
+                auto values = values_ | std::views::transform([](Optional<T> &value) { return std::move(*value); });
+                this->completion().set_result(std::ranges::to<std::vector>(values));
+            }
+        }
+
+      private:
+        std::vector<Optional<WhenAllValue<T>>> values_;
+    };
+
+    template <typename T>
+    class WhenAnyState final : public FanInState<WhenAnyResult<T>>
+    {
+      public:
+        using FanInState<WhenAnyResult<T>>::FanInState;
+
+        template <typename... Args>
+        void succeed(const std::size_t index, Args &&...args)
+        {
+            auto expected = no_winner;
+            if (!winner_.compare_exchange_strong(expected, index, std::memory_order_relaxed))
+                return;
+
+            value_.emplace(std::forward<Args>(args)...);
+
+            // The race is decided, everyone else can stop as soon as they notice
+            this->request_stop();
+        }
+
+        void fail(std::size_t, std::exception_ptr exception) noexcept
+        {
+            this->record_failure(std::move(exception));
+        }
+
+        void arrive()
+        {
+            if (!this->arrive_last())
+                return;
+
+            const auto winner = winner_.load(std::memory_order_relaxed);
+            if (winner == no_winner)
+            {
+                this->completion().set_exception(this->failure());
+            }
+            else if constexpr (std::is_void_v<T>)
+            {
+                this->completion().set_result(WhenAnyResult<T>{winner});
+            }
+            else
+            {
+                this->completion().set_result(WhenAnyResult<T>{winner, std::move(*value_)});
+            }
+        }
+
+      private:
+        static constexpr std::size_t no_winner = std::numeric_limits<std::size_t>::max();
+
+        std::atomic<std::size_t> winner_{no_winner};
+        Optional<WhenAllValue<T>> value_;
+    };
+
+    template <typename State, typename Index, typename T>
+    Task<> settle(std::shared_ptr<State> state, const Index index, Task<T> task)
+    {
+        try
+        {
+            // Where the child finished doesn't matter, the combined task resumes its awaiter on the right context
+            if constexpr (std::is_void_v<T>)
+            {
+                co_await std::move(task).configure_await(false);
+                state->succeed(index);
+            }
+            else
+            {
+                state->succeed(index, co_await std::move(task).configure_await(false));
+            }
+        }
+        catch (...)
+        {
+            state->fail(index, std::current_exception());
+        }
+
+        state->arrive();
+    }
+
+    template <typename State, typename... T>
+    void settle_all(const std::shared_ptr<State> &state, Task<T>... tasks)
+    {
+        [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+            (std::ignore = settle(state, std::integral_constant<std::size_t, I>{}, std::move(tasks)), ...);
+        }(std::index_sequence_for<T...>{});
+    }
+
+    template <TaskRange R>
+    std::vector<Task<TaskRangeResult<R>>> collect_tasks(R &&tasks)
+    {
+        std::vector<Task<TaskRangeResult<R>>> pending;
+        if constexpr (std::ranges::sized_range<R>)
+        {
+            pending.reserve(std::ranges::size(tasks));
+        }
+
+        for (auto &&task : tasks)
+        {
+            pending.push_back(std::move(task));
+        }
+        return pending;
+    }
+
+    template <typename State, typename T>
+    void settle_each(const std::shared_ptr<State> &state, std::vector<Task<T>> &pending)
+    {
+        for (std::size_t i = 0; i < pending.size(); ++i)
+        {
+            std::ignore = settle(state, i, std::move(pending[i]));
+        }
+    }
+
+    /**
+     * Completes once every task has finished, with all of their results in order. The first failure is rethrown
+     * after the rest have settled, and stop is requested on the given source so siblings sharing its token can bail
+     * out early.
+     */
+    export template <typename... T>
+        requires(sizeof...(T) > 0)
+    Task<std::tuple<WhenAllValue<T>...>> when_all(std::stop_source stop_source, Task<T>... tasks)
+    {
+        auto state = std::make_shared<WhenAllTupleState<T...>>(sizeof...(T), std::move(stop_source));
+        auto result = state->get_task();
+        settle_all(state, std::move(tasks)...);
+        return result;
+    }
+
+    export template <typename... T>
+        requires(sizeof...(T) > 0)
+    Task<std::tuple<WhenAllValue<T>...>> when_all(Task<T>... tasks)
+    {
+        return when_all(std::stop_source{std::nostopstate}, std::move(tasks)...);
+    }
+
+    export template <TaskRange R>
+    Task<WhenAllRangeResult<TaskRangeResult<R>>> when_all(R &&tasks,
+                                                          std::stop_source stop_source = std::stop_source{
+                                                              std::nostopstate})
+    {
+        using T = TaskRangeResult<R>;
+        auto pending = collect_tasks(std::forward<R>(tasks));
+        if (pending.empty())
+        {
+            if constexpr (std::is_void_v<T>)
+            {
+                return Task<>::completed();
+            }
+            else
+            {
+                return Task<std::vector<T>>::from_result(std::vector<T>{});
+            }
+        }
+
+        auto state = std::make_shared<WhenAllRangeState<T>>(pending.size(), std::move(stop_source));
+        auto result = state->get_task();
+        settle_each(state, pending);
+        return result;
+    }
+
+    /**
+     * Completes with the index (and value) of the first task to succeed, requesting stop on the given source so the
+     * losers can bail out. The combined task still waits for every task to settle, so nothing outlives the call. If no
+     * task succeeds the first failure is rethrown.
+     */
+    export template <typename T, std::same_as<Task<T>>... Rest>
+    Task<WhenAnyResult<T>> when_any(std::stop_source stop_source, Task<T> first, Rest... rest)
+    {
+        auto state = std::make_shared<WhenAnyState<T>>(sizeof...(Rest) + 1, std::move(stop_source));
+        auto result = state->get_task();
+        std::ignore = settle(state, std::size_t{0}, std::move(first));
+
+        std::size_t index = 0;
+        (std::ignore = settle(state, ++index, std::move(rest)), ...);
+        return result;
+    }
+
+    export template <typename T, std::same_as<Task<T>>... Rest>
+    Task<WhenAnyResult<T>> when_any(Task<T> first, Rest... rest)
+    {
+        return when_any(std::stop_source{std::nostopstate}, std::move(first), std::move(rest)...);
+    }
+
+    export template <TaskRange R>
+    Task<WhenAnyResult<TaskRangeResult<R>>> when_any(R &&tasks,
+                                                     std::stop_source stop_source = std::stop_source{std::nostopstate})
+    {
+        using T = TaskRangeResult<R>;
+        auto pending = collect_tasks(std::forward<R>(tasks));
+        if (pending.empty())
+            throw std::invalid_argument{"when_any requires at least one task"};
+
+        auto state = std::make_shared<WhenAnyState<T>>(pending.size(), std::move(stop_source));
+        auto result = state->get_task();
+        settle_each(state, pending);
+        return result;
+    }
+
+    /**
+     * Invokes the functor on every element of the range across the default scheduler, handing out grain sized batches
+     * of elements at a time. The functor may take a trailing std::stop_token, which is stopped when either the caller's
+     * token is or any invocation throws, so siblings can abandon their batch early. The first exception is rethrown
+     * once every worker has finished.
+     */
+    export template <std::ranges::random_access_range R, typename Functor>
+        requires std::ranges::sized_range<R> && std::ranges::viewable_range<R> &&
+                 InvocableWithOptionalStopToken<Functor &, std::ranges::range_reference_t<R>, std::stop_token>
+    Task<> parallel_for(R &&range, const std::size_t grain, Functor functor, std::stop_token stop_token = {})
+    {
+        throw_if_stop_requested(stop_token);
+
+        auto view = std::views::all(std::forward<R>(range));
+        const auto size = static_cast<std::size_t>(std::ranges::size(view));
+        const auto batch_size = std::max<std::size_t>(grain, 1);
+
+        std::stop_source siblings;
+        std::stop_callback forward_stop{stop_token, [&siblings] { siblings.request_stop(); }};
+        std::atomic_flag has_failure;
+        std::exception_ptr failure;
+
+        const Workload workload{[&](const std::size_t batch, std::size_t)
+                                {
+                                    const auto first = std::ranges::begin(view);
+                                    const auto end = std::min(size, (batch + 1) * batch_size);
+                                    try
+                                    {
+                                        for (auto i = batch * batch_size; i < end; ++i)
+                                        {
+                                            invoke_with_optional_stop_token(
+                                                functor,
+                                                first[static_cast<std::ranges::range_difference_t<decltype(view)>>(i)],
+                                                siblings.get_token());
+                                        }
+                                    }
+                                    catch (...)
+                                    {
+                                        // Record before stopping, so a sibling that notices the stop can't claim to
+                                        // be the original failure
+                                        if (!has_failure.test_and_set(std::memory_order_relaxed))
+                                            failure = std::current_exception();
+                                        siblings.request_stop();
+                                        throw;
+                                    }
+                                    return true;
+                                },
+                                (size + batch_size - 1) / batch_size};
+
+        std::exception_ptr workload_failure;
+        try
+        {
+            const auto thread_count = TaskScheduler::default_scheduler().concurrency();
+            std::ignore =
+                co_await workload.finish_async(static_cast<std::int32_t>(thread_count), siblings.get_token());
+        }
+        catch (...)
+        {
+            workload_failure = std::current_exception();
+        }
+
+        throw_if_stop_requested(stop_token);
+        if (failure != nullptr)
+            std::rethrow_exception(failure);
+        if (workload_failure != nullptr)
+            std::rethrow_exception(workload_failure);
+    }
+} // namespace retro
@@ -0,0 +1,99 @@
+/**
+ * @file coroutine_frame_allocator.ixx
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module;
+
+#include "retro/core/exports.h"
+
+export module retro.core.async.coroutine_frame_allocator;
+
+import std;
+import retro.core.memory.arena_allocator;
+
+namespace retro
+{
+    export enum class CoroutineFrameSource : std::uint8_t
+    {
+        pooled,
+        heap,
+        arena
+    };
+
+    /**
+     * Allocation counters for the frame cache of the calling thread.
+     */
+    export struct CoroutineFrameStats
+    {
+        std::size_t allocations = 0;
+        std::size_t recycled = 0;
+        std::size_t cached = 0;
+    };
+
+    /**
+     * Allocates coroutine frames out of per-thread free lists bucketed into power of two size classes. A frame freed
+     * on a different thread than the one that allocated it simply joins the free list of the freeing thread, so there
+     * is no cross-thread synchronization at all. Frames larger than the biggest size class go straight to the heap.
+     *
+     * Every frame is prefixed by a small header recording where it came from, which lets frames that were carved out
+     * of a caller-supplied arena be released without touching the arena.
+     */
+    export class RETRO_API CoroutineFrameAllocator
+    {
+      public:
+        static constexpr std::size_t header_size = alignof(std::max_align_t);
+        static constexpr std::size_t min_size_class = 256;
+        static constexpr std::size_t size_class_count = 5;
+        static constexpr std::size_t max_size_class = min_size_class << (size_class_count - 1);
+        static constexpr std::size_t max_cached_per_class = 64;
+
+        [[nodiscard]] static void *allocate(std::size_t size);
+
+        /**
+         * Allocates a frame out of the given arena. The arena never sees the matching deallocation, so the frame has to
+         * be destroyed before the arena is reset.
+         */
+        template <Arena A>
+        [[nodiscard]] static void *allocate(const std::size_t size, A &arena)
+        {
+            auto *block = arena.allocate(size + header_size, alignof(std::max_align_t));
+            if (block == nullptr)
+                throw std::bad_alloc{};
+
+            return write_header(block, CoroutineFrameSource::arena);
+        }
+
+        static void deallocate(void *frame, std::size_t size) noexcept;
+
+        [[nodiscard]] static CoroutineFrameSource source(const void *frame) noexcept;
+
+        [[nodiscard]] static CoroutineFrameStats thread_stats() noexcept;
+
+        /**
+         * Returns every frame cached by the calling thread to the heap.
+         */
+        static void trim() noexcept;
+
+        [[nodiscard]] static constexpr std::size_t size_class_of(const std::size_t size) noexcept
+        {
+            const auto block_size = std::bit_ceil(std::max(size + header_size, min_size_class));
+            return static_cast<std::size_t>(std::countr_zero(block_size) - std::countr_zero(min_size_class));
+        }
+
+      private:
+        struct alignas(std::max_align_t) Header
+        {
+            CoroutineFrameSource source;
+        };
+
+        static_assert(sizeof(Header) == header_size);
+
+        static void *write_header(void *block, const CoroutineFrameSource source) noexcept
+        {
+            auto *header = std::construct_at(static_cast<Header *>(block), source);
+            return reinterpret_cast<std::byte *>(header) + header_size;
+        }
+    };
+} // namespace retro
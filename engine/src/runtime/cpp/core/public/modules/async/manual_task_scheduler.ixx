@@ -13,23 +13,31 @@ export module retro.core.async.manual_task_scheduler;
 import retro.core.async.task_scheduler;
 import std;
 import retro.core.functional.delegate;
+import retro.core.containers.mpsc_queue;
 
 namespace retro
 {
+    /**
+     * A scheduler that only runs work when explicitly pumped. Work may be enqueued from any thread without locking,
+     * but pump must only ever be called from one thread at a time.
+     */
     export class RETRO_API ManualTaskScheduler final : public TaskScheduler
     {
       public:
         void enqueue(std::coroutine_handle<> coroutine) override;
         void enqueue(SimpleDelegate delegate, std::stop_token stop_token) override;
 
+        /**
+         * Runs up to max of the work items that were queued when the pump started. Anything queued while pumping waits
+         * for the next pump.
+         */
         std::size_t pump(std::size_t max = std::dynamic_extent);
 
       private:
         using DelegateCallback = std::pair<SimpleDelegate, std::stop_token>;
         using QueuedWork = std::variant<DelegateCallback, std::coroutine_handle<>>;
 
-        std::mutex mutex_;
-        std::deque<QueuedWork> queue_;
+        MpscQueue<QueuedWork> queue_;
         std::deque<QueuedWork> pumping_;
     };
 } // namespace retro
@@ -18,6 +18,8 @@ import retro.core.containers.optional;
 import retro.core.functional.overload;
 import retro.core.util.exceptions;
 import retro.core.async.concepts;
+import retro.core.async.coroutine_frame_allocator;
+import retro.core.memory.arena_allocator;
 
 namespace retro
 {
@@ -33,6 +35,9 @@ namespace retro
         {
             promise.perform_continuation()
         };
+        {
+            promise.release_frame()
+        } -> std::same_as<bool>;
     };
 
     template <PromiseLike Promise>
@@ -47,6 +52,10 @@ namespace retro
         {
             auto &promise = handle.promise();
             promise.perform_continuation();
+            if (promise.release_frame())
+            {
+                handle.destroy();
+            }
             return std::noop_coroutine();
         }
 
@@ -310,6 +319,32 @@ namespace retro
         TaskPromiseBase &operator=(const TaskPromiseBase &) = delete;
         TaskPromiseBase &operator=(TaskPromiseBase &&) noexcept = delete;
 
+        static void *operator new(const std::size_t size)
+        {
+            return CoroutineFrameAllocator::allocate(size);
+        }
+
+        /**
+         * Coroutines that take a leading std::allocator_arg followed by an arena place their frame inside that arena.
+         * The frame must be destroyed before the arena is reset.
+         */
+        template <Arena A, typename... Args>
+        static void *operator new(const std::size_t size, std::allocator_arg_t, A &arena, Args &&...)
+        {
+            return CoroutineFrameAllocator::allocate(size, arena);
+        }
+
+        template <typename Self, Arena A, typename... Args>
+        static void *operator new(const std::size_t size, Self &&, std::allocator_arg_t, A &arena, Args &&...)
+        {
+            return CoroutineFrameAllocator::allocate(size, arena);
+        }
+
+        static void operator delete(void *frame, const std::size_t size) noexcept
+        {
+            CoroutineFrameAllocator::deallocate(frame, size);
+        }
+
         template <typename Self>
         T get_result(this Self &&self)
             requires !std::is_void_v<T>
@@ -389,6 +424,15 @@ namespace retro
             return stop_token_;
         }
 
+        /**
+         * The frame is shared between the running coroutine and the Task that observes it. Returns true when the
+         * caller dropped the last reference and is responsible for destroying the frame.
+         */
+        bool release_frame() noexcept
+        {
+            return frame_references_.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+
       protected:
         TaskCompletion<T> &result() noexcept
         {
@@ -403,6 +447,59 @@ namespace retro
       private:
         TaskCompletion<T> result_{};
         std::stop_token stop_token_;
+        std::atomic<std::uint8_t> frame_references_{2};
+    };
+
+    template <typename Promise>
+    class TaskFrameReference
+    {
+      public:
+        explicit TaskFrameReference(const std::coroutine_handle<Promise> handle) noexcept : handle_{handle}
+        {
+        }
+
+        TaskFrameReference(const TaskFrameReference &) = delete;
+        TaskFrameReference(TaskFrameReference &&other) noexcept : handle_{std::exchange(other.handle_, nullptr)}
+        {
+        }
+
+        ~TaskFrameReference()
+        {
+            reset();
+        }
+
+        TaskFrameReference &operator=(const TaskFrameReference &) = delete;
+        TaskFrameReference &operator=(TaskFrameReference &&other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                handle_ = std::exchange(other.handle_, nullptr);
+            }
+            return *this;
+        }
+
+        [[nodiscard]] bool done() const noexcept
+        {
+            return handle_.done();
+        }
+
+        [[nodiscard]] Promise &promise() const noexcept
+        {
+            return handle_.promise();
+        }
+
+      private:
+        void reset() noexcept
+        {
+            if (handle_ != nullptr && handle_.promise().release_frame())
+            {
+                handle_.destroy();
+            }
+            handle_ = nullptr;
+        }
+
+        std::coroutine_handle<Promise> handle_;
     };
 
     template <typename T>
@@ -491,7 +588,9 @@ namespace retro
     class [[nodiscard("Tasks represent an async unit of work")]] Task
     {
         using Handle = std::coroutine_handle<TaskPromise<T>>;
-        using State = std::variant<std::monostate, Handle, ImmediateState<T>, std::shared_ptr<TaskCompletion<T>>>;
+        using FrameReference = TaskFrameReference<TaskPromise<T>>;
+        using State =
+            std::variant<std::monostate, FrameReference, ImmediateState<T>, std::shared_ptr<TaskCompletion<T>>>;
 
         struct Awaiter
         {
@@ -501,7 +600,7 @@ namespace retro
             bool await_ready() noexcept
             {
                 return std::visit(Overload{[](std::monostate) -> bool { throw InvalidStateException{"Task is empty"}; },
-                                           [](const Handle &handle) -> bool { return handle.done(); },
+                                           [](const FrameReference &frame) -> bool { return frame.done(); },
                                            [](const ImmediateState<T> &) -> bool { return true; },
                                            [](const std::shared_ptr<TaskCompletion<T>> &completion) -> bool
                                            {
@@ -513,12 +612,12 @@ namespace retro
             bool await_suspend(std::coroutine_handle<> handle) noexcept
             {
                 return std::visit(Overload{[](std::monostate) -> bool { throw InvalidStateException{"Task is empty"}; },
-                                           [&handle](const Handle h)
+                                           [&handle](const FrameReference &frame)
                                            {
-                                               if (h.done())
+                                               if (frame.done())
                                                    return false;
 
-                                               return h.promise().try_suspend(handle);
+                                               return frame.promise().try_suspend(handle);
                                            },
                                            [](const ImmediateState<T> &) { return false; },
                                            [&handle](const std::shared_ptr<TaskCompletion<T>> &completion) -> bool
@@ -531,16 +630,16 @@ namespace retro
             T await_resume()
             {
                 return std::visit(Overload{[](std::monostate) -> T { throw InvalidStateException{"Task is empty"}; },
-                                           [](const Handle &handle) -> T
+                                           [](const FrameReference &frame) -> T
                                            {
-                                               assert(handle.done());
+                                               assert(frame.done());
                                                if constexpr (!std::is_void_v<T>)
                                                {
-                                                   return handle.promise().get_result();
+                                                   return frame.promise().get_result();
                                                }
                                                else
                                                {
-                                                   handle.promise().throw_if_exception();
+                                                   frame.promise().throw_if_exception();
                                                    return;
                                                }
                                            },
@@ -561,7 +660,7 @@ namespace retro
         };
 
         explicit Task(Handle coro, std::stop_token stop_token) noexcept
-            : state_(coro), stop_token_(std::move(stop_token))
+            : state_(std::in_place_type<FrameReference>, coro), stop_token_(std::move(stop_token))
         {
         }
 
@@ -622,12 +721,12 @@ namespace retro
         {
             return std::visit(Overload{[](std::monostate) -> T { throw InvalidStateException{"Task is empty"}; },
                                        [](ImmediateState<T> &&state) -> T { return state.get_result(); },
-                                       [](const Handle &handle) -> T
+                                       [](const FrameReference &frame) -> T
                                        {
-                                           if (handle.done())
-                                               return std::move(handle.promise().get_result());
+                                           if (frame.done())
+                                               return std::move(frame.promise().get_result());
 
-                                           auto &promise = handle.promise();
+                                           auto &promise = frame.promise();
                                            return promise.wait_and_get();
                                        },
                                        [](const std::shared_ptr<TaskCompletion<T>> &completion) -> T
@@ -641,9 +740,9 @@ namespace retro
         {
             std::visit(Overload{[](std::monostate) { throw InvalidStateException{"Task is empty"}; },
                                 [](ImmediateState<T> &state) { (void)state.get_result(); },
-                                [](const Handle &handle)
+                                [](const FrameReference &frame)
                                 {
-                                    auto &promise = handle.promise();
+                                    auto &promise = frame.promise();
                                     promise.wait();
                                 },
                                 [](const std::shared_ptr<TaskCompletion<T>> &completion)
@@ -668,9 +767,9 @@ namespace retro
                     {
                         // Do nothing
                     },
-                    [continue_on_captured_context](const Handle &handle)
+                    [continue_on_captured_context](const FrameReference &frame)
                     {
-                        auto &promise = handle.promise();
+                        auto &promise = frame.promise();
                         promise.set_use_captured_context(continue_on_captured_context);
                     },
                     [continue_on_captured_context](const std::shared_ptr<TaskCompletion<T>> &completion)
@@ -16,6 +16,19 @@ import retro.core.containers.optional;
 
 namespace retro
 {
+    /**
+     * The lane a unit of work is queued on. Schedulers always drain higher priority lanes first, and low priority work
+     * is expected to check TaskScheduler::should_yield between steps so that it can be preempted.
+     */
+    export enum class TaskPriority : std::uint8_t
+    {
+        high,
+        normal,
+        low
+    };
+
+    export constexpr std::size_t task_priority_count = 3;
+
     export class RETRO_API TaskScheduler
     {
       public:
@@ -30,6 +43,22 @@ namespace retro
 
         virtual void enqueue(SimpleDelegate delegate, std::stop_token stop_token) = 0;
 
+        /**
+         * Queues a delegate on the given priority lane. Schedulers without lanes simply ignore the priority.
+         */
+        virtual void enqueue(SimpleDelegate delegate, std::stop_token stop_token, TaskPriority priority);
+
+        /**
+         * Whether there is work waiting on a lane of higher priority than the one given. Long-running low priority
+         * work should re-queue itself when this returns true.
+         */
+        [[nodiscard]] virtual bool should_yield(TaskPriority priority) const noexcept;
+
+        /**
+         * The number of work items this scheduler can run at the same time.
+         */
+        [[nodiscard]] virtual std::size_t concurrency() const noexcept;
+
         static void set_current(Optional<TaskScheduler &> scheduler) noexcept;
         static Optional<TaskScheduler &> current() noexcept;
 
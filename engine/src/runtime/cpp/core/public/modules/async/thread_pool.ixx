@@ -11,12 +11,22 @@ module;
 export module retro.core.async.thread_pool;
 
 import std;
+import retro.core.async.task_scheduler;
+import retro.core.containers.work_stealing_deque;
+import retro.core.containers.optional;
 
 namespace retro
 {
+    /**
+     * A work-stealing thread pool. Every worker owns a lock-free deque that work posted from that worker lands on,
+     * while work posted from outside goes through a global injection queue per priority lane. Idle workers steal from
+     * each other, spin briefly and then park until new work arrives.
+     */
     export class RETRO_API ThreadPool
     {
       public:
+        using Job = std::move_only_function<void()>;
+
         explicit ThreadPool(std::size_t thread_count = 1);
 
         ThreadPool(const ThreadPool &) = delete;
@@ -27,21 +37,70 @@ namespace retro
         ThreadPool &operator=(const ThreadPool &) = delete;
         ThreadPool &operator=(ThreadPool &&) = delete;
 
-        void post(std::packaged_task<void()> task, std::stop_token stop_token = std::stop_token{});
+        void post(Job job, std::stop_token stop_token = std::stop_token{}, TaskPriority priority = TaskPriority::normal);
 
         template <std::invocable Functor>
-        void post(Functor &&functor, std::stop_token stop_token = std::stop_token{})
+            requires(!std::same_as<std::remove_cvref_t<Functor>, Job> &&
+                     !std::same_as<std::remove_cvref_t<Functor>, std::coroutine_handle<>>)
+        void post(Functor &&functor,
+                  std::stop_token stop_token = std::stop_token{},
+                  const TaskPriority priority = TaskPriority::normal)
         {
-            post(std::packaged_task<void()>{std::forward<Functor>(functor)}, std::move(stop_token));
+            post(Job{std::forward<Functor>(functor)}, std::move(stop_token), priority);
+        }
+
+        /**
+         * Resumes a coroutine on the pool. This never allocates, and when called from one of the pool's own workers
+         * the coroutine goes straight onto that worker's deque.
+         */
+        void post(std::coroutine_handle<> coroutine, TaskPriority priority = TaskPriority::normal);
+
+        [[nodiscard]] bool has_pending_above(TaskPriority priority) const noexcept;
+
+        [[nodiscard]] inline std::size_t thread_count() const noexcept
+        {
+            return workers_.size();
         }
 
       private:
-        void run() noexcept;
+        struct QueuedJob
+        {
+            Job job;
+            std::stop_token stop_token;
+        };
+
+        // Either a QueuedJob pointer, or a coroutine frame address with the low bit set
+        using WorkItem = std::uintptr_t;
+        static constexpr WorkItem coroutine_tag = 1;
+
+        struct Worker
+        {
+            WorkStealingDeque<WorkItem> deque;
+            std::jthread thread;
+        };
+
+        struct InjectionQueue
+        {
+            std::mutex mutex;
+            std::deque<WorkItem> items;
+            std::atomic<std::size_t> size{0};
+        };
+
+        void push(WorkItem item, TaskPriority priority);
+        void run(std::size_t index) noexcept;
+        Optional<WorkItem> find_work(std::size_t index) noexcept;
+        Optional<WorkItem> take_injected(TaskPriority priority) noexcept;
+        void park() noexcept;
+        void wake_one() noexcept;
+        [[nodiscard]] bool has_pending_work() const noexcept;
+        static void execute(WorkItem item) noexcept;
+        static void discard(WorkItem item) noexcept;
 
         std::atomic_bool is_active_{true};
-        std::vector<std::jthread> threads_;
-        std::condition_variable cv_;
-        std::mutex guard_;
-        std::deque<std::pair<std::packaged_task<void()>, std::stop_token>> pending_jobs_;
+        std::vector<std::unique_ptr<Worker>> workers_;
+        std::array<InjectionQueue, task_priority_count> injection_;
+        std::array<std::atomic<std::size_t>, task_priority_count> pending_counts_{};
+        alignas(cache_line_size) std::atomic<std::uint32_t> wake_epoch_{0};
+        alignas(cache_line_size) std::atomic<std::uint32_t> sleeping_{0};
     };
 } // namespace retro
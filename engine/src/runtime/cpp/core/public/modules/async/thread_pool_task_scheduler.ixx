@@ -29,6 +29,11 @@ namespace retro
 
         void enqueue(std::coroutine_handle<> coroutine) override;
         void enqueue(SimpleDelegate delegate, std::stop_token stop_token) override;
+        void enqueue(SimpleDelegate delegate, std::stop_token stop_token, TaskPriority priority) override;
+
+        [[nodiscard]] bool should_yield(TaskPriority priority) const noexcept override;
+
+        [[nodiscard]] std::size_t concurrency() const noexcept override;
 
       private:
         ThreadPool thread_pool_;
@@ -12,6 +12,7 @@ export module retro.core.async.workload;
 
 import std;
 import retro.core.async.task;
+import retro.core.async.task_scheduler;
 
 namespace retro
 {
@@ -20,8 +21,10 @@ namespace retro
       public:
         Workload() = default;
 
-        inline Workload(std::function<bool(std::size_t, std::size_t)> worker_function, const std::size_t chunks)
-            : worker_function_{std::move(worker_function)}, chunks_{chunks}
+        inline Workload(std::function<bool(std::size_t, std::size_t)> worker_function,
+                        const std::size_t chunks,
+                        const TaskPriority priority = TaskPriority::normal)
+            : worker_function_{std::move(worker_function)}, chunks_{chunks}, priority_{priority}
         {
         }
 
@@ -35,5 +38,6 @@ namespace retro
 
         std::function<bool(std::size_t, std::size_t)> worker_function_;
         std::size_t chunks_{0};
+        TaskPriority priority_{TaskPriority::normal};
     };
 } // namespace retro
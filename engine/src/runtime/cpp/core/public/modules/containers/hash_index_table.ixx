@@ -0,0 +1,131 @@
+/**
+ * @file hash_index_table.ixx
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+export module retro.core.containers.hash_index_table;
+
+import std;
+import retro.core.containers.optional;
+
+namespace retro
+{
+    /**
+     * An open-addressing table from precomputed hashes to small values, typically indices into storage owned by
+     * someone else. The table never assumes that equal hashes mean equal keys, every lookup takes a predicate that
+     * checks the value it found against the actual key. Probing is linear and the full hash is kept in each slot, so
+     * the predicate only runs on genuine hash matches.
+     */
+    export template <std::copyable Value>
+    class HashIndexTable
+    {
+        struct Slot
+        {
+            std::size_t hash = 0;
+            Optional<Value> value;
+        };
+
+      public:
+        static constexpr std::size_t min_capacity = 16;
+
+        HashIndexTable() = default;
+
+        explicit HashIndexTable(const std::size_t expected_size)
+        {
+            reserve(expected_size);
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return slots_.size();
+        }
+
+        template <std::predicate<const Value &> Matches>
+        [[nodiscard]] Optional<Value> find(const std::size_t hash, Matches &&matches) const
+        {
+            if (slots_.empty())
+                return std::nullopt;
+
+            const auto mask = slots_.size() - 1;
+            for (auto index = hash & mask;; index = (index + 1) & mask)
+            {
+                const auto &slot = slots_[index];
+                if (!slot.value.has_value())
+                    return std::nullopt;
+
+                if (slot.hash == hash && std::invoke(matches, *slot.value))
+                    return *slot.value;
+            }
+        }
+
+        /**
+         * Inserts a value that the caller knows isn't in the table yet.
+         */
+        void insert(const std::size_t hash, Value value)
+        {
+            if ((size_ + 1) * 4 > slots_.size() * 3)
+            {
+                rehash(std::max(min_capacity, slots_.size() * 2));
+            }
+
+            place(hash, std::move(value));
+            ++size_;
+        }
+
+        template <std::predicate<const Value &> Matches, std::invocable Factory>
+            requires std::convertible_to<std::invoke_result_t<Factory>, Value>
+        Value find_or_insert(const std::size_t hash, Matches &&matches, Factory &&factory)
+        {
+            if (auto existing = find(hash, std::forward<Matches>(matches)); existing.has_value())
+                return *existing;
+
+            Value value = std::invoke(std::forward<Factory>(factory));
+            insert(hash, value);
+            return value;
+        }
+
+        void reserve(const std::size_t expected_size)
+        {
+            const auto required = std::bit_ceil(std::max(min_capacity, (expected_size * 4 + 2) / 3));
+            if (required > slots_.size())
+            {
+                rehash(required);
+            }
+        }
+
+      private:
+        void place(const std::size_t hash, Value value)
+        {
+            const auto mask = slots_.size() - 1;
+            auto index = hash & mask;
+            while (slots_[index].value.has_value())
+            {
+                index = (index + 1) & mask;
+            }
+
+            slots_[index].hash = hash;
+            slots_[index].value.emplace(std::move(value));
+        }
+
+        void rehash(const std::size_t new_capacity)
+        {
+            auto old_slots = std::exchange(slots_, std::vector<Slot>(new_capacity));
+            for (auto &slot : old_slots)
+            {
+                if (slot.value.has_value())
+                {
+                    place(slot.hash, std::move(*slot.value));
+                }
+            }
+        }
+
+        std::vector<Slot> slots_;
+        std::size_t size_ = 0;
+    };
+} // namespace retro
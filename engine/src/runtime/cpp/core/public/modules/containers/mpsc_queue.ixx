@@ -0,0 +1,199 @@
+/**
+ * @file mpsc_queue.ixx
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+export module retro.core.containers.mpsc_queue;
+
+import std;
+import retro.core.containers.optional;
+import retro.core.containers.work_stealing_deque;
+
+namespace retro
+{
+    /**
+     * An unbounded lock-free multi-producer single-consumer queue. Producers only ever perform a single atomic exchange,
+     * so they never wait on each other or on the consumer. Elements come out in the order their producers linked them
+     * in. A pop can briefly come up empty while a producer is halfway through a push, consumers are expected to simply
+     * try again on their next pass.
+     */
+    export template <std::movable T>
+    class MpscQueue
+    {
+        struct Node
+        {
+            std::atomic<Node *> next{nullptr};
+            Optional<T> value;
+        };
+
+      public:
+        MpscQueue() : head_{new Node}, tail_{head_.load(std::memory_order_relaxed)}
+        {
+        }
+
+        MpscQueue(const MpscQueue &) = delete;
+        MpscQueue(MpscQueue &&) = delete;
+
+        ~MpscQueue()
+        {
+            while (tail_ != nullptr)
+            {
+                delete std::exchange(tail_, tail_->next.load(std::memory_order_relaxed));
+            }
+        }
+
+        MpscQueue &operator=(const MpscQueue &) = delete;
+        MpscQueue &operator=(MpscQueue &&) = delete;
+
+        /**
+         * Pushes an element onto the queue. Safe to call from any thread.
+         */
+        template <typename... Args>
+            requires std::constructible_from<T, Args...>
+        void emplace(Args &&...args)
+        {
+            auto *node = new Node;
+            node->value.emplace(std::forward<Args>(args)...);
+
+            auto *previous = head_.exchange(node, std::memory_order_acq_rel);
+            previous->next.store(node, std::memory_order_release);
+        }
+
+        void push(T value)
+        {
+            emplace(std::move(value));
+        }
+
+        /**
+         * Pops the oldest element. May only be called by the single consumer.
+         */
+        Optional<T> pop()
+        {
+            auto *next = tail_->next.load(std::memory_order_acquire);
+            if (next == nullptr)
+                return std::nullopt;
+
+            // The popped node becomes the new sentinel, so only its value is taken
+            Optional<T> result{std::move(*next->value)};
+            next->value.reset();
+            delete std::exchange(tail_, next);
+            return result;
+        }
+
+        /**
+         * Whether the consumer currently sees no elements. May only be called by the single consumer.
+         */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return tail_->next.load(std::memory_order_acquire) == nullptr;
+        }
+
+      private:
+        alignas(cache_line_size) std::atomic<Node *> head_;
+        alignas(cache_line_size) Node *tail_;
+    };
+
+    /**
+     * A fixed capacity lock-free multi-producer single-consumer queue that never allocates after construction. Every
+     * slot carries a sequence number, producers claim a position with a single compare-and-swap and the consumer only
+     * ever reads the sequence of the slot at its cursor.
+     */
+    export template <std::movable T, std::size_t Capacity>
+        requires(std::has_single_bit(Capacity) && Capacity >= 2)
+    class BoundedMpscQueue
+    {
+        struct Slot
+        {
+            std::atomic<std::size_t> sequence;
+            Optional<T> value;
+        };
+
+      public:
+        BoundedMpscQueue() : slots_{std::make_unique<Slot[]>(Capacity)}
+        {
+            for (std::size_t i = 0; i < Capacity; ++i)
+            {
+                slots_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        BoundedMpscQueue(const BoundedMpscQueue &) = delete;
+        BoundedMpscQueue(BoundedMpscQueue &&) = delete;
+        ~BoundedMpscQueue() = default;
+        BoundedMpscQueue &operator=(const BoundedMpscQueue &) = delete;
+        BoundedMpscQueue &operator=(BoundedMpscQueue &&) = delete;
+
+        [[nodiscard]] static constexpr std::size_t capacity() noexcept
+        {
+            return Capacity;
+        }
+
+        /**
+         * Pushes an element if there is room, returning false when the queue is full. Safe to call from any thread.
+         */
+        template <typename... Args>
+            requires std::constructible_from<T, Args...>
+        bool try_emplace(Args &&...args)
+        {
+            auto position = enqueue_position_.load(std::memory_order_relaxed);
+            Slot *slot;
+            while (true)
+            {
+                slot = &slots_[position & (Capacity - 1)];
+                const auto sequence = slot->sequence.load(std::memory_order_acquire);
+                const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+                if (difference == 0)
+                {
+                    if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (difference < 0)
+                {
+                    // The consumer hasn't freed this slot from the previous lap yet
+                    return false;
+                }
+                else
+                {
+                    position = enqueue_position_.load(std::memory_order_relaxed);
+                }
+            }
+
+            slot->value.emplace(std::forward<Args>(args)...);
+            slot->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool try_push(T value)
+        {
+            return try_emplace(std::move(value));
+        }
+
+        /**
+         * Pops the oldest element. May only be called by the single consumer.
+         */
+        Optional<T> pop()
+        {
+            auto &slot = slots_[dequeue_position_ & (Capacity - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != dequeue_position_ + 1)
+                return std::nullopt;
+
+            Optional<T> result{std::move(*slot.value)};
+            slot.value.reset();
+            slot.sequence.store(dequeue_position_ + Capacity, std::memory_order_release);
+            ++dequeue_position_;
+            return result;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            const auto &slot = slots_[dequeue_position_ & (Capacity - 1)];
+            return slot.sequence.load(std::memory_order_acquire) != dequeue_position_ + 1;
+        }
+
+      private:
+        std::unique_ptr<Slot[]> slots_;
+        alignas(cache_line_size) std::atomic<std::size_t> enqueue_position_{0};
+        alignas(cache_line_size) std::size_t dequeue_position_{0};
+    };
+} // namespace retro
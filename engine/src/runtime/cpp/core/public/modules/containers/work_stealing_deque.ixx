@@ -0,0 +1,169 @@
+/**
+ * @file work_stealing_deque.ixx
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+export module retro.core.containers.work_stealing_deque;
+
+import std;
+import retro.core.containers.optional;
+
+namespace retro
+{
+    export constexpr std::size_t cache_line_size = 64;
+
+    export template <typename T>
+    concept WorkStealingElement = std::is_trivially_copyable_v<T> && std::atomic<T>::is_always_lock_free;
+
+    /**
+     * A Chase-Lev work-stealing deque. The owning thread pushes and pops at the bottom without any locking, while any
+     * other thread may steal from the top. The buffer grows on demand, retired buffers are kept alive until the deque
+     * is destroyed since a concurrent thief may still be reading from them.
+     */
+    export template <WorkStealingElement T>
+    class WorkStealingDeque
+    {
+        class Buffer
+        {
+          public:
+            explicit Buffer(const std::int64_t capacity)
+                : capacity_{capacity}, slots_{std::make_unique<std::atomic<T>[]>(static_cast<std::size_t>(capacity))}
+            {
+            }
+
+            [[nodiscard]] std::int64_t capacity() const noexcept
+            {
+                return capacity_;
+            }
+
+            [[nodiscard]] T load(const std::int64_t index) const noexcept
+            {
+                return slots_[index & (capacity_ - 1)].load(std::memory_order_relaxed);
+            }
+
+            void store(const std::int64_t index, T value) noexcept
+            {
+                slots_[index & (capacity_ - 1)].store(value, std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] std::unique_ptr<Buffer> grow(const std::int64_t bottom, const std::int64_t top) const
+            {
+                auto result = std::make_unique<Buffer>(capacity_ * 2);
+                for (auto i = top; i < bottom; ++i)
+                {
+                    result->store(i, load(i));
+                }
+                return result;
+            }
+
+          private:
+            std::int64_t capacity_;
+            std::unique_ptr<std::atomic<T>[]> slots_;
+        };
+
+      public:
+        explicit WorkStealingDeque(const std::size_t capacity = 256)
+        {
+            const auto initial = std::bit_ceil(std::max<std::size_t>(capacity, 2));
+            auto &buffer = buffers_.emplace_back(std::make_unique<Buffer>(static_cast<std::int64_t>(initial)));
+            buffer_.store(buffer.get(), std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque &) = delete;
+        WorkStealingDeque(WorkStealingDeque &&) = delete;
+        ~WorkStealingDeque() = default;
+        WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+        WorkStealingDeque &operator=(WorkStealingDeque &&) = delete;
+
+        /**
+         * Pushes onto the bottom of the deque. May only be called by the owning thread.
+         */
+        void push(T value)
+        {
+            const auto bottom = bottom_.load(std::memory_order_relaxed);
+            const auto top = top_.load(std::memory_order_acquire);
+            auto *buffer = buffer_.load(std::memory_order_relaxed);
+            if (bottom - top > buffer->capacity() - 1)
+            {
+                buffer = buffers_.emplace_back(buffer->grow(bottom, top)).get();
+                buffer_.store(buffer, std::memory_order_release);
+            }
+
+            buffer->store(bottom, value);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        /**
+         * Pops from the bottom of the deque. May only be called by the owning thread.
+         */
+        Optional<T> pop() noexcept
+        {
+            const auto bottom = bottom_.load(std::memory_order_relaxed) - 1;
+            auto *buffer = buffer_.load(std::memory_order_relaxed);
+            bottom_.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto top = top_.load(std::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                bottom_.store(bottom + 1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+
+            auto value = buffer->load(bottom);
+            if (top == bottom)
+            {
+                // Racing thieves for the last element
+                const bool won =
+                    top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                bottom_.store(bottom + 1, std::memory_order_relaxed);
+                if (!won)
+                    return std::nullopt;
+            }
+
+            return value;
+        }
+
+        /**
+         * Steals from the top of the deque. Safe to call from any thread.
+         */
+        Optional<T> steal() noexcept
+        {
+            auto top = top_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const auto bottom = bottom_.load(std::memory_order_acquire);
+            if (top >= bottom)
+                return std::nullopt;
+
+            const auto *buffer = buffer_.load(std::memory_order_acquire);
+            auto value = buffer->load(top);
+            if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return std::nullopt;
+
+            return value;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        /**
+         * An approximation of the number of elements, only exact when no other thread is touching the deque.
+         */
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            const auto bottom = bottom_.load(std::memory_order_relaxed);
+            const auto top = top_.load(std::memory_order_relaxed);
+            return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+        }
+
+      private:
+        alignas(cache_line_size) std::atomic<std::int64_t> top_{0};
+        alignas(cache_line_size) std::atomic<std::int64_t> bottom_{0};
+        alignas(cache_line_size) std::atomic<Buffer *> buffer_{nullptr};
+        std::vector<std::unique_ptr<Buffer>> buffers_;
+    };
+} // namespace retro
@@ -16,6 +16,7 @@ import retro.core.type_traits.variant;
 import retro.core.containers.optional;
 import retro.core.type_traits.callable;
 import retro.core.type_traits.pointer;
+import retro.core.util.deferred;
 
 namespace retro
 {
@@ -138,6 +139,15 @@ namespace retro
         using WriteGuard = std::unique_lock<Mutex>;
     };
 
+    /**
+     * Only meaningful for MulticastDelegate. Subscribers are published as an immutable array that broadcasts read
+     * without taking any lock, while adding or removing builds a new array under a writer mutex and swaps it in. Use
+     * it for events that fire far more often than their subscriptions change, from more than one thread.
+     */
+    export struct CopyOnWritePolicy
+    {
+    };
+
     template <typename Policy>
     class ThreadPolicyMixin
     {
@@ -1083,6 +1093,273 @@ namespace retro
         mutable std::vector<std::size_t> free_list_{};
     };
 
+    template <typename... Args>
+    class MulticastDelegate<void(Args...), CopyOnWritePolicy>
+    {
+      public:
+        using DelegateType = Delegate<void(Args...)>;
+        using Event = MulticastDelegateRegistration<MulticastDelegate>;
+
+      private:
+        struct Subscriber
+        {
+            DelegateType delegate{};
+            std::uint64_t id{};
+        };
+
+        using SubscriberList = std::vector<Subscriber>;
+
+      public:
+        MulticastDelegate() = default;
+
+        MulticastDelegate(const MulticastDelegate &other)
+        {
+            std::scoped_lock lock{other.write_mutex_};
+            cookie_ = other.cookie_;
+            next_id_ = other.next_id_;
+            if (const auto *subscribers = other.current_.load(); subscribers != nullptr)
+            {
+                current_.store(new SubscriberList(*subscribers));
+            }
+        }
+
+        /**
+         * Moving is only safe while nothing is broadcasting through the delegate being moved from.
+         */
+        MulticastDelegate(MulticastDelegate &&other) noexcept
+        {
+            std::scoped_lock lock{other.write_mutex_};
+            cookie_ = other.cookie_;
+            next_id_ = other.next_id_;
+            current_.store(other.current_.exchange(nullptr));
+        }
+
+        ~MulticastDelegate()
+        {
+            delete current_.load();
+        }
+
+        MulticastDelegate &operator=(const MulticastDelegate &other)
+        {
+            if (this == std::addressof(other))
+                return *this;
+
+            std::unique_ptr<const SubscriberList> copy;
+            {
+                std::scoped_lock other_lock{other.write_mutex_};
+                if (const auto *subscribers = other.current_.load(); subscribers != nullptr)
+                {
+                    copy = std::make_unique<const SubscriberList>(*subscribers);
+                }
+            }
+
+            std::scoped_lock lock{write_mutex_};
+            cookie_ = other.cookie_;
+            next_id_ = other.next_id_;
+            publish(std::move(copy));
+            return *this;
+        }
+
+        MulticastDelegate &operator=(MulticastDelegate &&other) noexcept
+        {
+            if (this == std::addressof(other))
+                return *this;
+
+            std::scoped_lock lock{write_mutex_, other.write_mutex_};
+            cookie_ = other.cookie_;
+            next_id_ = other.next_id_;
+            publish(std::unique_ptr<const SubscriberList>{other.current_.exchange(nullptr)});
+            return *this;
+        }
+
+        DelegateHandle add(DelegateType delegate)
+        {
+            std::scoped_lock lock{write_mutex_};
+            const auto id = next_id_++;
+            update([&](SubscriberList &subscribers)
+                   { subscribers.push_back(Subscriber{.delegate = std::move(delegate), .id = id}); });
+            return DelegateHandle{cookie_, static_cast<std::uint32_t>(id), static_cast<std::uint32_t>(id >> 32)};
+        }
+
+        template <typename Functor, typename... BindArgs>
+            requires std::invocable<const std::remove_reference_t<Functor>, Args..., BindArgs...>
+        DelegateHandle add(Functor &&functor, BindArgs &&...args)
+        {
+            return add(DelegateType::create(std::forward<Functor>(functor), std::forward<BindArgs>(args)...));
+        }
+
+        template <auto Functor, typename... BindArgs>
+            requires std::invocable<decltype(Functor), Args..., BindArgs...>
+        DelegateHandle add(BindArgs &&...args)
+        {
+            return add(DelegateType::template create<Functor>(std::forward<BindArgs>(args)...));
+        }
+
+        template <MemberBindable T, typename Member, typename... BindArgs>
+            requires std::invocable<Member, MemberBindingT<T>, Args..., BindArgs...> && std::is_member_pointer_v<Member>
+        DelegateHandle add(T &&obj, Member member, BindArgs &&...args)
+        {
+            return add(DelegateType::template create<T, Member>(std::forward<T>(obj),
+                                                                member,
+                                                                std::forward<BindArgs>(args)...));
+        }
+
+        template <auto Member, MemberBindable T, typename... BindArgs>
+            requires std::invocable<decltype(Member), MemberBindingT<T>, Args..., BindArgs...> &&
+                     std::is_member_pointer_v<decltype(Member)>
+        DelegateHandle add(T &&obj, BindArgs &&...args)
+        {
+            return add(DelegateType::template create<Member, T>(std::forward<T>(obj), std::forward<BindArgs>(args)...));
+        }
+
+        void remove(const DelegateHandle handle)
+        {
+            if (!handle.is_valid() || handle.owner_cookie() != cookie_)
+                return;
+
+            const auto id = static_cast<std::uint64_t>(handle.generation()) << 32 | handle.index();
+            std::scoped_lock lock{write_mutex_};
+            remove_where([id](const Subscriber &subscriber) { return subscriber.id == id; });
+        }
+
+        void remove(const DelegateType &delegate)
+        {
+            if (!delegate.is_bound())
+                return;
+
+            std::scoped_lock lock{write_mutex_};
+            remove_where([&delegate](const Subscriber &subscriber) { return subscriber.delegate == delegate; });
+        }
+
+        void clear()
+        {
+            std::scoped_lock lock{write_mutex_};
+            publish(nullptr);
+        }
+
+        void operator()(Args... args) const
+        {
+            broadcast(args...);
+        }
+
+        /**
+         * Calls every subscriber in the array that was current when the broadcast started. Subscribers added or
+         * removed while it runs, including by the subscribers themselves, only affect later broadcasts.
+         */
+        void broadcast(Args... args) const
+        {
+            active_broadcasts_.fetch_add(1);
+            Deferred finish{[this] { finish_broadcast(); }};
+
+            const auto *subscribers = current_.load();
+            if (subscribers == nullptr)
+                return;
+
+            for (const auto &subscriber : *subscribers)
+            {
+                if (subscriber.delegate.is_bound())
+                {
+                    subscriber.delegate.execute(args...);
+                }
+            }
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            active_broadcasts_.fetch_add(1);
+            Deferred finish{[this] { finish_broadcast(); }};
+
+            const auto *subscribers = current_.load();
+            return subscribers != nullptr
+                       ? static_cast<std::size_t>(std::ranges::count_if(*subscribers,
+                                                                        [](const Subscriber &subscriber)
+                                                                        { return subscriber.delegate.is_bound(); }))
+                       : 0;
+        }
+
+      private:
+        /**
+         * Publishes a modified copy of the current array. Subscribers whose weak bindings have expired are dropped
+         * along the way. Requires the write mutex.
+         */
+        template <std::invocable<SubscriberList &> Modify>
+        void update(Modify &&modify)
+        {
+            auto next = std::make_unique<SubscriberList>();
+            if (const auto *subscribers = current_.load(); subscribers != nullptr)
+            {
+                next->reserve(subscribers->size() + 1);
+                std::ranges::copy_if(*subscribers,
+                                     std::back_inserter(*next),
+                                     [](const Subscriber &subscriber) { return subscriber.delegate.is_bound(); });
+            }
+
+            std::invoke(std::forward<Modify>(modify), *next);
+            if (next->empty())
+            {
+                // Broadcasting with no subscribers shouldn't have to touch an array at all
+                next.reset();
+            }
+
+            publish(std::move(next));
+        }
+
+        template <std::predicate<const Subscriber &> Predicate>
+        void remove_where(Predicate &&predicate)
+        {
+            const auto *subscribers = current_.load();
+            if (subscribers == nullptr || std::ranges::none_of(*subscribers, predicate))
+                return;
+
+            update([&predicate](SubscriberList &list) { std::erase_if(list, predicate); });
+        }
+
+        void publish(std::unique_ptr<const SubscriberList> next)
+        {
+            if (std::unique_ptr<const SubscriberList> previous{current_.exchange(next.release())}; previous != nullptr)
+            {
+                retired_.push_back(std::move(previous));
+                retired_count_.store(retired_.size(), std::memory_order_relaxed);
+            }
+
+            reclaim_retired();
+        }
+
+        /**
+         * A broadcast registers itself before loading the array and the writer publishes before checking for
+         * broadcasts, both sequentially consistent. So once the count reads zero, every broadcast still to come is
+         * guaranteed to load the current array, and none of the retired ones can be in use. Requires the write mutex.
+         */
+        void reclaim_retired() const
+        {
+            if (retired_.empty() || active_broadcasts_.load() != 0)
+                return;
+
+            retired_.clear();
+            retired_count_.store(0, std::memory_order_relaxed);
+        }
+
+        void finish_broadcast() const
+        {
+            if (active_broadcasts_.fetch_sub(1) != 1 || retired_count_.load(std::memory_order_relaxed) == 0)
+                return;
+
+            // If a writer holds the lock it will check again itself once it has published
+            if (std::unique_lock lock{write_mutex_, std::try_to_lock}; lock.owns_lock())
+            {
+                reclaim_retired();
+            }
+        }
+
+        std::uint64_t cookie_{DelegateHandle::generate_new_cookie()};
+        std::uint64_t next_id_{0};
+        std::atomic<const SubscriberList *> current_{nullptr};
+        mutable std::atomic<std::uint32_t> active_broadcasts_{0};
+        mutable std::mutex write_mutex_;
+        mutable std::vector<std::unique_ptr<const SubscriberList>> retired_;
+        mutable std::atomic<std::size_t> retired_count_{0};
+    };
+
     export using SimpleMulticastDelegate = MulticastDelegate<void()>;
 
     template <typename Delegate, typename... Args>
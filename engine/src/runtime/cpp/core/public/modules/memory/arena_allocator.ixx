@@ -16,6 +16,7 @@ import std;
 import retro.core.util.noncopyable;
 import retro.core.memory.align;
 import retro.core.memory.buffers;
+import retro.core.memory.memory_tracking;
 
 namespace retro
 {
@@ -45,11 +46,33 @@ namespace retro
     template <typename T>
     concept ResetableArena = Arena<T> && requires(T arena) { arena.reset(); };
 
+    /**
+     * A snapshot of how much an arena is holding on to. Byte counts are what callers asked for, so they leave out any
+     * alignment padding.
+     */
+    export struct ArenaStats
+    {
+        std::size_t bytes_used = 0;
+        std::size_t bytes_reserved = 0;
+        std::size_t peak_bytes_used = 0;
+        std::size_t blocks_live = 0;
+        std::size_t blocks_retained = 0;
+        std::size_t oversized_allocations = 0;
+        std::size_t resets = 0;
+    };
+
+    export template <typename T>
+    concept ArenaWithStats = Arena<T> && requires(const T arena) {
+        {
+            arena.stats()
+        } -> std::same_as<ArenaStats>;
+    };
+
     export class SingleArena
     {
       public:
-        explicit constexpr SingleArena(const std::size_t size)
-            : data_(std::make_unique<std::byte[]>(size)), capacity_{size}
+        explicit constexpr SingleArena(const std::size_t size, const MemoryTag tag = MemoryTag::untagged)
+            : data_(make_tagged_bytes(size, tag)), capacity_{size}
         {
         }
 
@@ -76,7 +99,9 @@ namespace retro
 
         constexpr void reset() noexcept
         {
+            peak_offset_ = std::max(peak_offset_, current_offset_);
             current_offset_ = 0;
+            ++resets_;
         }
 
         [[nodiscard]] constexpr std::size_t capacity() const noexcept
@@ -89,6 +114,15 @@ namespace retro
             return current_offset_;
         }
 
+        [[nodiscard]] constexpr ArenaStats stats() const noexcept
+        {
+            return ArenaStats{.bytes_used = current_offset_,
+                              .bytes_reserved = capacity_,
+                              .peak_bytes_used = std::max(peak_offset_, current_offset_),
+                              .blocks_live = 1,
+                              .resets = resets_};
+        }
+
         // NOLINTNEXTLINE
         [[nodiscard]] constexpr bool can_allocate(
             const std::size_t size,
@@ -107,29 +141,45 @@ namespace retro
         }
 
       private:
-        std::unique_ptr<std::byte[]> data_{};
+        TaggedBytes data_{};
         std::size_t capacity_{};
         std::size_t current_offset_{0};
+        std::size_t peak_offset_{0};
+        std::size_t resets_{0};
     };
 
+    /**
+     * A growable arena made of fixed size blocks. Resetting keeps up to max_retained_blocks blocks around for reuse, so
+     * an arena that is reset every frame stops touching the heap once it has seen its busiest frame. Requests that
+     * could never fit in a block get a dedicated allocation of their own, released on the next reset. Every block is
+     * accounted to the arena's memory tag, retained ones included.
+     */
     export class MultiArena : NonCopyable
     {
       public:
         explicit constexpr MultiArena(const std::size_t block_capacity,
                                       const std::size_t initial_blocks = 10,
-                                      const std::size_t max_blocks = std::numeric_limits<std::size_t>::max())
-            : block_capacity_{block_capacity}, max_blocks_{max_blocks}
+                                      const std::size_t max_blocks = std::numeric_limits<std::size_t>::max(),
+                                      const std::size_t max_retained_blocks = std::numeric_limits<std::size_t>::max(),
+                                      const MemoryTag tag = MemoryTag::untagged)
+            : block_capacity_{block_capacity}, max_blocks_{max_blocks}, max_retained_blocks_{max_retained_blocks},
+              tag_{tag}
         {
             assert(block_capacity > alignof(std::max_align_t));
             assert(max_blocks_ > 0);
             assert(initial_blocks <= max_blocks_);
             blocks_.reserve(std::min(initial_blocks, max_blocks_));
-            blocks_.emplace_back(block_capacity);
+            blocks_.emplace_back(block_capacity, tag_);
         }
 
         constexpr void *allocate(const std::size_t size,
                                  const std::size_t alignment = alignof(std::max_align_t)) // NOLINT
         {
+            if (size > block_capacity_ - std::min(alignment, block_capacity_))
+            {
+                return allocate_oversized(size, alignment);
+            }
+
             auto *block = &blocks_.back();
 
             if (!block->can_allocate(size, alignment))
@@ -139,17 +189,30 @@ namespace retro
                     throw std::bad_alloc{};
                 }
 
-                block = &blocks_.emplace_back(block_capacity_);
+                block = &acquire_block();
             }
 
-            return block->allocate(size, alignment);
+            auto *result = block->allocate(size, alignment);
+            record_usage(size);
+            return result;
         }
 
         constexpr void reset() noexcept
         {
             while (blocks_.size() > 1)
+            {
+                if (free_blocks_.size() + 1 < max_retained_blocks_)
+                {
+                    blocks_.back().reset();
+                    free_blocks_.push_back(std::move(blocks_.back()));
+                }
                 blocks_.pop_back();
+            }
             blocks_.back().reset();
+
+            oversized_.clear();
+            bytes_used_ = 0;
+            ++resets_;
         }
 
         [[nodiscard]] constexpr std::size_t capacity() const noexcept
@@ -162,15 +225,64 @@ namespace retro
             const std::size_t alignment = alignof(std::max_align_t)) const noexcept
         {
             if (blocks_.size() < max_blocks_)
-                return size <= block_capacity_;
+                return true;
 
             return blocks_.back().can_allocate(size, alignment);
         }
 
+        [[nodiscard]] constexpr ArenaStats stats() const noexcept
+        {
+            std::size_t oversized_bytes = 0;
+            for (const auto &allocation : oversized_)
+            {
+                oversized_bytes += allocation.capacity();
+            }
+
+            return ArenaStats{.bytes_used = bytes_used_,
+                              .bytes_reserved =
+                                  (blocks_.size() + free_blocks_.size()) * block_capacity_ + oversized_bytes,
+                              .peak_bytes_used = peak_bytes_used_,
+                              .blocks_live = blocks_.size(),
+                              .blocks_retained = free_blocks_.size(),
+                              .oversized_allocations = oversized_.size(),
+                              .resets = resets_};
+        }
+
       private:
+        constexpr SingleArena &acquire_block()
+        {
+            if (free_blocks_.empty())
+                return blocks_.emplace_back(block_capacity_, tag_);
+
+            auto &block = blocks_.emplace_back(std::move(free_blocks_.back()));
+            free_blocks_.pop_back();
+            return block;
+        }
+
+        constexpr void *allocate_oversized(const std::size_t size, const std::size_t alignment)
+        {
+            auto &allocation = oversized_.emplace_back(size + alignment, tag_);
+            auto *result = allocation.allocate(size, alignment);
+            record_usage(size);
+            return result;
+        }
+
+        constexpr void record_usage(const std::size_t size) noexcept
+        {
+            bytes_used_ += size;
+            peak_bytes_used_ = std::max(peak_bytes_used_, bytes_used_);
+        }
+
         std::vector<SingleArena> blocks_{};
+        std::vector<SingleArena> free_blocks_{};
+        std::vector<SingleArena> oversized_{};
         std::size_t block_capacity_{};
         std::size_t max_blocks_{};
+        std::size_t max_retained_blocks_{};
+        MemoryTag tag_{MemoryTag::untagged};
+        std::size_t bytes_used_{0};
+        std::size_t peak_bytes_used_{0};
+        std::size_t resets_{0};
     };
 
     export template <std::size_t N>
@@ -317,6 +429,17 @@ namespace retro
             arena_.reset();
         }
 
+        [[nodiscard]] const T &arena() const noexcept
+        {
+            return arena_;
+        }
+
+        [[nodiscard]] ArenaStats stats() const noexcept
+            requires ArenaWithStats<T>
+        {
+            return arena_.stats();
+        }
+
       protected:
         void *do_allocate(size_t bytes, size_t align) override
         {
@@ -0,0 +1,70 @@
+/**
+ * @file frame_allocator.ixx
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module;
+
+#include "retro/core/exports.h"
+
+export module retro.core.memory.frame_allocator;
+
+import std;
+
+namespace retro
+{
+    /**
+     * Usage counters for the frame allocator of the calling thread.
+     */
+    export struct FrameAllocatorStats
+    {
+        std::uint64_t frame_index = 0;
+        std::size_t bytes_this_frame = 0;
+        std::size_t high_water = 0;
+    };
+
+    /**
+     * Hands out scratch memory that lives until the calling thread begins frames_in_flight more frames. Every thread
+     * that calls begin_frame gets its own ring of arenas, one per frame in flight, so allocating never synchronizes
+     * with another thread and freeing is just rewinding the oldest arena when its slot comes back around.
+     *
+     * Threads that never began a frame are served by the default memory resource instead, which means containers
+     * built on resource() work everywhere, they are just only cheap on the game and render threads.
+     */
+    export class RETRO_API FrameAllocator
+    {
+      public:
+        static constexpr std::size_t frames_in_flight = 3;
+        static constexpr std::size_t block_capacity = 256 * 1024;
+
+        /**
+         * Starts a new frame on the calling thread, reclaiming everything that was allocated frames_in_flight frames
+         * ago.
+         */
+        static void begin_frame();
+
+        [[nodiscard]] static bool in_frame() noexcept;
+
+        /**
+         * Allocates out of the current frame of the calling thread, which must have begun a frame. Requests larger
+         * than a block are still served, but go to the heap until their frame is reclaimed.
+         */
+        [[nodiscard]] static void *allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+        [[nodiscard]] static std::pmr::memory_resource &resource() noexcept;
+
+        template <typename T>
+        [[nodiscard]] static std::pmr::polymorphic_allocator<T> allocator() noexcept
+        {
+            return std::pmr::polymorphic_allocator<T>{&resource()};
+        }
+
+        [[nodiscard]] static FrameAllocatorStats thread_stats() noexcept;
+
+        /**
+         * The most bytes any single thread has used in one frame since the process started.
+         */
+        [[nodiscard]] static std::size_t global_high_water() noexcept;
+    };
+} // namespace retro
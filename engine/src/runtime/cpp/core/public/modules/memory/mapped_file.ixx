@@ -0,0 +1,51 @@
+/**
+ * @file mapped_file.ixx
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module;
+
+#include "retro/core/exports.h"
+
+export module retro.core.memory.mapped_file;
+
+import std;
+
+namespace retro
+{
+    /**
+     * A whole file mapped read-only into memory. The pages are only read in as they are touched, and stay mapped for
+     * as long as the object lives.
+     */
+    export class RETRO_API MappedFile
+    {
+      public:
+        MappedFile() = default;
+        explicit MappedFile(const std::filesystem::path &path);
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile(MappedFile &&other) noexcept;
+
+        ~MappedFile();
+
+        MappedFile &operator=(const MappedFile &) = delete;
+        MappedFile &operator=(MappedFile &&other) noexcept;
+
+        [[nodiscard]] std::span<const std::byte> data() const noexcept
+        {
+            return std::span{data_, size_};
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+      private:
+        void unmap() noexcept;
+
+        const std::byte *data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+} // namespace retro
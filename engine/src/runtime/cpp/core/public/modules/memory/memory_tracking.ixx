@@ -0,0 +1,252 @@
+/**
+ * @file memory_tracking.ixx
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module;
+
+#include "retro/core/exports.h"
+
+export module retro.core.memory.memory_tracking;
+
+import std;
+
+namespace retro
+{
+    /**
+     * The subsystem an allocation is accounted to. Values are part of the managed ABI, new tags may only be appended
+     * before count.
+     */
+    export enum class MemoryTag : std::uint8_t
+    {
+        untagged,
+        names,
+        ecs_pools,
+        scene_nodes,
+        font_atlases,
+        textures,
+        gpu_buffers,
+        frame_arenas,
+        count
+    };
+
+    export constexpr std::size_t memory_tag_count = std::to_underlying(MemoryTag::count);
+
+    export struct MemoryTagStats
+    {
+        std::size_t live_bytes = 0;
+        std::size_t peak_bytes = 0;
+        std::size_t live_allocations = 0;
+        std::uint64_t total_allocations = 0;
+    };
+
+    /**
+     * Accounts bytes to a tag. Both are a couple of relaxed atomic operations, every tag sits on its own cache line so
+     * subsystems do not contend with each other.
+     */
+    export RETRO_API void track_allocation(MemoryTag tag, std::size_t bytes) noexcept;
+
+    export RETRO_API void track_deallocation(MemoryTag tag, std::size_t bytes) noexcept;
+
+    /**
+     * Accounts an allocation that changed size in place. Going from or to zero bytes counts as allocating or freeing
+     * it, anything in between only moves the byte counts.
+     */
+    export RETRO_API void track_resize(MemoryTag tag, std::size_t old_bytes, std::size_t new_bytes) noexcept;
+
+    export RETRO_API MemoryTagStats memory_tag_stats(MemoryTag tag) noexcept;
+
+    export RETRO_API const char *memory_tag_name(MemoryTag tag) noexcept;
+
+    /**
+     * Restarts every tag's peak from its current live byte count.
+     */
+    export RETRO_API void reset_memory_peaks() noexcept;
+
+    /**
+     * Records each tag's live bytes as a counter in the running capture.
+     */
+    export RETRO_API void record_memory_counters() noexcept;
+
+    /**
+     * A standard allocator that accounts everything it hands out to Tag.
+     */
+    export template <typename T, MemoryTag Tag, typename Allocator = std::allocator<T>>
+    class TaggedAllocator
+    {
+      public:
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other =
+                TaggedAllocator<U, Tag, typename std::allocator_traits<Allocator>::template rebind_alloc<U>>;
+        };
+
+        constexpr TaggedAllocator() noexcept = default;
+
+        constexpr explicit TaggedAllocator(Allocator allocator) noexcept : allocator_{std::move(allocator)}
+        {
+        }
+
+        template <typename U, typename OtherAllocator>
+        constexpr explicit(false) TaggedAllocator(const TaggedAllocator<U, Tag, OtherAllocator> &other) noexcept
+            : allocator_{other.allocator_}
+        {
+        }
+
+        T *allocate(const std::size_t count)
+        {
+            auto *result = std::allocator_traits<Allocator>::allocate(allocator_, count);
+            track_allocation(Tag, count * sizeof(T));
+            return result;
+        }
+
+        void deallocate(T *ptr, const std::size_t count) noexcept
+        {
+            track_deallocation(Tag, count * sizeof(T));
+            std::allocator_traits<Allocator>::deallocate(allocator_, ptr, count);
+        }
+
+        template <typename U, typename OtherAllocator>
+        friend bool operator==(const TaggedAllocator &lhs, const TaggedAllocator<U, Tag, OtherAllocator> &rhs) noexcept
+        {
+            return lhs.allocator_ == rhs.allocator_;
+        }
+
+      private:
+        template <typename U, MemoryTag OtherTag, typename OtherAllocator>
+        friend class TaggedAllocator;
+
+        [[no_unique_address]] Allocator allocator_{};
+    };
+
+    /**
+     * Accounts everything allocated through it to a tag before passing the request on to its upstream resource.
+     */
+    export class TaggedMemoryResource final : public std::pmr::memory_resource
+    {
+      public:
+        explicit TaggedMemoryResource(const MemoryTag tag,
+                                      std::pmr::memory_resource *upstream = std::pmr::get_default_resource()) noexcept
+            : tag_{tag}, upstream_{upstream}
+        {
+        }
+
+        [[nodiscard]] MemoryTag tag() const noexcept
+        {
+            return tag_;
+        }
+
+        [[nodiscard]] std::pmr::memory_resource *upstream() const noexcept
+        {
+            return upstream_;
+        }
+
+      protected:
+        void *do_allocate(const std::size_t bytes, const std::size_t alignment) override
+        {
+            auto *result = upstream_->allocate(bytes, alignment);
+            track_allocation(tag_, bytes);
+            return result;
+        }
+
+        void do_deallocate(void *ptr, const std::size_t bytes, const std::size_t alignment) override
+        {
+            track_deallocation(tag_, bytes);
+            upstream_->deallocate(ptr, bytes, alignment);
+        }
+
+        [[nodiscard]] bool do_is_equal(const memory_resource &other) const noexcept override
+        {
+            const auto *tagged = dynamic_cast<const TaggedMemoryResource *>(&other);
+            return tagged != nullptr && tagged->tag_ == tag_ && upstream_->is_equal(*tagged->upstream_);
+        }
+
+      private:
+        MemoryTag tag_;
+        std::pmr::memory_resource *upstream_;
+    };
+
+    export struct TaggedDelete
+    {
+        MemoryTag tag = MemoryTag::untagged;
+        std::size_t size = 0;
+
+        constexpr void operator()(std::byte *data) const noexcept
+        {
+            if !consteval
+            {
+                track_deallocation(tag, size);
+            }
+            delete[] data;
+        }
+    };
+
+    /**
+     * A zeroed byte buffer that stays accounted to its tag for as long as it lives.
+     */
+    export using TaggedBytes = std::unique_ptr<std::byte[], TaggedDelete>;
+
+    export constexpr TaggedBytes make_tagged_bytes(const std::size_t size, const MemoryTag tag)
+    {
+        TaggedBytes bytes{new std::byte[size](), TaggedDelete{.tag = tag, .size = size}};
+        if !consteval
+        {
+            track_allocation(tag, size);
+        }
+        return bytes;
+    }
+
+    /**
+     * Accounts memory that is not allocated through a tagged allocator, like buffers owned by a third party library or
+     * the device, by following its size as it changes.
+     */
+    export class TrackedMemory
+    {
+      public:
+        explicit TrackedMemory(const MemoryTag tag) noexcept : tag_{tag}
+        {
+        }
+
+        TrackedMemory(const TrackedMemory &) = delete;
+
+        TrackedMemory(TrackedMemory &&other) noexcept : tag_{other.tag_}, bytes_{std::exchange(other.bytes_, 0)}
+        {
+        }
+
+        ~TrackedMemory() noexcept
+        {
+            resize(0);
+        }
+
+        TrackedMemory &operator=(const TrackedMemory &) = delete;
+
+        TrackedMemory &operator=(TrackedMemory &&other) noexcept
+        {
+            if (this != &other)
+            {
+                resize(0);
+                tag_ = other.tag_;
+                bytes_ = std::exchange(other.bytes_, 0);
+            }
+            return *this;
+        }
+
+        [[nodiscard]] std::size_t bytes() const noexcept
+        {
+            return bytes_;
+        }
+
+        void resize(const std::size_t bytes) noexcept
+        {
+            track_resize(tag_, std::exchange(bytes_, bytes), bytes);
+        }
+
+      private:
+        MemoryTag tag_;
+        std::size_t bytes_ = 0;
+    };
+} // namespace retro
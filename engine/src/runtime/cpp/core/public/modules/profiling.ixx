@@ -0,0 +1,155 @@
+/**
+ * @file profiling.ixx
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module;
+
+#include "retro/core/exports.h"
+
+export module retro.core.profiling;
+
+import std;
+
+namespace retro
+{
+    export enum class ProfileEventKind : std::uint8_t
+    {
+        zone,
+        frame,
+        counter
+    };
+
+    /**
+     * A single entry of a capture. Zones cover a span of time, frame markers and counters are instantaneous and carry
+     * the frame number or the counter's value instead.
+     */
+    export struct ProfileEvent
+    {
+        const char *name = nullptr;
+        std::uint64_t start_ns = 0;
+        std::uint64_t duration_ns = 0;
+        double value = 0;
+        ProfileEventKind kind = ProfileEventKind::zone;
+    };
+
+    export struct ProfileThread
+    {
+        std::uint32_t id = 0;
+        std::string name;
+        std::vector<ProfileEvent> events;
+    };
+
+    export struct ProfileCapture
+    {
+        std::vector<ProfileThread> threads;
+    };
+
+    /**
+     * Whether a capture is running. Nothing is recorded outside of one, so instrumented code only pays for this check.
+     */
+    export RETRO_API bool is_profiling() noexcept;
+
+    /**
+     * Starts a new capture, discarding whatever the previous one left behind.
+     */
+    export RETRO_API void begin_profile_capture();
+
+    /**
+     * Stops the running capture and collects the events every thread recorded during it.
+     */
+    export RETRO_API ProfileCapture end_profile_capture();
+
+    /**
+     * Nanoseconds since the profiler was first used, the time base of every event.
+     */
+    export RETRO_API std::uint64_t profile_timestamp() noexcept;
+
+    /**
+     * Appends an event to the calling thread's buffer. Each thread only ever writes its own buffer, so this never
+     * takes a lock, apart from the first event a thread records.
+     */
+    export RETRO_API void record_profile_event(const ProfileEvent &event) noexcept;
+
+    /**
+     * Names the calling thread in exported captures.
+     */
+    export RETRO_API void set_profile_thread_name(std::string_view name);
+
+    export RETRO_API void mark_profile_frame(std::uint64_t frame) noexcept;
+
+    export RETRO_API void record_profile_counter(const char *name, double value) noexcept;
+
+    /**
+     * Records the time between its construction and destruction as a zone. Zones nest by time, so the hierarchy falls
+     * out of the scopes they are declared in.
+     */
+    export class ProfileZone
+    {
+      public:
+        explicit ProfileZone(const char *name) noexcept
+            : name_{name}, start_{is_profiling() ? profile_timestamp() : inactive}
+        {
+        }
+
+        ProfileZone(const ProfileZone &) = delete;
+        ProfileZone(ProfileZone &&) = delete;
+
+        ~ProfileZone() noexcept
+        {
+            if (start_ == inactive)
+                return;
+
+            record_profile_event(ProfileEvent{.name = name_,
+                                              .start_ns = start_,
+                                              .duration_ns = profile_timestamp() - start_,
+                                              .kind = ProfileEventKind::zone});
+        }
+
+        ProfileZone &operator=(const ProfileZone &) = delete;
+        ProfileZone &operator=(ProfileZone &&) = delete;
+
+      private:
+        static constexpr std::uint64_t inactive = std::numeric_limits<std::uint64_t>::max();
+
+        const char *name_;
+        std::uint64_t start_;
+    };
+
+    /**
+     * Rolling GPU timings of one named scope, such as a render pipeline. Times are in milliseconds and the average is
+     * an exponential moving one, so it follows changes in the scene within a few dozen frames.
+     */
+    export struct GpuTimingStats
+    {
+        const char *name = nullptr;
+        double last_ms = 0;
+        double average_ms = 0;
+        std::uint64_t samples = 0;
+    };
+
+    /**
+     * Whether the renderer should time its work on the GPU. Off by default, as the queries are not entirely free.
+     */
+    export RETRO_API bool is_gpu_timing_enabled() noexcept;
+
+    export RETRO_API void set_gpu_timing_enabled(bool enabled) noexcept;
+
+    /**
+     * Folds a resolved GPU timing into the stats for its name, and into the running capture as a counter. The name
+     * must be a string literal or otherwise outlive the profiler.
+     */
+    export RETRO_API void record_gpu_timing(const char *name, double milliseconds);
+
+    export RETRO_API std::vector<GpuTimingStats> gpu_timing_stats();
+
+    export RETRO_API void reset_gpu_timing_stats();
+
+    /**
+     * Writes a capture in the Chrome Trace Event format, which chrome://tracing and Perfetto both open.
+     */
+    export RETRO_API void write_chrome_trace(const ProfileCapture &capture, std::ostream &stream);
+
+    export RETRO_API void save_chrome_trace(const ProfileCapture &capture, const std::filesystem::path &path);
+} // namespace retro
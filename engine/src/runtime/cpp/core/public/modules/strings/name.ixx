@@ -187,6 +187,86 @@ namespace retro
 
     export RETRO_API constexpr std::string_view none_string = "None";
 
+    /**
+     * Names that the name table interns before anything else, in this order, so the entry id of each one is its index
+     * in this list. Code compiled against the list bakes those ids in, so new names may only ever be appended.
+     */
+    export inline constexpr auto predefined_names = std::to_array<std::string_view>({
+        none_string,
+        "Default",
+        "Root",
+        "Main",
+        "Game",
+        "Engine",
+        "Editor",
+        "Asset",
+        "Package",
+        "Directory",
+        "Texture",
+        "Font",
+        "Sprite",
+        "Text",
+        "Shader",
+        "Material",
+        "Pipeline",
+        "Scene",
+        "Viewport",
+        "Window",
+        "Camera",
+        "Transform",
+        "Position",
+        "Rotation",
+        "Scale",
+        "Color",
+        "Size",
+        "Pivot",
+        "Input",
+        "Render",
+        "Update",
+    });
+
+    consteval bool predefined_names_are_valid()
+    {
+        constexpr auto to_lower = [](const char c)
+        { return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c; };
+        for (std::size_t i = 0; i < predefined_names.size(); ++i)
+        {
+            // A number suffix would be split off on lookup, leaving a different entry behind
+            if (parse_number_from_name(predefined_names[i]).second != predefined_names[i].size())
+                return false;
+
+            for (std::size_t j = i + 1; j < predefined_names.size(); ++j)
+            {
+                if (std::ranges::equal(predefined_names[i], predefined_names[j], {}, to_lower, to_lower))
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    static_assert(predefined_names_are_valid(), "Predefined names must be unique ignoring case and have no number");
+
+    /**
+     * A string literal usable as a template argument, used to resolve predefined names at compile time.
+     */
+    export template <std::size_t N>
+    struct NameLiteral
+    {
+        // NOLINTNEXTLINE
+        consteval NameLiteral(const char (&str)[N]) // NOSONAR
+        {
+            std::ranges::copy_n(str, N, characters.begin());
+        }
+
+        [[nodiscard]] constexpr std::string_view view() const noexcept
+        {
+            return std::string_view{characters.data(), N - 1};
+        }
+
+        std::array<char, N> characters{};
+    };
+
     struct NameIndices
     {
         NameEntryId comparison_index;
@@ -339,6 +419,12 @@ namespace retro
 
         [[nodiscard]] friend RETRO_API std::strong_ordering operator<=>(const Name &lhs, std::u16string_view rhs);
 
+        /**
+         * Looks up or adds every value in one pass, taking the table's locks once for the whole batch instead of once
+         * per name. The result lines up with the input.
+         */
+        static std::vector<Name> intern(std::span<const std::string_view> values);
+
       private:
         [[nodiscard]] std::string_view get_base_string() const;
 
@@ -373,12 +459,72 @@ namespace retro
 #endif
     };
 
-    export const RETRO_API std::vector<const NameEntry *> &debug_get_name_entries();
+    export RETRO_API std::vector<const NameEntry *> debug_get_name_entries();
+
+    export RETRO_API ArenaStats debug_get_name_arena_stats();
+
+    /**
+     * Adds names to the batch the name table interns right after the predefined names when it is created, so they get
+     * low, stable ids and are never looked up for the first time on a hot path. Once the table exists the names are
+     * interned straight away instead. Numbered names go in under their base name.
+     */
+    export RETRO_API void register_startup_names(std::span<const std::string_view> names);
+
+    /**
+     * Registers a game's constant names from a namespace scope declaration, during static initialization:
+     * @code
+     * const NameRegistrar game_names{"Player", "Enemy", "Pickup"};
+     * @endcode
+     */
+    export class NameRegistrar
+    {
+      public:
+        explicit NameRegistrar(const std::initializer_list<std::string_view> names)
+        {
+            register_startup_names(std::span{names.begin(), names.size()});
+        }
+    };
+
+    /**
+     * Writes every entry in the name table to a flat file, along with the hashes needed to rebuild the indexes without
+     * hashing anything again.
+     */
+    export RETRO_API void save_name_table_snapshot(const std::filesystem::path &path);
+
+    /**
+     * Maps a snapshot written by save_name_table_snapshot and adds every name in it under the id it had when it was
+     * saved. The entries are used straight from the mapping, nothing is copied. The names already in the table have
+     * to match the start of the snapshot, so this is meant to run at startup. Returns the number of names added.
+     */
+    export RETRO_API std::size_t load_name_table_snapshot(const std::filesystem::path &path);
 
     export inline Name operator"" _name(const char *name, const std::size_t length)
     {
         return Name{std::string_view{name, length}};
     }
+
+    /**
+     * Resolves a predefined name, optionally with a number suffix, to its fixed entry id at compile time. Names that
+     * are not in predefined_names, or are spelled with a different case, fail to compile.
+     */
+    export template <NameLiteral Text>
+    consteval Name operator""_cname()
+    {
+        const auto value = Text.view();
+        const auto [number, length] = parse_number_from_name(value);
+        const auto base = value.substr(0, length);
+
+        const auto found = std::ranges::find(predefined_names, base);
+        if (found == predefined_names.end())
+            throw std::invalid_argument{"Not a predefined name"};
+
+        const NameEntryId id{static_cast<std::uint32_t>(std::ranges::distance(predefined_names.begin(), found))};
+#if RETRO_WITH_CASE_PRESERVING_NAME
+        return Name{id, number, id};
+#else
+        return Name{id, number};
+#endif
+    }
 } // namespace retro
 
 export template <>
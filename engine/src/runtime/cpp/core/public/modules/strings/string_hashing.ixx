@@ -0,0 +1,118 @@
+/**
+ * @file string_hashing.ixx
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+export module retro.core.strings.string_hashing;
+
+import std;
+import uni_algo;
+import retro.core.containers.optional;
+import retro.core.memory.arena_allocator;
+import retro.core.strings.encoding;
+
+namespace retro
+{
+    constexpr std::uint64_t swar_ones = 0x0101010101010101;
+    constexpr std::uint64_t swar_high_bits = swar_ones * 0x80;
+    constexpr std::uint64_t word_multiplier = 0xbf58476d1ce4e5b9;
+    constexpr std::uint64_t hash_seed = 0x9e3779b97f4a7c15;
+
+    // Case folding can grow a string up to three times, anything that fits folds on the stack
+    constexpr std::size_t inline_fold_buffer_size = 4096;
+
+    inline std::uint64_t load_word(const char *data, const std::size_t count) noexcept
+    {
+        std::uint64_t word = 0;
+        std::memcpy(&word, data, count);
+        return word;
+    }
+
+    /**
+     * Lower-cases every ASCII letter in the word at once. Every byte has to be ASCII, which keeps the per-byte sums
+     * below from ever carrying into their neighbor.
+     */
+    constexpr std::uint64_t fold_ascii_word(const std::uint64_t word) noexcept
+    {
+        const auto at_least_a = word + swar_ones * (0x80 - 'A');
+        const auto past_z = word + swar_ones * (0x80 - 'Z' - 1);
+        const auto is_upper = at_least_a & ~past_z & swar_high_bits;
+        return word | (is_upper >> 2);
+    }
+
+    constexpr std::uint64_t mix_word(std::uint64_t hash, const std::uint64_t word) noexcept
+    {
+        hash = (hash ^ word) * word_multiplier;
+        return hash ^ (hash >> 31);
+    }
+
+    constexpr std::uint64_t finalize_hash(std::uint64_t hash, const std::size_t length) noexcept
+    {
+        hash ^= length;
+        hash ^= hash >> 30;
+        hash *= 0xbf58476d1ce4e5b9;
+        hash ^= hash >> 27;
+        hash *= 0x94d049bb133111eb;
+        return hash ^ (hash >> 31);
+    }
+
+    /**
+     * Hashes eight bytes per step. When folding, gives up as soon as it meets a byte outside of ASCII.
+     */
+    template <bool FoldAscii>
+    Optional<std::uint64_t> hash_words(const std::string_view str) noexcept
+    {
+        std::uint64_t hash = hash_seed;
+        const auto *data = str.data();
+        auto remaining = str.size();
+
+        while (remaining > 0)
+        {
+            const auto count = std::min<std::size_t>(remaining, sizeof(std::uint64_t));
+            auto word = load_word(data, count);
+            if constexpr (FoldAscii)
+            {
+                if ((word & swar_high_bits) != 0)
+                    return std::nullopt;
+
+                word = fold_ascii_word(word);
+            }
+
+            hash = mix_word(hash, word);
+            data += count;
+            remaining -= count;
+        }
+
+        return finalize_hash(hash, str.size());
+    }
+
+    /**
+     * Hashes a UTF-8 string. The case-insensitive variant never copies ASCII input. Anything else is fully case
+     * folded first, and because folded text hashes exactly like its ASCII-folded spelling, every pair of strings that
+     * compare equal ignoring case also hash equal.
+     */
+    export template <StringComparison Comparison = StringComparison::case_sensitive>
+    std::size_t hash_string(const std::string_view str)
+    {
+        if constexpr (Comparison == StringComparison::case_sensitive)
+        {
+            return static_cast<std::size_t>(*hash_words<false>(str));
+        }
+        else
+        {
+            if (const auto hash = hash_words<true>(str); hash.has_value())
+                return static_cast<std::size_t>(*hash);
+
+            if (str.size() * 3 <= inline_fold_buffer_size)
+            {
+                InlineArena<inline_fold_buffer_size> arena;
+                const auto folded = una::cases::to_casefold_utf8(str, make_allocator<char>(arena));
+                return static_cast<std::size_t>(*hash_words<false>(folded));
+            }
+
+            const auto folded = una::cases::to_casefold_utf8(str);
+            return static_cast<std::size_t>(*hash_words<false>(folded));
+        }
+    }
+} // namespace retro
@@ -0,0 +1,143 @@
+/**
+ * @file test_combinators.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import retro.core.async.combinators;
+import retro.core.async.task;
+import retro.core.async.task_actions;
+import retro.core.util.exceptions;
+import std;
+
+using namespace retro;
+
+namespace
+{
+    // Spins until a sibling requests stop, so the test only finishes if cancellation actually propagates
+    Task<int> wait_for_stop(std::stop_token stop_token)
+    {
+        return run_async(
+            [](const std::stop_token &token) -> int
+            {
+                while (!token.stop_requested())
+                {
+                    std::this_thread::yield();
+                }
+                throw OperationCancelledException{token};
+            },
+            std::move(stop_token));
+    }
+} // namespace
+
+TEST(WhenAll, CollectsResultsInArgumentOrder)
+{
+    auto [number, text, nothing] = when_all(run_async([] { return 1; }),
+                                            run_async([] { return std::string{"two"}; }),
+                                            run_async([] {}))
+                                       .get();
+
+    EXPECT_EQ(number, 1);
+    EXPECT_EQ(text, "two");
+    EXPECT_EQ(nothing, std::monostate{});
+}
+
+TEST(WhenAll, CollectsRangeResultsInOrder)
+{
+    std::vector<Task<int>> tasks;
+    for (int i = 0; i < 32; ++i)
+    {
+        tasks.push_back(run_async([i] { return i * 2; }));
+    }
+
+    const auto results = when_all(std::move(tasks)).get();
+    ASSERT_EQ(results.size(), 32);
+    for (int i = 0; i < 32; ++i)
+    {
+        EXPECT_EQ(results[i], i * 2);
+    }
+}
+
+TEST(WhenAll, EmptyRangeCompletesImmediately)
+{
+    EXPECT_TRUE(when_all(std::vector<Task<int>>{}).get().empty());
+}
+
+TEST(WhenAll, FirstFailureCancelsSiblings)
+{
+    std::stop_source stop_source;
+    auto failing = run_async([]() -> int { throw std::runtime_error{"boom"}; });
+
+    EXPECT_THROW(std::ignore = when_all(stop_source, wait_for_stop(stop_source.get_token()), std::move(failing)).get(),
+                 std::runtime_error);
+    EXPECT_TRUE(stop_source.stop_requested());
+}
+
+TEST(WhenAny, ReturnsFirstSuccessAndCancelsTheRest)
+{
+    std::stop_source stop_source;
+    const auto result =
+        when_any(stop_source, wait_for_stop(stop_source.get_token()), run_async([] { return 7; })).get();
+
+    EXPECT_EQ(result.index, 1);
+    EXPECT_EQ(result.value, 7);
+    EXPECT_TRUE(stop_source.stop_requested());
+}
+
+TEST(WhenAny, RethrowsWhenNothingSucceeds)
+{
+    std::vector<Task<>> tasks;
+    tasks.push_back(run_async([] { throw std::runtime_error{"first"}; }));
+    tasks.push_back(run_async([] { throw std::runtime_error{"second"}; }));
+
+    EXPECT_THROW(std::ignore = when_any(std::move(tasks)).get(), std::runtime_error);
+}
+
+TEST(ParallelFor, VisitsEveryElementExactlyOnce)
+{
+    std::vector<std::atomic<std::int32_t>> visits(1000);
+
+    parallel_for(visits, 16, [](std::atomic<std::int32_t> &count) { count.fetch_add(1); }).wait();
+
+    for (const auto &count : visits)
+    {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+TEST(ParallelFor, FailureStopsSiblingsAndIsRethrown)
+{
+    std::vector<int> values(4096);
+    std::iota(values.begin(), values.end(), 0);
+    std::atomic<std::int32_t> visited{0};
+
+    auto task = parallel_for(values,
+                             1,
+                             [&visited](const int value, const std::stop_token &stop_token)
+                             {
+                                 throw_if_stop_requested(stop_token);
+                                 if (value == 3)
+                                     throw std::runtime_error{"boom"};
+
+                                 visited.fetch_add(1);
+                             });
+
+    EXPECT_THROW(std::move(task).wait(), std::runtime_error);
+    EXPECT_LT(visited.load(), static_cast<std::int32_t>(values.size()));
+}
+
+TEST(ParallelFor, CallerStopCancelsTheLoop)
+{
+    std::stop_source stop_source;
+    std::vector<int> values(64);
+
+    auto task = parallel_for(
+        values,
+        1,
+        [&stop_source](int) { stop_source.request_stop(); },
+        stop_source.get_token());
+
+    EXPECT_THROW(std::move(task).wait(), OperationCancelledException);
+}
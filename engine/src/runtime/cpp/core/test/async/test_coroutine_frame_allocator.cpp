@@ -0,0 +1,128 @@
+/**
+ * @file test_coroutine_frame_allocator.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import retro.core.async.coroutine_frame_allocator;
+import retro.core.async.manual_task_scheduler;
+import retro.core.async.task_scheduler;
+import retro.core.async.task;
+import retro.core.memory.arena_allocator;
+import std;
+
+using namespace retro;
+
+namespace
+{
+    Task<int> immediate_value(const int value)
+    {
+        co_return value;
+    }
+
+    Task<int> arena_value(std::allocator_arg_t, SingleArena &, const int value)
+    {
+        co_return value;
+    }
+
+    struct Yield
+    {
+        static bool await_ready() noexcept
+        {
+            return false;
+        }
+
+        static void await_suspend(const std::coroutine_handle<> handle)
+        {
+            TaskScheduler::current()->enqueue(handle);
+        }
+
+        static void await_resume() noexcept
+        {
+        }
+    };
+
+    Task<int> yielding_value(const int value)
+    {
+        co_await Yield{};
+        co_return value;
+    }
+} // namespace
+
+TEST(CoroutineFrameAllocator, FreedBlocksAreReusedForTheSameSizeClass)
+{
+    CoroutineFrameAllocator::trim();
+
+    auto *first = CoroutineFrameAllocator::allocate(300);
+    EXPECT_EQ(CoroutineFrameAllocator::source(first), CoroutineFrameSource::pooled);
+    CoroutineFrameAllocator::deallocate(first, 300);
+    EXPECT_EQ(CoroutineFrameAllocator::thread_stats().cached, 1);
+
+    auto *second = CoroutineFrameAllocator::allocate(280);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(CoroutineFrameAllocator::thread_stats().cached, 0);
+    CoroutineFrameAllocator::deallocate(second, 280);
+}
+
+TEST(CoroutineFrameAllocator, OversizedFramesBypassTheCache)
+{
+    CoroutineFrameAllocator::trim();
+
+    constexpr std::size_t size = CoroutineFrameAllocator::max_size_class * 2;
+    auto *frame = CoroutineFrameAllocator::allocate(size);
+    EXPECT_EQ(CoroutineFrameAllocator::source(frame), CoroutineFrameSource::heap);
+    CoroutineFrameAllocator::deallocate(frame, size);
+    EXPECT_EQ(CoroutineFrameAllocator::thread_stats().cached, 0);
+}
+
+TEST(CoroutineFrameAllocator, TaskFramesAreRecycled)
+{
+    CoroutineFrameAllocator::trim();
+
+    EXPECT_EQ(immediate_value(1).get(), 1);
+    const auto before = CoroutineFrameAllocator::thread_stats();
+    EXPECT_EQ(before.cached, 1);
+
+    for (int i = 0; i < 16; ++i)
+    {
+        EXPECT_EQ(immediate_value(i).get(), i);
+    }
+
+    const auto after = CoroutineFrameAllocator::thread_stats();
+    EXPECT_EQ(after.allocations - before.allocations, 16);
+    EXPECT_EQ(after.recycled - before.recycled, 16);
+    EXPECT_EQ(after.cached, 1);
+}
+
+TEST(CoroutineFrameAllocator, SuspendedFrameIsReleasedOnceBothSidesAreDone)
+{
+    ManualTaskScheduler scheduler;
+    TaskScheduler::Scope scope{&scheduler};
+    CoroutineFrameAllocator::trim();
+
+    {
+        auto task = yielding_value(5);
+        EXPECT_EQ(CoroutineFrameAllocator::thread_stats().cached, 0);
+    }
+
+    // The Task is gone but the coroutine still holds on to its frame until it finishes
+    EXPECT_EQ(CoroutineFrameAllocator::thread_stats().cached, 0);
+    EXPECT_EQ(scheduler.pump(), 1);
+    EXPECT_EQ(CoroutineFrameAllocator::thread_stats().cached, 1);
+}
+
+TEST(CoroutineFrameAllocator, AllocatorArgPlacesFrameInArena)
+{
+    CoroutineFrameAllocator::trim();
+    SingleArena arena{4096};
+    const auto before = CoroutineFrameAllocator::thread_stats();
+
+    EXPECT_EQ(arena_value(std::allocator_arg, arena, 7).get(), 7);
+
+    const auto after = CoroutineFrameAllocator::thread_stats();
+    EXPECT_GT(arena.used_capacity(), 0);
+    EXPECT_EQ(after.allocations, before.allocations);
+    EXPECT_EQ(after.cached, 0);
+}
@@ -0,0 +1,82 @@
+/**
+ * @file test_workload.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import retro.core.async.workload;
+import retro.core.async.thread_pool;
+import retro.core.async.task_scheduler;
+import std;
+
+using namespace retro;
+
+TEST(Workload, ProcessesEveryChunkExactlyOnce)
+{
+    constexpr std::size_t chunk_count = 1000;
+    std::vector<std::atomic<std::int32_t>> visits(chunk_count);
+
+    const Workload workload{[&visits](const std::size_t i, std::size_t)
+                            {
+                                visits[i].fetch_add(1);
+                                return true;
+                            },
+                            chunk_count,
+                            TaskPriority::low};
+
+    EXPECT_TRUE(workload.finish(4));
+    for (const auto &count : visits)
+    {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+TEST(Workload, ReportsFailureFromAnyChunk)
+{
+    const Workload workload{[](const std::size_t i, std::size_t) { return i != 17; }, 64};
+
+    EXPECT_FALSE(workload.finish(4));
+}
+
+TEST(ThreadPool, DrainsHigherPriorityLanesFirst)
+{
+    ThreadPool pool{1};
+
+    std::latch started{1};
+    std::latch release{1};
+    std::mutex order_mutex;
+    std::vector<TaskPriority> order;
+
+    pool.post(
+        [&]
+        {
+            started.count_down();
+            release.wait();
+        });
+    started.wait();
+
+    std::latch finished{3};
+    auto record = [&](const TaskPriority priority)
+    {
+        return [&, priority]
+        {
+            {
+                std::scoped_lock lock{order_mutex};
+                order.push_back(priority);
+            }
+            finished.count_down();
+        };
+    };
+
+    pool.post(record(TaskPriority::low), {}, TaskPriority::low);
+    pool.post(record(TaskPriority::normal), {}, TaskPriority::normal);
+    pool.post(record(TaskPriority::high), {}, TaskPriority::high);
+    EXPECT_TRUE(pool.has_pending_above(TaskPriority::low));
+
+    release.count_down();
+    finished.wait();
+
+    EXPECT_EQ(order, (std::vector{TaskPriority::high, TaskPriority::normal, TaskPriority::low}));
+}
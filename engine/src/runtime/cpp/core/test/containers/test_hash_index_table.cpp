@@ -0,0 +1,77 @@
+/**
+ * @file test_hash_index_table.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import retro.core.containers.hash_index_table;
+import std;
+
+using namespace retro;
+
+namespace
+{
+    // Every key hashes the same, so only the content check can tell them apart
+    constexpr std::size_t colliding_hash = 0x5eed;
+
+    auto same_string(const std::vector<std::string> &storage, const std::string_view key)
+    {
+        return [&storage, key](const std::size_t index) { return storage[index] == key; };
+    }
+} // namespace
+
+TEST(HashIndexTable, CollidingKeysGetDistinctValues)
+{
+    const std::vector<std::string> storage{"alpha", "beta", "gamma", "delta"};
+    HashIndexTable<std::size_t> table;
+    for (std::size_t i = 0; i < storage.size(); ++i)
+    {
+        table.insert(colliding_hash, i);
+    }
+
+    for (std::size_t i = 0; i < storage.size(); ++i)
+    {
+        EXPECT_EQ(table.find(colliding_hash, same_string(storage, storage[i])), i);
+    }
+    EXPECT_FALSE(table.find(colliding_hash, same_string(storage, "epsilon")).has_value());
+}
+
+TEST(HashIndexTable, FindOrInsertOnlyCreatesUnseenKeys)
+{
+    std::vector<std::string> storage;
+    HashIndexTable<std::size_t> table;
+    const auto intern = [&](const std::string &key)
+    {
+        return table.find_or_insert(colliding_hash,
+                                    same_string(storage, key),
+                                    [&]
+                                    {
+                                        storage.push_back(key);
+                                        return storage.size() - 1;
+                                    });
+    };
+
+    EXPECT_EQ(intern("first"), 0);
+    EXPECT_EQ(intern("second"), 1);
+    EXPECT_EQ(intern("first"), 0);
+    EXPECT_EQ(table.size(), 2);
+}
+
+TEST(HashIndexTable, SurvivesGrowth)
+{
+    HashIndexTable<std::uint32_t> table;
+    for (std::uint32_t i = 0; i < 10000; ++i)
+    {
+        table.insert(std::hash<std::uint32_t>{}(i) * 0x9e3779b97f4a7c15, i);
+    }
+
+    EXPECT_EQ(table.size(), 10000);
+    EXPECT_LE(table.size() * 4, table.capacity() * 3);
+    for (std::uint32_t i = 0; i < 10000; ++i)
+    {
+        const auto hash = std::hash<std::uint32_t>{}(i) * 0x9e3779b97f4a7c15;
+        EXPECT_EQ(table.find(hash, [i](const std::uint32_t value) { return value == i; }), i);
+    }
+}
@@ -0,0 +1,107 @@
+/**
+ * @file test_mpsc_queue.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import retro.core.containers.mpsc_queue;
+import std;
+
+using namespace retro;
+
+namespace
+{
+    constexpr std::int32_t producer_count = 4;
+    constexpr std::int32_t items_per_producer = 25000;
+
+    // Every producer tags its items, the consumer checks that each producer's items arrive in the order pushed
+    template <typename Queue, typename Push>
+    void run_producers_against_single_consumer(Queue &queue, Push push)
+    {
+        std::vector<std::int32_t> next_expected(producer_count, 0);
+        std::int32_t received = 0;
+
+        {
+            std::vector<std::jthread> producers;
+            for (std::int32_t p = 0; p < producer_count; ++p)
+            {
+                producers.emplace_back(
+                    [&queue, &push, p]
+                    {
+                        for (std::int32_t i = 0; i < items_per_producer; ++i)
+                        {
+                            push(queue, std::pair{p, i});
+                        }
+                    });
+            }
+
+            while (received < producer_count * items_per_producer)
+            {
+                if (auto item = queue.pop(); item.has_value())
+                {
+                    auto [producer, index] = *item;
+                    EXPECT_EQ(index, next_expected[producer]);
+                    next_expected[producer] = index + 1;
+                    ++received;
+                }
+            }
+        }
+
+        EXPECT_TRUE(queue.empty());
+        EXPECT_EQ(received, producer_count * items_per_producer);
+    }
+} // namespace
+
+TEST(MpscQueue, PopsInPushOrder)
+{
+    MpscQueue<std::string> queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop().has_value());
+
+    queue.push("first");
+    queue.emplace(3, 'x');
+
+    EXPECT_EQ(queue.pop(), "first");
+    EXPECT_EQ(queue.pop(), "xxx");
+    EXPECT_FALSE(queue.pop().has_value());
+}
+
+TEST(MpscQueue, ConcurrentProducersPreserveTheirOwnOrder)
+{
+    MpscQueue<std::pair<std::int32_t, std::int32_t>> queue;
+    run_producers_against_single_consumer(queue, [](auto &q, auto item) { q.push(item); });
+}
+
+TEST(BoundedMpscQueue, RejectsPushesWhenFull)
+{
+    BoundedMpscQueue<std::int32_t, 4> queue;
+    for (std::int32_t i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(queue.try_push(i));
+    }
+    EXPECT_FALSE(queue.try_push(4));
+
+    EXPECT_EQ(queue.pop(), 0);
+    EXPECT_TRUE(queue.try_push(4));
+
+    for (std::int32_t i = 1; i <= 4; ++i)
+    {
+        EXPECT_EQ(queue.pop(), i);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(BoundedMpscQueue, ConcurrentProducersPreserveTheirOwnOrder)
+{
+    BoundedMpscQueue<std::pair<std::int32_t, std::int32_t>, 256> queue;
+    run_producers_against_single_consumer(queue,
+                                          [](auto &q, auto item)
+                                          {
+                                              while (!q.try_push(item))
+                                              {
+                                                  std::this_thread::yield();
+                                              }
+                                          });
+}
@@ -0,0 +1,92 @@
+/**
+ * @file test_work_stealing_deque.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import retro.core.containers.work_stealing_deque;
+import std;
+
+using namespace retro;
+
+TEST(WorkStealingDeque, OwnerPopsInLifoOrderAndThievesStealInFifoOrder)
+{
+    WorkStealingDeque<std::int32_t> deque{2};
+    for (std::int32_t i = 0; i < 8; ++i)
+    {
+        deque.push(i);
+    }
+
+    EXPECT_EQ(deque.size(), 8);
+    EXPECT_EQ(deque.steal(), 0);
+    EXPECT_EQ(deque.steal(), 1);
+    EXPECT_EQ(deque.pop(), 7);
+    EXPECT_EQ(deque.pop(), 6);
+    EXPECT_EQ(deque.size(), 4);
+}
+
+TEST(WorkStealingDeque, EmptyDequeReturnsNothing)
+{
+    WorkStealingDeque<std::int32_t> deque;
+
+    EXPECT_TRUE(deque.empty());
+    EXPECT_FALSE(deque.pop().has_value());
+    EXPECT_FALSE(deque.steal().has_value());
+}
+
+TEST(WorkStealingDeque, ConcurrentThievesTakeEveryItemExactlyOnce)
+{
+    constexpr std::int32_t item_count = 100000;
+    constexpr std::int32_t thief_count = 4;
+
+    WorkStealingDeque<std::int32_t> deque{16};
+    std::vector<std::atomic<std::int32_t>> seen(item_count);
+    std::atomic<std::int32_t> taken{0};
+    std::atomic_bool producing{true};
+
+    std::vector<std::jthread> thieves;
+    for (std::int32_t i = 0; i < thief_count; ++i)
+    {
+        thieves.emplace_back(
+            [&]
+            {
+                while (producing || !deque.empty())
+                {
+                    if (auto item = deque.steal(); item.has_value())
+                    {
+                        seen[*item].fetch_add(1);
+                        taken.fetch_add(1);
+                    }
+                }
+            });
+    }
+
+    for (std::int32_t i = 0; i < item_count; ++i)
+    {
+        deque.push(i);
+        if (i % 3 == 0)
+        {
+            if (auto item = deque.pop(); item.has_value())
+            {
+                seen[*item].fetch_add(1);
+                taken.fetch_add(1);
+            }
+        }
+    }
+    producing = false;
+    thieves.clear();
+
+    while (auto item = deque.pop())
+    {
+        seen[*item].fetch_add(1);
+        taken.fetch_add(1);
+    }
+
+    EXPECT_EQ(taken.load(), item_count);
+    for (const auto &count : seen)
+    {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
@@ -536,3 +536,95 @@ TEST(Delegate, MulticastRemove)
     multicast.broadcast(3);
     EXPECT_EQ(total, 6);
 }
+
+TEST(Delegate, CopyOnWriteMulticastBroadcastsAndRemoves)
+{
+    MulticastDelegate<void(std::int32_t), retro::CopyOnWritePolicy> multicast;
+    std::int32_t total = 0;
+    MulticastReceiver receiver;
+
+    const auto handle_sum = multicast.add([&](const std::int32_t value) { total += value; });
+    multicast.add<&MulticastReceiver::add>(receiver);
+    EXPECT_EQ(multicast.size(), 2);
+
+    multicast.broadcast(4);
+    EXPECT_EQ(total, 4);
+    EXPECT_EQ(receiver.total, 4);
+
+    multicast.remove(handle_sum);
+    EXPECT_EQ(multicast.size(), 1);
+    multicast.broadcast(2);
+    EXPECT_EQ(total, 4);
+    EXPECT_EQ(receiver.total, 6);
+
+    multicast.clear();
+    EXPECT_EQ(multicast.size(), 0);
+    multicast.broadcast(1);
+    EXPECT_EQ(receiver.total, 6);
+}
+
+TEST(Delegate, CopyOnWriteMulticastSubscribersCanUnsubscribeWhileBroadcasting)
+{
+    MulticastDelegate<void(), retro::CopyOnWritePolicy> multicast;
+    std::int32_t once_calls = 0;
+    std::int32_t always_calls = 0;
+
+    retro::DelegateHandle once_handle;
+    once_handle = multicast.add(
+        [&]
+        {
+            ++once_calls;
+            multicast.remove(once_handle);
+            multicast.add([&] { ++always_calls; });
+        });
+    multicast.add([&] { ++always_calls; });
+
+    // Changes made during a broadcast only show up in the next one
+    multicast.broadcast();
+    EXPECT_EQ(once_calls, 1);
+    EXPECT_EQ(always_calls, 1);
+
+    multicast.broadcast();
+    EXPECT_EQ(once_calls, 1);
+    EXPECT_EQ(always_calls, 3);
+}
+
+TEST(Delegate, CopyOnWriteMulticastToleratesConcurrentSubscriptions)
+{
+    MulticastDelegate<void(std::int32_t), retro::CopyOnWritePolicy> multicast;
+    std::atomic<std::int64_t> stable_total{0};
+    multicast.add([&](const std::int32_t value) { stable_total.fetch_add(value, std::memory_order_relaxed); });
+
+    std::atomic<std::int32_t> churn_calls{0};
+
+    constexpr std::int32_t broadcasts_per_thread = 5000;
+    constexpr std::int32_t broadcaster_count = 4;
+    {
+        std::vector<std::jthread> threads;
+        for (std::int32_t t = 0; t < broadcaster_count; ++t)
+        {
+            threads.emplace_back(
+                [&multicast]
+                {
+                    for (std::int32_t i = 0; i < broadcasts_per_thread; ++i)
+                    {
+                        multicast.broadcast(1);
+                    }
+                });
+        }
+
+        threads.emplace_back(
+            [&multicast, &churn_calls]
+            {
+                // A broadcast that started before a removal may still call the removed subscriber
+                for (std::int32_t i = 0; i < 2000; ++i)
+                {
+                    const auto handle = multicast.add([&churn_calls](std::int32_t) { ++churn_calls; });
+                    multicast.remove(handle);
+                }
+            });
+    }
+
+    EXPECT_EQ(stable_total.load(), std::int64_t{broadcasts_per_thread} * broadcaster_count);
+    EXPECT_EQ(multicast.size(), 1);
+}
@@ -0,0 +1,105 @@
+/**
+ * @file test_arena_allocator.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import retro.core.memory.arena_allocator;
+import std;
+
+using namespace retro;
+
+namespace
+{
+    constexpr std::size_t block_size = 1024;
+
+    void fill_blocks(MultiArena &arena, const std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::ignore = arena.allocate(block_size / 2);
+            std::ignore = arena.allocate(block_size / 2);
+        }
+    }
+} // namespace
+
+TEST(MultiArena, ResetRecyclesBlocksInsteadOfFreeingThem)
+{
+    MultiArena arena{block_size};
+    fill_blocks(arena, 4);
+    EXPECT_EQ(arena.stats().blocks_live, 4);
+
+    arena.reset();
+    auto stats = arena.stats();
+    EXPECT_EQ(stats.blocks_live, 1);
+    EXPECT_EQ(stats.blocks_retained, 3);
+    EXPECT_EQ(stats.bytes_used, 0);
+    EXPECT_EQ(stats.bytes_reserved, 4 * block_size);
+
+    // Growing back to the same size is served entirely from retained blocks
+    fill_blocks(arena, 4);
+    stats = arena.stats();
+    EXPECT_EQ(stats.blocks_live, 4);
+    EXPECT_EQ(stats.blocks_retained, 0);
+    EXPECT_EQ(stats.bytes_reserved, 4 * block_size);
+}
+
+TEST(MultiArena, ResetHonorsTheRetentionLimit)
+{
+    MultiArena arena{block_size, 1, std::numeric_limits<std::size_t>::max(), 2};
+    fill_blocks(arena, 5);
+
+    arena.reset();
+    const auto stats = arena.stats();
+    EXPECT_EQ(stats.blocks_live, 1);
+    EXPECT_EQ(stats.blocks_retained, 1);
+    EXPECT_EQ(stats.bytes_reserved, 2 * block_size);
+}
+
+TEST(MultiArena, OversizedRequestsGetTheirOwnAllocation)
+{
+    MultiArena arena{block_size, 1, 1};
+
+    auto *small = arena.allocate(16);
+    auto *large = static_cast<std::byte *>(arena.allocate(block_size * 4, 64));
+    ASSERT_NE(large, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(large) % 64, 0);
+    std::fill_n(large, block_size * 4, std::byte{0xAB});
+
+    // The oversized request must not have used up the only block
+    EXPECT_NE(arena.allocate(16), small);
+    auto stats = arena.stats();
+    EXPECT_EQ(stats.blocks_live, 1);
+    EXPECT_EQ(stats.oversized_allocations, 1);
+
+    arena.reset();
+    stats = arena.stats();
+    EXPECT_EQ(stats.oversized_allocations, 0);
+    EXPECT_EQ(stats.bytes_reserved, block_size);
+}
+
+TEST(MultiArena, TracksPeakUsageAndResets)
+{
+    MultiArena arena{block_size};
+    std::ignore = arena.allocate(300);
+    std::ignore = arena.allocate(200);
+    arena.reset();
+    std::ignore = arena.allocate(100);
+    arena.reset();
+
+    const auto stats = arena.stats();
+    EXPECT_EQ(stats.peak_bytes_used, 500);
+    EXPECT_EQ(stats.resets, 2);
+}
+
+TEST(ArenaMemoryResource, ReportsTheStatsOfItsArena)
+{
+    MultiArenaMemoryResource resource{std::in_place, block_size};
+    std::pmr::vector<std::int32_t> values{&resource};
+    values.reserve(64);
+
+    EXPECT_EQ(resource.stats().bytes_used, 64 * sizeof(std::int32_t));
+    EXPECT_EQ(resource.arena().stats().blocks_live, 1);
+}
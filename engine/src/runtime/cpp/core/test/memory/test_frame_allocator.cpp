@@ -0,0 +1,85 @@
+/**
+ * @file test_frame_allocator.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import retro.core.memory.frame_allocator;
+import std;
+
+using namespace retro;
+
+TEST(FrameAllocator, ThreadsWithoutAFrameUseTheDefaultResource)
+{
+    std::jthread{[]
+                 {
+                     EXPECT_FALSE(FrameAllocator::in_frame());
+                     EXPECT_EQ(&FrameAllocator::resource(), std::pmr::get_default_resource());
+
+                     std::pmr::vector<int> values{FrameAllocator::allocator<int>()};
+                     values.assign(100, 1);
+                     EXPECT_EQ(values.size(), 100);
+                 }};
+}
+
+TEST(FrameAllocator, MemorySurvivesUntilItsSlotComesBackAround)
+{
+    std::jthread{[]
+                 {
+                     FrameAllocator::begin_frame();
+                     ASSERT_TRUE(FrameAllocator::in_frame());
+
+                     auto *first = static_cast<std::int32_t *>(FrameAllocator::allocate(sizeof(std::int32_t) * 16));
+                     std::ranges::fill(std::span{first, 16}, 42);
+
+                     // Frames in flight minus one later the first frame must still be intact
+                     for (std::size_t i = 1; i < FrameAllocator::frames_in_flight; ++i)
+                     {
+                         FrameAllocator::begin_frame();
+                         std::ignore = FrameAllocator::allocate(sizeof(std::int32_t) * 16);
+                     }
+                     EXPECT_EQ(std::ranges::count(std::span{first, 16}, 42), 16);
+
+                     // Once the slot is reused it hands out the same memory again
+                     FrameAllocator::begin_frame();
+                     EXPECT_EQ(FrameAllocator::allocate(sizeof(std::int32_t) * 16), first);
+                 }};
+}
+
+TEST(FrameAllocator, TracksHighWaterAcrossFrames)
+{
+    std::jthread{[]
+                 {
+                     FrameAllocator::begin_frame();
+                     std::ignore = FrameAllocator::allocate(4096);
+                     EXPECT_EQ(FrameAllocator::thread_stats().bytes_this_frame, 4096);
+
+                     FrameAllocator::begin_frame();
+                     std::ignore = FrameAllocator::allocate(1024);
+
+                     const auto stats = FrameAllocator::thread_stats();
+                     EXPECT_EQ(stats.frame_index, 2);
+                     EXPECT_EQ(stats.bytes_this_frame, 1024);
+                     EXPECT_EQ(stats.high_water, 4096);
+                     EXPECT_GE(FrameAllocator::global_high_water(), 4096);
+                 }};
+}
+
+TEST(FrameAllocator, ServesRequestsLargerThanABlock)
+{
+    std::jthread{[]
+                 {
+                     FrameAllocator::begin_frame();
+
+                     std::pmr::vector<std::byte> large{FrameAllocator::allocator<std::byte>()};
+                     large.resize(FrameAllocator::block_capacity * 2);
+                     EXPECT_EQ(large.size(), FrameAllocator::block_capacity * 2);
+
+                     for (std::size_t i = 0; i < FrameAllocator::frames_in_flight; ++i)
+                     {
+                         FrameAllocator::begin_frame();
+                     }
+                 }};
+}
@@ -0,0 +1,83 @@
+/**
+ * @file test_memory_tracking.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import retro.core.memory.arena_allocator;
+import retro.core.memory.memory_tracking;
+import std;
+
+using namespace retro;
+
+TEST(MemoryTracking, TaggedAllocatorAccountsLiveAndPeakBytes)
+{
+    const auto before = memory_tag_stats(MemoryTag::textures);
+    {
+        std::vector<std::uint32_t, TaggedAllocator<std::uint32_t, MemoryTag::textures>> values;
+        values.reserve(256);
+
+        const auto during = memory_tag_stats(MemoryTag::textures);
+        EXPECT_EQ(during.live_bytes - before.live_bytes, 256 * sizeof(std::uint32_t));
+        EXPECT_EQ(during.live_allocations - before.live_allocations, 1);
+        EXPECT_GE(during.peak_bytes, during.live_bytes);
+    }
+
+    const auto after = memory_tag_stats(MemoryTag::textures);
+    EXPECT_EQ(after.live_bytes, before.live_bytes);
+    EXPECT_EQ(after.live_allocations, before.live_allocations);
+    EXPECT_EQ(after.total_allocations - before.total_allocations, 1);
+    EXPECT_GE(after.peak_bytes, before.live_bytes + 256 * sizeof(std::uint32_t));
+}
+
+TEST(MemoryTracking, TaggedMemoryResourceForwardsToItsUpstream)
+{
+    const auto before = memory_tag_stats(MemoryTag::scene_nodes);
+    TaggedMemoryResource resource{MemoryTag::scene_nodes};
+    {
+        std::pmr::vector<std::byte> bytes{&resource};
+        bytes.resize(100);
+        EXPECT_EQ(memory_tag_stats(MemoryTag::scene_nodes).live_bytes - before.live_bytes, bytes.capacity());
+    }
+
+    EXPECT_EQ(memory_tag_stats(MemoryTag::scene_nodes).live_bytes, before.live_bytes);
+}
+
+TEST(MemoryTracking, ArenaBlocksStayAccountedUntilTheArenaIsDestroyed)
+{
+    constexpr std::size_t block_size = 1024;
+    const auto before = memory_tag_stats(MemoryTag::frame_arenas);
+    {
+        MultiArena arena{block_size, 1, std::numeric_limits<std::size_t>::max(), 1, MemoryTag::frame_arenas};
+        std::ignore = arena.allocate(block_size / 2);
+        std::ignore = arena.allocate(block_size / 2);
+        std::ignore = arena.allocate(block_size / 2);
+        EXPECT_EQ(memory_tag_stats(MemoryTag::frame_arenas).live_bytes - before.live_bytes, 2 * block_size);
+
+        // The arena always keeps its first block, the second one is past the retention limit and is freed
+        arena.reset();
+        EXPECT_EQ(memory_tag_stats(MemoryTag::frame_arenas).live_bytes - before.live_bytes, block_size);
+    }
+
+    EXPECT_EQ(memory_tag_stats(MemoryTag::frame_arenas).live_bytes, before.live_bytes);
+}
+
+TEST(MemoryTracking, TrackedMemoryFollowsItsSizeAndResetsPeaks)
+{
+    const auto before = memory_tag_stats(MemoryTag::gpu_buffers);
+    {
+        TrackedMemory memory{MemoryTag::gpu_buffers};
+        memory.resize(4096);
+        memory.resize(1024);
+        EXPECT_EQ(memory_tag_stats(MemoryTag::gpu_buffers).live_bytes - before.live_bytes, 1024);
+        EXPECT_GE(memory_tag_stats(MemoryTag::gpu_buffers).peak_bytes, before.live_bytes + 4096);
+
+        reset_memory_peaks();
+        EXPECT_EQ(memory_tag_stats(MemoryTag::gpu_buffers).peak_bytes, before.live_bytes + 1024);
+    }
+
+    EXPECT_EQ(memory_tag_stats(MemoryTag::gpu_buffers).live_bytes, before.live_bytes);
+    EXPECT_STREQ(memory_tag_name(MemoryTag::gpu_buffers), "GpuBuffers");
+}
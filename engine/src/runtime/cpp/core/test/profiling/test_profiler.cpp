@@ -0,0 +1,172 @@
+/**
+ * @file test_profiler.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import retro.core.profiling;
+import std;
+
+using namespace retro;
+
+namespace
+{
+    std::size_t count_events(const ProfileCapture &capture, const std::string_view name)
+    {
+        std::size_t count = 0;
+        for (const auto &thread : capture.threads)
+        {
+            count += std::ranges::count_if(thread.events,
+                                           [&](const ProfileEvent &event) { return event.name == name; });
+        }
+
+        return count;
+    }
+} // namespace
+
+TEST(Profiler, ZonesOutsideOfACaptureAreNotRecorded)
+{
+    {
+        const ProfileZone zone{"Before"};
+    }
+
+    begin_profile_capture();
+    {
+        const ProfileZone zone{"During"};
+    }
+    const auto capture = end_profile_capture();
+
+    {
+        const ProfileZone zone{"After"};
+    }
+
+    EXPECT_EQ(count_events(capture, "Before"), 0);
+    EXPECT_EQ(count_events(capture, "During"), 1);
+    EXPECT_EQ(count_events(capture, "After"), 0);
+}
+
+TEST(Profiler, NestedZonesAreContainedInTheirParent)
+{
+    begin_profile_capture();
+    {
+        const ProfileZone outer{"Outer"};
+        const ProfileZone inner{"Inner"};
+    }
+    const auto capture = end_profile_capture();
+
+    ASSERT_EQ(capture.threads.size(), 1);
+    const auto &events = capture.threads.front().events;
+    ASSERT_EQ(events.size(), 2);
+
+    // Zones are recorded as they close, so the inner one comes first
+    const auto &inner = events[0];
+    const auto &outer = events[1];
+    EXPECT_GE(inner.start_ns, outer.start_ns);
+    EXPECT_LE(inner.start_ns + inner.duration_ns, outer.start_ns + outer.duration_ns);
+}
+
+TEST(Profiler, EveryThreadGetsItsOwnTrack)
+{
+    constexpr std::size_t thread_count = 4;
+    constexpr std::size_t zones_per_thread = 5000;
+
+    begin_profile_capture();
+    {
+        std::vector<std::jthread> threads;
+        for (std::size_t i = 0; i < thread_count; ++i)
+        {
+            threads.emplace_back(
+                [i]
+                {
+                    set_profile_thread_name(std::format("Test {}", i));
+                    for (std::size_t j = 0; j < zones_per_thread; ++j)
+                    {
+                        const ProfileZone zone{"Work"};
+                    }
+                });
+        }
+    }
+    const auto capture = end_profile_capture();
+
+    EXPECT_EQ(capture.threads.size(), thread_count);
+    EXPECT_EQ(count_events(capture, "Work"), thread_count * zones_per_thread);
+}
+
+TEST(Profiler, ANewCaptureStartsEmpty)
+{
+    begin_profile_capture();
+    record_profile_counter("Counter", 1);
+    static_cast<void>(end_profile_capture());
+
+    begin_profile_capture();
+    mark_profile_frame(7);
+    const auto capture = end_profile_capture();
+
+    EXPECT_EQ(count_events(capture, "Counter"), 0);
+    ASSERT_EQ(count_events(capture, "Frame"), 1);
+}
+
+TEST(Profiler, ChromeTraceContainsEveryEventKind)
+{
+    begin_profile_capture();
+    set_profile_thread_name("Main \"thread\"");
+    {
+        const ProfileZone zone{"Zone"};
+    }
+    mark_profile_frame(3);
+    record_profile_counter("Counter", 2.5);
+    const auto capture = end_profile_capture();
+
+    std::ostringstream stream;
+    write_chrome_trace(capture, stream);
+    const auto trace = stream.str();
+
+    EXPECT_TRUE(trace.contains(R"("name":"Main \"thread\"")"));
+    EXPECT_TRUE(trace.contains(R"({"name":"Zone","cat":"retro","ph":"X")"));
+    EXPECT_TRUE(trace.contains(R"("args":{"frame":3})"));
+    EXPECT_TRUE(trace.contains(R"("args":{"value":2.5})"));
+}
+
+TEST(Profiler, NonFiniteCountersAreWrittenAsNull)
+{
+    begin_profile_capture();
+    record_profile_counter("NaN", std::numeric_limits<double>::quiet_NaN());
+    record_profile_counter("Infinity", std::numeric_limits<double>::infinity());
+    record_profile_counter("NegativeInfinity", -std::numeric_limits<double>::infinity());
+    const auto capture = end_profile_capture();
+
+    std::ostringstream stream;
+    write_chrome_trace(capture, stream);
+    const auto trace = stream.str();
+
+    EXPECT_FALSE(trace.contains(R"("value":nan)"));
+    EXPECT_FALSE(trace.contains(R"("value":inf)"));
+    EXPECT_FALSE(trace.contains(R"("value":-inf)"));
+
+    std::size_t nulls = 0;
+    for (auto at = trace.find(R"("args":{"value":null})"); at != std::string::npos;
+         at = trace.find(R"("args":{"value":null})", at + 1))
+    {
+        ++nulls;
+    }
+    EXPECT_EQ(nulls, 3);
+}
+
+TEST(Profiler, GpuTimingsAverageAcrossFrames)
+{
+    reset_gpu_timing_stats();
+    record_gpu_timing("TestPipeline", 2.0);
+    record_gpu_timing("TestPipeline", 4.0);
+
+    const auto stats = gpu_timing_stats();
+    const auto entry = std::ranges::find_if(stats,
+                                            [](const GpuTimingStats &timing)
+                                            { return std::string_view{timing.name} == "TestPipeline"; });
+    ASSERT_NE(entry, stats.end());
+    EXPECT_EQ(entry->samples, 2);
+    EXPECT_DOUBLE_EQ(entry->last_ms, 4.0);
+    EXPECT_GT(entry->average_ms, 2.0);
+    EXPECT_LT(entry->average_ms, 4.0);
+}
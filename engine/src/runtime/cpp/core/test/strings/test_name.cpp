@@ -11,6 +11,12 @@
 using retro::FindType;
 using retro::Name;
 using retro::NAME_NO_NUMBER;
+using retro::operator""_cname;
+
+namespace
+{
+    const retro::NameRegistrar startup_names{"Startup/Registered", "Startup/Numbered_7"};
+}
 
 TEST(Name, DefaultConstructionYieldsNoneAndValid)
 {
@@ -128,3 +134,112 @@ TEST(Name, NoneCreatesANoneName)
     const std::string display = none.to_string();
     EXPECT_EQ(display, (std::string{"None"}));
 }
+
+TEST(Name, ConcurrentCreationAgreesOnIndices)
+{
+    constexpr std::int32_t thread_count = 8;
+    constexpr std::int32_t name_count = 2000;
+
+    std::vector<std::vector<Name>> created(thread_count);
+    {
+        std::vector<std::jthread> threads;
+        for (std::int32_t t = 0; t < thread_count; ++t)
+        {
+            threads.emplace_back(
+                [&names = created[t], t]
+                {
+                    // Every thread walks the same names in a different order so they race on each insertion
+                    for (std::int32_t i = 0; i < name_count; ++i)
+                    {
+                        const auto index = (i + t * 211) % name_count;
+                        names.emplace_back(std::format("ConcurrentName{}", index));
+                    }
+                });
+        }
+    }
+
+    for (std::int32_t i = 0; i < name_count; ++i)
+    {
+        const Name expected{std::format("ConcurrentName{}", i)};
+        EXPECT_EQ(expected.to_string(), std::format("ConcurrentName{}", i));
+        for (std::int32_t t = 0; t < thread_count; ++t)
+        {
+            const auto &name = created[t][(i - t * 211 % name_count + name_count) % name_count];
+            EXPECT_EQ(name, expected);
+            EXPECT_EQ(name.display_index(), expected.display_index());
+        }
+    }
+}
+
+TEST(Name, PredefinedLiteralsMatchRuntimeLookup)
+{
+    constexpr auto texture = "Texture"_cname;
+    constexpr auto numbered = "Camera_3"_cname;
+    static_assert(texture.comparison_index() != 0u);
+    static_assert("None"_cname.is_none());
+
+    EXPECT_EQ(texture, Name{"Texture"});
+    EXPECT_EQ(texture.display_index(), Name{"Texture"}.display_index());
+    EXPECT_EQ(texture.to_string(), std::string{"Texture"});
+    EXPECT_EQ(numbered, Name{"Camera_3"});
+    EXPECT_EQ(numbered.number(), 3);
+    EXPECT_EQ(Name{"texture"}, texture);
+
+    // Looked up without adding, so each one has to be in the table already under the id baked into the literals
+    for (std::size_t i = 0; i < retro::predefined_names.size(); ++i)
+    {
+        EXPECT_EQ(Name(retro::predefined_names[i], FindType::find).comparison_index(), static_cast<std::uint32_t>(i));
+    }
+}
+
+TEST(Name, RegisteredNamesAreInternedBeforeFirstUse)
+{
+    const Name registered{"Startup/Registered", FindType::find};
+    const Name numbered{"Startup/Numbered", FindType::find};
+    ASSERT_FALSE(registered.is_none());
+    ASSERT_FALSE(numbered.is_none());
+
+    // Registered names are added in the startup batch, ahead of anything created by the tests themselves
+    const Name created_later{"Startup/CreatedByTheTest"};
+    EXPECT_GE(registered.comparison_index(), static_cast<std::uint32_t>(retro::predefined_names.size()));
+    EXPECT_LT(registered.comparison_index(), created_later.comparison_index());
+    EXPECT_LT(numbered.comparison_index(), created_later.comparison_index());
+
+    EXPECT_EQ(Name{"Startup/Registered"}.comparison_index(), registered.comparison_index());
+    EXPECT_EQ(Name{"Startup/Numbered_7"}.comparison_index(), numbered.comparison_index());
+    EXPECT_EQ(Name{"Startup/Numbered_7"}.number(), 7);
+}
+
+TEST(Name, RegisteringAfterStartupInternsRightAway)
+{
+    ASSERT_TRUE(Name("Startup/Late", FindType::find).is_none());
+
+    const std::array<std::string_view, 1> late{"Startup/Late"};
+    retro::register_startup_names(late);
+    EXPECT_FALSE(Name("Startup/Late", FindType::find).is_none());
+}
+
+TEST(Name, InternMatchesIndividualLookups)
+{
+    const std::vector<std::string_view> values{"Manifest/Hero",
+                                               "Manifest/Villain_2",
+                                               "manifest/hero",
+                                               "",
+                                               "None_4",
+                                               "Texture",
+                                               "Manifest/Hero"};
+
+    const auto interned = Name::intern(values);
+    ASSERT_EQ(interned.size(), values.size());
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        const Name expected{values[i]};
+        EXPECT_EQ(interned[i], expected);
+        EXPECT_EQ(interned[i].display_index(), expected.display_index());
+    }
+
+    EXPECT_EQ(interned[0], interned[2]);
+    EXPECT_TRUE(interned[3].is_none());
+    EXPECT_EQ(interned[4].number(), 4);
+    EXPECT_EQ(interned[5], "Texture"_cname);
+}
@@ -0,0 +1,146 @@
+/**
+ * @file test_name_snapshot.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import retro.core.strings.name;
+import retro.core.memory.mapped_file;
+import retro.core.util.exceptions;
+import std;
+
+using namespace retro;
+
+namespace
+{
+    class NameSnapshotTest : public testing::Test
+    {
+      protected:
+        void SetUp() override
+        {
+            const auto *info = testing::UnitTest::GetInstance()->current_test_info();
+            path_ = std::filesystem::temp_directory_path() / std::format("retro_{}.names", info->name());
+        }
+
+        void TearDown() override
+        {
+            std::error_code error;
+            std::filesystem::remove(path_, error);
+        }
+
+        void write_bytes(const std::string_view bytes) const
+        {
+            std::ofstream file{path_, std::ios::binary | std::ios::trunc};
+            file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        }
+
+        std::filesystem::path path_;
+    };
+
+    // Death test suites run first, so the child that writes the snapshot starts from the same table as this process
+    using NameSnapshotDeathTest = NameSnapshotTest;
+
+    std::string mapped_name(const std::size_t index)
+    {
+        return std::format("Snapshot/Mapped/Entry{}", index);
+    }
+} // namespace
+
+TEST_F(NameSnapshotDeathTest, SavingOverALoadedSnapshotKeepsItsEntriesReadable)
+{
+    constexpr std::size_t mapped_count = 64;
+
+    // Names added by a child process are new to this one, so loading the snapshot maps them in
+    EXPECT_EXIT(
+        {
+            for (std::size_t i = 0; i < mapped_count; ++i)
+            {
+                std::ignore = Name{mapped_name(i)};
+            }
+            save_name_table_snapshot(path_);
+            std::exit(0);
+        },
+        testing::ExitedWithCode(0),
+        "");
+
+    ASSERT_EQ(load_name_table_snapshot(path_), mapped_count);
+
+    // New names move every entry in the next snapshot, reading the old offsets from it would show the wrong names
+    std::ignore = Name{"Snapshot/AddedAfterLoading"};
+#ifndef _WIN32
+    // Windows won't replace a file that still has a mapped view, only POSIX can save over the loaded snapshot
+    save_name_table_snapshot(path_);
+    EXPECT_EQ(load_name_table_snapshot(path_), 0);
+#endif
+
+    for (std::size_t i = 0; i < mapped_count; ++i)
+    {
+        EXPECT_EQ(Name{mapped_name(i)}.to_string(), mapped_name(i));
+    }
+}
+
+TEST_F(NameSnapshotTest, ReloadingIntoTheSameTableAddsNothing)
+{
+    const Name hero{"Snapshot/Hero"};
+    const Name villain{"Snapshot/Villain_3"};
+    save_name_table_snapshot(path_);
+
+    EXPECT_EQ(load_name_table_snapshot(path_), 0);
+    EXPECT_EQ(Name{"Snapshot/Hero"}, hero);
+    EXPECT_EQ(Name{"Snapshot/Villain_3"}, villain);
+    EXPECT_EQ(villain.to_string(), std::string{"Snapshot/Villain_3"});
+}
+
+TEST_F(NameSnapshotTest, SnapshotIsAFlatFileThatCanBeMapped)
+{
+    std::ignore = Name{"Snapshot/Mapped"};
+    save_name_table_snapshot(path_);
+
+    const MappedFile file{path_};
+    ASSERT_GE(file.size(), 4);
+    EXPECT_EQ(file.size(), std::filesystem::file_size(path_));
+
+    const auto bytes = file.data();
+    EXPECT_EQ((std::string_view{reinterpret_cast<const char *>(bytes.data()), 4}), "RNMT");
+
+    const std::string_view contents{reinterpret_cast<const char *>(bytes.data()), bytes.size()};
+    EXPECT_NE(contents.find("Snapshot/Mapped"), std::string_view::npos);
+}
+
+TEST_F(NameSnapshotTest, RejectsATableWithNamesTheSnapshotDoesNotHave)
+{
+    save_name_table_snapshot(path_);
+    std::ignore = Name{"Snapshot/CreatedAfterSaving"};
+
+    EXPECT_THROW(std::ignore = load_name_table_snapshot(path_), InvalidStateException);
+}
+
+TEST_F(NameSnapshotTest, RejectsFilesThatAreNotSnapshots)
+{
+    write_bytes("definitely not a name table snapshot, just some text that is long enough");
+    EXPECT_THROW(std::ignore = load_name_table_snapshot(path_), IoException);
+
+    write_bytes("RN");
+    EXPECT_THROW(std::ignore = load_name_table_snapshot(path_), IoException);
+
+    write_bytes("");
+    EXPECT_THROW(std::ignore = load_name_table_snapshot(path_), IoException);
+}
+
+TEST_F(NameSnapshotTest, RejectsTruncatedSnapshots)
+{
+    std::ignore = Name{"Snapshot/Truncated"};
+    save_name_table_snapshot(path_);
+    std::filesystem::resize_file(path_, std::filesystem::file_size(path_) - 8);
+
+    const auto entries_before = debug_get_name_entries().size();
+    EXPECT_THROW(std::ignore = load_name_table_snapshot(path_), IoException);
+    EXPECT_EQ(debug_get_name_entries().size(), entries_before);
+}
+
+TEST(MappedFile, MissingFilesThrow)
+{
+    EXPECT_THROW(MappedFile{std::filesystem::temp_directory_path() / "retro_missing_mapped_file"}, IoException);
+}
@@ -0,0 +1,55 @@
+/**
+ * @file test_string_hashing.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import retro.core.strings.encoding;
+import retro.core.strings.string_hashing;
+import std;
+
+using namespace retro;
+
+namespace
+{
+    std::size_t hash_ignore_case(const std::string_view str)
+    {
+        return hash_string<StringComparison::case_insensitive>(str);
+    }
+} // namespace
+
+TEST(StringHashing, CaseInsensitiveHashFoldsAsciiAtEveryLength)
+{
+    // Cover empty, partial words, exact words and a trailing partial word
+    const std::string upper = "ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789@[`{";
+    const std::string lower = "abcdefghijklmnopqrstuvwxyz_0123456789@[`{";
+    for (std::size_t length = 0; length <= upper.size(); ++length)
+    {
+        EXPECT_EQ(hash_ignore_case(std::string_view{upper}.substr(0, length)),
+                  hash_ignore_case(std::string_view{lower}.substr(0, length)))
+            << "length " << length;
+    }
+}
+
+TEST(StringHashing, CaseInsensitiveHashKeepsPunctuationNextToLettersDistinct)
+{
+    // These sit right outside A-Z, folding them would make them collide with letters
+    EXPECT_NE(hash_ignore_case("@"), hash_ignore_case("`"));
+    EXPECT_NE(hash_ignore_case("["), hash_ignore_case("{"));
+    EXPECT_NE(hash_ignore_case("Z"), hash_ignore_case("["));
+}
+
+TEST(StringHashing, CaseInsensitiveHashFoldsNonAscii)
+{
+    EXPECT_EQ(hash_ignore_case("ÀÉÎÕÜ Name"), hash_ignore_case("àéîõü name"));
+    // The Kelvin sign folds to a plain ASCII k, so it has to land on the ASCII hash
+    EXPECT_EQ(hash_ignore_case("K"), hash_ignore_case("k"));
+}
+
+TEST(StringHashing, CaseSensitiveHashDistinguishesCase)
+{
+    EXPECT_NE(hash_string("Player"), hash_string("player"));
+    EXPECT_EQ(hash_string("Player"), hash_string(std::string{"Player"}));
+}
@@ -0,0 +1,241 @@
+/**
+ * @file async_sink.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module retro.logging.async_sink;
+
+namespace retro
+{
+    /**
+     * A slot of the ring. The sequence number tells producers and the consumer whose turn it is: a cell at position p
+     * is free for the producer that claimed p while its sequence equals p, and holds a record for the consumer once it
+     * equals p + 1. The strings keep their capacity between uses, so a steady stream of messages does not allocate.
+     */
+    struct AsyncLogSink::Cell
+    {
+        std::atomic<std::size_t> sequence{0};
+        spdlog::log_clock::time_point time;
+        spdlog::source_loc source;
+        std::size_t thread_id = 0;
+        spdlog::level::level_enum level = spdlog::level::off;
+        std::string logger_name;
+        std::string payload;
+    };
+
+    namespace
+    {
+        void write_to(spdlog::sinks::sink &target, const spdlog::details::log_msg &msg)
+        {
+            if (!target.should_log(msg.level))
+                return;
+
+            // An exception escaping the background thread would take the whole process down
+            try
+            {
+                target.log(msg);
+            }
+            catch (const std::exception &e)
+            {
+                std::println(std::cerr, "Failed to write log message: {}", e.what());
+            }
+        }
+    } // namespace
+
+    AsyncLogSink::AsyncLogSink(spdlog::sink_ptr target, const AsyncLogOptions &options)
+        : target_{std::move(target)}, overflow_policy_{options.overflow_policy},
+          capacity_{std::bit_ceil(std::max<std::size_t>(options.capacity, 2))},
+          cells_{std::make_unique<Cell[]>(capacity_)}
+    {
+        for (std::size_t i = 0; i < capacity_; ++i)
+        {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        thread_ = std::jthread{[this](const std::stop_token &stop_token) { run(stop_token); }};
+    }
+
+    AsyncLogSink::~AsyncLogSink()
+    {
+        thread_.request_stop();
+        wake();
+        thread_.join();
+    }
+
+    void AsyncLogSink::log(const spdlog::details::log_msg &msg)
+    {
+        while (true)
+        {
+            const auto written = written_.load(std::memory_order_acquire);
+            if (try_push(msg))
+                break;
+
+            if (overflow_policy_ != LogOverflowPolicy::block)
+            {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                wake();
+                return;
+            }
+
+            wake();
+            written_.wait(written, std::memory_order_acquire);
+        }
+
+        // Pairs with the fence in run, so either this thread sees the consumer going to sleep or the consumer sees
+        // the record that was just published
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_relaxed))
+        {
+            wake();
+        }
+    }
+
+    void AsyncLogSink::flush()
+    {
+        const auto target = enqueue_position_.load(std::memory_order_acquire);
+        wake();
+
+        auto written = written_.load(std::memory_order_acquire);
+        while (written < target)
+        {
+            written_.wait(written, std::memory_order_acquire);
+            written = written_.load(std::memory_order_acquire);
+        }
+
+        target_->flush();
+    }
+
+    void AsyncLogSink::set_pattern(const std::string &pattern)
+    {
+        target_->set_pattern(pattern);
+    }
+
+    void AsyncLogSink::set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter)
+    {
+        target_->set_formatter(std::move(sink_formatter));
+    }
+
+    bool AsyncLogSink::try_push(const spdlog::details::log_msg &msg)
+    {
+        const auto mask = capacity_ - 1;
+        auto position = enqueue_position_.load(std::memory_order_relaxed);
+        Cell *cell;
+        while (true)
+        {
+            cell = &cells_[position & mask];
+            const auto sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+            if (difference == 0)
+            {
+                if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (difference < 0)
+            {
+                // The consumer has not freed this cell from the previous lap yet
+                return false;
+            }
+            else
+            {
+                position = enqueue_position_.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->time = msg.time;
+        cell->source = msg.source;
+        cell->thread_id = msg.thread_id;
+        cell->level = msg.level;
+        cell->logger_name.assign(msg.logger_name.data(), msg.logger_name.size());
+        cell->payload.assign(msg.payload.data(), msg.payload.size());
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool AsyncLogSink::has_next() const noexcept
+    {
+        const auto &cell = cells_[dequeue_position_ & (capacity_ - 1)];
+        return cell.sequence.load(std::memory_order_acquire) == dequeue_position_ + 1;
+    }
+
+    bool AsyncLogSink::write_next()
+    {
+        if (!has_next())
+            return false;
+
+        auto &cell = cells_[dequeue_position_ & (capacity_ - 1)];
+        spdlog::details::log_msg msg{cell.time,
+                                     cell.source,
+                                     spdlog::string_view_t{cell.logger_name.data(), cell.logger_name.size()},
+                                     cell.level,
+                                     spdlog::string_view_t{cell.payload.data(), cell.payload.size()}};
+        msg.thread_id = cell.thread_id;
+        write_to(*target_, msg);
+
+        cell.sequence.store(dequeue_position_ + capacity_, std::memory_order_release);
+        ++dequeue_position_;
+        return true;
+    }
+
+    void AsyncLogSink::report_dropped()
+    {
+        const auto dropped = dropped_.load(std::memory_order_relaxed);
+        if (overflow_policy_ != LogOverflowPolicy::drop_and_report || dropped == reported_dropped_)
+            return;
+
+        const auto message =
+            std::format("{} log messages were dropped because the queue was full", dropped - reported_dropped_);
+        const spdlog::details::log_msg msg{spdlog::string_view_t{"logging"},
+                                           spdlog::level::warn,
+                                           spdlog::string_view_t{message.data(), message.size()}};
+        write_to(*target_, msg);
+        reported_dropped_ = dropped;
+    }
+
+    void AsyncLogSink::wake()
+    {
+        wake_signal_.fetch_add(1, std::memory_order_release);
+        wake_signal_.notify_one();
+    }
+
+    void AsyncLogSink::run(const std::stop_token &stop_token)
+    {
+        while (true)
+        {
+            // Blocked producers and flush wait on written_, waking them in batches keeps the notify cost down
+            std::size_t batch = 0;
+            while (write_next())
+            {
+                written_.store(dequeue_position_, std::memory_order_release);
+                if (++batch % 64 == 0)
+                {
+                    written_.notify_all();
+                }
+            }
+
+            if (batch != 0)
+            {
+                written_.notify_all();
+            }
+
+            report_dropped();
+
+            const auto signal = wake_signal_.load(std::memory_order_acquire);
+            sleeping_.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (has_next())
+            {
+                sleeping_.store(false, std::memory_order_relaxed);
+                continue;
+            }
+
+            // Everything logged before the stop request has been written at this point
+            if (stop_token.stop_requested())
+                break;
+
+            wake_signal_.wait(signal, std::memory_order_acquire);
+            sleeping_.store(false, std::memory_order_relaxed);
+        }
+    }
+} // namespace retro
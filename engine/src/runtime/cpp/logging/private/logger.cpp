@@ -8,8 +8,69 @@
 
 import std;
 import retro.logging;
+import retro.logging.async_sink;
 import retro.core.strings.encoding;
-import boost.pool;
+
+namespace retro
+{
+    /**
+     * The UTF-8 source location of a managed call site. Converted once when the call site is first seen, and never
+     * freed, so messages that are written later by an asynchronous sink can still point at the names.
+     */
+    struct LogCallSite
+    {
+        std::string function_name;
+        std::string source_file;
+        std::int32_t source_line = 0;
+    };
+
+    namespace
+    {
+        class LogCallSiteRegistry
+        {
+          public:
+            const LogCallSite &get(const std::u16string_view function_name,
+                                   const std::u16string_view source_file,
+                                   const std::int32_t source_line)
+            {
+                const auto key = std::tuple{function_name, source_file, source_line};
+                {
+                    std::shared_lock lock{mutex_};
+                    if (const auto it = call_sites_.find(key); it != call_sites_.end())
+                        return it->second;
+                }
+
+                std::unique_lock lock{mutex_};
+                // Another thread may have added the call site in the meantime, in which case this is a lookup
+                const auto result =
+                    call_sites_.try_emplace(Key{function_name, source_file, source_line},
+                                            LogCallSite{.function_name = convert_string<char>(function_name),
+                                                        .source_file = convert_string<char>(source_file),
+                                                        .source_line = source_line});
+                return result.first->second;
+            }
+
+          private:
+            using Key = std::tuple<std::u16string, std::u16string, std::int32_t>;
+
+            std::shared_mutex mutex_;
+
+            // Node-based, so call sites never move once they have been handed out
+            std::map<Key, LogCallSite, std::less<>> call_sites_;
+        };
+
+        LogCallSiteRegistry &call_sites()
+        {
+            static LogCallSiteRegistry registry;
+            return registry;
+        }
+
+        void log_at(const LogLevel level, const LogCallSite &site, const std::u16string_view message)
+        {
+            get_logger(site.function_name, site.source_file, site.source_line).log(level, message);
+        }
+    } // namespace
+} // namespace retro
 
 extern "C"
 {
@@ -18,11 +79,46 @@ extern "C"
         retro::init_logger();
     }
 
+    RETRO_API void retro_init_async_logger(const std::int32_t capacity, const retro::LogOverflowPolicy overflow_policy)
+    {
+        retro::init_async_logger(
+            retro::AsyncLogOptions{.capacity = static_cast<std::size_t>(capacity), .overflow_policy = overflow_policy});
+    }
+
+    RETRO_API void retro_shutdown_logger()
+    {
+        retro::shutdown_logger();
+    }
+
+    RETRO_API bool retro_log_should_log(const retro::LogLevel level)
+    {
+        return retro::get_logger().should_log(level);
+    }
+
     RETRO_API void retro_log(const retro::LogLevel level, const char16_t *message, const std::int32_t length)
     {
         retro::get_logger().log(level, std::u16string_view(message, length));
     }
 
+    RETRO_API const retro::LogCallSite *retro_log_register_call_site(const char16_t *function_name,
+                                                                     const std::int32_t function_name_length,
+                                                                     const char16_t *source_file,
+                                                                     const std::int32_t source_file_length,
+                                                                     const std::int32_t source_line)
+    {
+        return std::addressof(retro::call_sites().get(std::u16string_view(function_name, function_name_length),
+                                                      std::u16string_view(source_file, source_file_length),
+                                                      source_line));
+    }
+
+    RETRO_API void retro_log_at_call_site(const retro::LogLevel level,
+                                          const retro::LogCallSite *call_site,
+                                          const char16_t *message,
+                                          const std::int32_t length)
+    {
+        retro::log_at(level, *call_site, std::u16string_view(message, length));
+    }
+
     RETRO_API void retro_log_with_source_info(const retro::LogLevel level,
                                               const char16_t *message,
                                               const std::int32_t length,
@@ -32,10 +128,9 @@ extern "C"
                                               const std::int32_t source_file_length,
                                               const std::int32_t source_line)
     {
-        const auto caller_name = retro::convert_string<char>(std::u16string_view(function_name, function_name_length),
-                                                             boost::pool_allocator<char>{});
-        const auto source_file_name = retro::convert_string<char>(std::u16string_view(source_file, source_file_length),
-                                                                  boost::pool_allocator<char>{});
-        retro::get_logger(caller_name, source_file_name, source_line).log(level, std::u16string_view(message, length));
+        const auto &call_site = retro::call_sites().get(std::u16string_view(function_name, function_name_length),
+                                                        std::u16string_view(source_file, source_file_length),
+                                                        source_line);
+        retro::log_at(level, call_site, std::u16string_view(message, length));
     }
 }
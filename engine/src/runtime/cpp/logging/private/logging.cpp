@@ -12,9 +12,27 @@ import spdlog;
 
 namespace retro
 {
+    namespace
+    {
+        constexpr auto log_pattern = "[%Y-%m-%d %H:%M:%S.%e] [%^%l%$] [%n] %v";
+    }
+
     void init_logger()
     {
         spdlog::set_default_logger(spdlog::stdout_color_mt("engine"));
-        spdlog::set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%^%l%$] [%n] %v");
+        spdlog::set_pattern(log_pattern);
+    }
+
+    std::shared_ptr<AsyncLogSink> init_async_logger(const AsyncLogOptions &options)
+    {
+        auto sink = std::make_shared<AsyncLogSink>(std::make_shared<spdlog::sinks::stdout_color_sink_mt>(), options);
+        spdlog::set_default_logger(std::make_shared<spdlog::logger>("engine", sink));
+        spdlog::set_pattern(log_pattern);
+        return sink;
+    }
+
+    void shutdown_logger()
+    {
+        spdlog::shutdown();
     }
 } // namespace retro
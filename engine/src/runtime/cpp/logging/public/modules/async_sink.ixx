@@ -0,0 +1,116 @@
+/**
+ * @file async_sink.ixx
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module;
+
+#include "retro/core/exports.h"
+
+export module retro.logging.async_sink;
+
+import spdlog;
+import std;
+
+namespace retro
+{
+    /**
+     * What a thread that logs into a full queue does.
+     */
+    export enum class LogOverflowPolicy : std::uint8_t
+    {
+        /**
+         * Wait for the background thread to make room. Nothing is lost, at the cost of stalling the caller.
+         */
+        block,
+
+        /**
+         * Throw the message away and only count it.
+         */
+        drop,
+
+        /**
+         * Throw the message away and have the background thread log how many were lost once it catches up.
+         */
+        drop_and_report
+    };
+
+    export struct AsyncLogOptions
+    {
+        /**
+         * Number of messages the queue can hold, rounded up to a power of two.
+         */
+        std::size_t capacity = 8192;
+        LogOverflowPolicy overflow_policy = LogOverflowPolicy::block;
+    };
+
+    /**
+     * A sink that hands messages to a background thread, which writes them to the wrapped sink. Logging threads only
+     * copy the formatted message into a preallocated ring, the target's formatting, I/O and locking all happen on the
+     * background thread.
+     *
+     * Records are written after the call returns, so the file and function names of their source location must have
+     * static storage duration, as those of std::source_location do.
+     */
+    export class RETRO_API AsyncLogSink final : public spdlog::sinks::sink
+    {
+      public:
+        explicit AsyncLogSink(spdlog::sink_ptr target, const AsyncLogOptions &options = {});
+
+        AsyncLogSink(const AsyncLogSink &) = delete;
+        AsyncLogSink(AsyncLogSink &&) = delete;
+
+        /**
+         * Writes out everything still queued before returning.
+         */
+        ~AsyncLogSink() override;
+
+        AsyncLogSink &operator=(const AsyncLogSink &) = delete;
+        AsyncLogSink &operator=(AsyncLogSink &&) = delete;
+
+        void log(const spdlog::details::log_msg &msg) override;
+
+        /**
+         * Waits until every message logged before the call has reached the target, then flushes the target.
+         */
+        void flush() override;
+
+        void set_pattern(const std::string &pattern) override;
+
+        void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override;
+
+        [[nodiscard]] std::uint64_t dropped_count() const noexcept
+        {
+            return dropped_.load(std::memory_order_relaxed);
+        }
+
+      private:
+        struct Cell;
+
+        bool try_push(const spdlog::details::log_msg &msg);
+        bool write_next();
+        [[nodiscard]] bool has_next() const noexcept;
+        void report_dropped();
+        void wake();
+        void run(const std::stop_token &stop_token);
+
+        spdlog::sink_ptr target_;
+        LogOverflowPolicy overflow_policy_;
+        std::size_t capacity_;
+        std::unique_ptr<Cell[]> cells_;
+
+        alignas(64) std::atomic<std::size_t> enqueue_position_{0};
+
+        // Only touched by the background thread, apart from written_ which flush waits on
+        alignas(64) std::size_t dequeue_position_ = 0;
+        std::atomic<std::size_t> written_{0};
+        std::uint64_t reported_dropped_ = 0;
+
+        alignas(64) std::atomic<std::uint64_t> dropped_{0};
+        std::atomic<std::uint32_t> wake_signal_{0};
+        std::atomic<bool> sleeping_{false};
+
+        std::jthread thread_;
+    };
+} // namespace retro
@@ -8,11 +8,16 @@ module;
 
 #include "retro/core/exports.h"
 
+#ifndef RETRO_LOG_MIN_LEVEL
+#define RETRO_LOG_MIN_LEVEL 0
+#endif
+
 export module retro.logging;
 
 import retro.core.strings.cstring_view;
 import retro.core.strings.encoding;
 import retro.core.type_traits.basic;
+import retro.logging.async_sink;
 import spdlog;
 import std;
 
@@ -97,6 +102,25 @@ namespace retro
         }
     }
 
+    /**
+     * The lowest level that is compiled in at all, set through the RETRO_LOG_MIN_LEVEL CMake option. Calls below it are
+     * discarded at compile time, so they cost nothing even inside hot loops.
+     */
+    export constexpr LogLevel min_compiled_log_level = static_cast<LogLevel>(RETRO_LOG_MIN_LEVEL);
+
+    export constexpr bool is_log_level_compiled(const LogLevel level)
+    {
+        return level >= min_compiled_log_level && level != LogLevel::off;
+    }
+
+    /**
+     * A callable producing a log message, which is only invoked if the message is actually written.
+     */
+    export template <typename F>
+    concept LogMessageFactory =
+        std::invocable<F> && (std::convertible_to<std::invoke_result_t<F>, std::string_view> ||
+                              std::convertible_to<std::invoke_result_t<F>, std::u16string_view>);
+
     export class Logger
     {
       public:
@@ -115,6 +139,15 @@ namespace retro
         {
         }
 
+        /**
+         * Whether a message at the given level would be written. Checked before any message is converted or
+         * formatted.
+         */
+        [[nodiscard]] bool should_log(const LogLevel level) const noexcept
+        {
+            return is_log_level_compiled(level) && logger_->should_log(to_spd_level(level));
+        }
+
         template <Char T>
         void log(const LogLevel level, const T *message)
         {
@@ -124,6 +157,9 @@ namespace retro
         template <Char T>
         void log(const LogLevel level, std::basic_string_view<T> message)
         {
+            if (!should_log(level))
+                return;
+
             if constexpr (std::is_same_v<T, char>)
             {
                 logger_->log(location_, to_spd_level(level), message);
@@ -138,116 +174,247 @@ namespace retro
         template <typename... Args>
         void log(const LogLevel level, const std::format_string<Args...> fmt, Args &&...args)
         {
+            if (!should_log(level))
+                return;
+
             auto message = std::format(fmt, std::forward<Args>(args)...);
             logger_->log(location_, to_spd_level(level), message);
         }
 
-        template <Char T>
-        void trace(const std::basic_string_view<T> message)
+        /**
+         * Builds the message only if it is going to be written, for messages that are expensive to put together.
+         */
+        template <LogMessageFactory Factory>
+        void log(const LogLevel level, Factory &&factory)
         {
-            log(LogLevel::trace, message);
+            if (!should_log(level))
+                return;
+
+            const auto message = std::invoke(std::forward<Factory>(factory));
+            if constexpr (std::convertible_to<decltype(message), std::string_view>)
+            {
+                log(level, std::string_view{message});
+            }
+            else
+            {
+                log(level, std::u16string_view{message});
+            }
         }
 
         template <Char T>
         void trace(const T *message)
         {
-            log(LogLevel::trace, message);
+            if constexpr (is_log_level_compiled(LogLevel::trace))
+            {
+                log(LogLevel::trace, message);
+            }
+        }
+
+        template <Char T>
+        void trace(const std::basic_string_view<T> message)
+        {
+            if constexpr (is_log_level_compiled(LogLevel::trace))
+            {
+                log(LogLevel::trace, message);
+            }
         }
 
         template <typename... Args>
         void trace(const std::format_string<Args...> fmt, Args &&...args)
         {
-            log(LogLevel::trace, fmt, std::forward<Args>(args)...);
+            if constexpr (is_log_level_compiled(LogLevel::trace))
+            {
+                log(LogLevel::trace, fmt, std::forward<Args>(args)...);
+            }
+        }
+
+        template <LogMessageFactory Factory>
+        void trace(Factory &&factory)
+        {
+            if constexpr (is_log_level_compiled(LogLevel::trace))
+            {
+                log(LogLevel::trace, std::forward<Factory>(factory));
+            }
         }
 
         template <Char T>
         void debug(const T *message)
         {
-            log(LogLevel::debug, message);
+            if constexpr (is_log_level_compiled(LogLevel::debug))
+            {
+                log(LogLevel::debug, message);
+            }
         }
 
         template <Char T>
         void debug(const std::basic_string_view<T> message)
         {
-            log(LogLevel::debug, message);
+            if constexpr (is_log_level_compiled(LogLevel::debug))
+            {
+                log(LogLevel::debug, message);
+            }
         }
 
         template <typename... Args>
         void debug(const std::format_string<Args...> fmt, Args &&...args)
         {
-            log(LogLevel::debug, fmt, std::forward<Args>(args)...);
+            if constexpr (is_log_level_compiled(LogLevel::debug))
+            {
+                log(LogLevel::debug, fmt, std::forward<Args>(args)...);
+            }
+        }
+
+        template <LogMessageFactory Factory>
+        void debug(Factory &&factory)
+        {
+            if constexpr (is_log_level_compiled(LogLevel::debug))
+            {
+                log(LogLevel::debug, std::forward<Factory>(factory));
+            }
         }
 
         template <Char T>
         void info(const T *message)
         {
-            log(LogLevel::info, message);
+            if constexpr (is_log_level_compiled(LogLevel::info))
+            {
+                log(LogLevel::info, message);
+            }
         }
 
         template <Char T>
         void info(const std::basic_string_view<T> message)
         {
-            log(LogLevel::info, message);
+            if constexpr (is_log_level_compiled(LogLevel::info))
+            {
+                log(LogLevel::info, message);
+            }
         }
 
         template <typename... Args>
         void info(const std::format_string<Args...> fmt, Args &&...args)
         {
-            log(LogLevel::info, fmt, std::forward<Args>(args)...);
+            if constexpr (is_log_level_compiled(LogLevel::info))
+            {
+                log(LogLevel::info, fmt, std::forward<Args>(args)...);
+            }
+        }
+
+        template <LogMessageFactory Factory>
+        void info(Factory &&factory)
+        {
+            if constexpr (is_log_level_compiled(LogLevel::info))
+            {
+                log(LogLevel::info, std::forward<Factory>(factory));
+            }
         }
 
         template <Char T>
         void warn(const T *message)
         {
-            log(LogLevel::warn, message);
+            if constexpr (is_log_level_compiled(LogLevel::warn))
+            {
+                log(LogLevel::warn, message);
+            }
         }
 
         template <Char T>
         void warn(const std::basic_string_view<T> message)
         {
-            log(LogLevel::warn, message);
+            if constexpr (is_log_level_compiled(LogLevel::warn))
+            {
+                log(LogLevel::warn, message);
+            }
         }
 
         template <typename... Args>
         void warn(const std::format_string<Args...> fmt, Args &&...args)
         {
-            log(LogLevel::warn, fmt, std::forward<Args>(args)...);
+            if constexpr (is_log_level_compiled(LogLevel::warn))
+            {
+                log(LogLevel::warn, fmt, std::forward<Args>(args)...);
+            }
+        }
+
+        template <LogMessageFactory Factory>
+        void warn(Factory &&factory)
+        {
+            if constexpr (is_log_level_compiled(LogLevel::warn))
+            {
+                log(LogLevel::warn, std::forward<Factory>(factory));
+            }
         }
 
         template <Char T>
         void error(const T *message)
         {
-            log(LogLevel::error, message);
+            if constexpr (is_log_level_compiled(LogLevel::error))
+            {
+                log(LogLevel::error, message);
+            }
         }
 
         template <Char T>
         void error(const std::basic_string_view<T> message)
         {
-            log(LogLevel::error, message);
+            if constexpr (is_log_level_compiled(LogLevel::error))
+            {
+                log(LogLevel::error, message);
+            }
         }
 
         template <typename... Args>
         void error(const std::format_string<Args...> fmt, Args &&...args)
         {
-            log(LogLevel::error, fmt, std::forward<Args>(args)...);
+            if constexpr (is_log_level_compiled(LogLevel::error))
+            {
+                log(LogLevel::error, fmt, std::forward<Args>(args)...);
+            }
+        }
+
+        template <LogMessageFactory Factory>
+        void error(Factory &&factory)
+        {
+            if constexpr (is_log_level_compiled(LogLevel::error))
+            {
+                log(LogLevel::error, std::forward<Factory>(factory));
+            }
         }
 
         template <Char T>
         void critical(const T *message)
         {
-            log(LogLevel::critical, message);
+            if constexpr (is_log_level_compiled(LogLevel::critical))
+            {
+                log(LogLevel::critical, message);
+            }
         }
 
         template <Char T>
         void critical(const std::basic_string_view<T> message)
         {
-            log(LogLevel::critical, message);
+            if constexpr (is_log_level_compiled(LogLevel::critical))
+            {
+                log(LogLevel::critical, message);
+            }
         }
 
         template <typename... Args>
         void critical(const std::format_string<Args...> fmt, Args &&...args)
         {
-            log(LogLevel::critical, fmt, std::forward<Args>(args)...);
+            if constexpr (is_log_level_compiled(LogLevel::critical))
+            {
+                log(LogLevel::critical, fmt, std::forward<Args>(args)...);
+            }
+        }
+
+        template <LogMessageFactory Factory>
+        void critical(Factory &&factory)
+        {
+            if constexpr (is_log_level_compiled(LogLevel::critical))
+            {
+                log(LogLevel::critical, std::forward<Factory>(factory));
+            }
         }
 
       private:
@@ -257,6 +424,20 @@ namespace retro
 
     export RETRO_API void init_logger();
 
+    /**
+     * Sets up the default logger like init_logger, except that messages are written by a background thread instead of
+     * the thread that logs them.
+     *
+     * @return The sink in front of the console, e.g. to query how many messages it dropped.
+     */
+    export RETRO_API std::shared_ptr<AsyncLogSink> init_async_logger(const AsyncLogOptions &options = {});
+
+    /**
+     * Flushes and releases every logger. With an asynchronous logger this waits for the background thread to write
+     * out what is still queued.
+     */
+    export RETRO_API void shutdown_logger();
+
     export inline Logger get_logger(spdlog::logger *logger = spdlog::default_logger_raw(),
                                     const std::source_location &location = std::source_location::current())
     {
@@ -38,20 +38,22 @@ namespace retro
 
     Optional<PlatformEvent> HeadlessPlatformBackend::poll_event()
     {
-        return std::nullopt;
+        return events_.pop();
     }
 
+    // Nothing outside of push_event can produce an event, so waiting would only ever stall a headless loop
     Optional<PlatformEvent> HeadlessPlatformBackend::wait_for_event()
     {
-        return std::nullopt;
+        return events_.pop();
     }
 
-    Optional<PlatformEvent> HeadlessPlatformBackend::wait_for_event(std::chrono::milliseconds timeout)
+    Optional<PlatformEvent> HeadlessPlatformBackend::wait_for_event(std::chrono::milliseconds)
     {
-        return std::nullopt;
+        return events_.pop();
     }
 
     void HeadlessPlatformBackend::push_event(PlatformEvent event)
     {
+        events_.push(std::move(event));
     }
 } // namespace retro
@@ -8,6 +8,7 @@ export module retro.platform.headless.backend;
 
 import std;
 import retro.core.containers.optional;
+import retro.core.containers.mpsc_queue;
 import retro.core.async.task;
 import retro.platform.backend;
 import retro.platform.event;
@@ -15,6 +16,10 @@ import retro.platform.window;
 
 namespace retro
 {
+    /**
+     * A platform without a display. It never produces events of its own, so the only events it hands out are the
+     * ones pushed into it, which is what input replay relies on.
+     */
     export class HeadlessPlatformBackend final : public PlatformBackend
     {
       public:
@@ -35,5 +40,8 @@ namespace retro
         Optional<PlatformEvent> wait_for_event(std::chrono::milliseconds timeout) override;
 
         void push_event(PlatformEvent event) override;
+
+      private:
+        MpscQueue<PlatformEvent> events_;
     };
 } // namespace retro
@@ -17,9 +17,12 @@ namespace retro
     VulkanBufferManager::VulkanBufferManager(vk::UniqueBuffer buffer,
                                              vk::UniqueDeviceMemory memory,
                                              void *mapped_ptr,
-                                             const std::size_t pool_size)
+                                             const std::size_t pool_size,
+                                             const std::size_t allocation_size)
         : buffer_{std::move(buffer)}, memory_{std::move(memory)}, mapped_ptr_{mapped_ptr}, pool_size_{pool_size}
     {
+        // The whole device allocation is held for as long as the manager lives, however much of it a frame uses
+        buffer_memory_.resize(allocation_size);
     }
 
     TransientAllocation VulkanBufferManager::allocate_transient(const std::size_t size, vk::BufferUsageFlags usage)
@@ -7,6 +7,7 @@
 export module retro.renderer.vulkan.components.buffer_manager;
 
 import vulkan;
+import retro.core.memory.memory_tracking;
 
 namespace retro
 {
@@ -23,7 +24,8 @@ namespace retro
         explicit VulkanBufferManager(vk::UniqueBuffer buffer,
                                      vk::UniqueDeviceMemory memory,
                                      void *mapped_ptr,
-                                     std::size_t pool_size);
+                                     std::size_t pool_size,
+                                     std::size_t allocation_size);
 
         TransientAllocation allocate_transient(std::size_t size, vk::BufferUsageFlags usage);
 
@@ -35,5 +37,6 @@ namespace retro
         void *mapped_ptr_ = nullptr;
         std::size_t pool_size_ = 0;
         std::size_t current_offset_ = 0;
+        TrackedMemory buffer_memory_{MemoryTag::gpu_buffers};
     };
 } // namespace retro
@@ -167,6 +167,12 @@ namespace retro
         {
             std::ignore = queue_mutexes_[present_family_index_];
         }
+
+        if (const auto families = physical_device_.getQueueFamilyProperties();
+            families.at(graphics_family_index_).timestampValidBits > 0)
+        {
+            timestamp_period_ = physical_device_.getProperties().limits.timestampPeriod;
+        }
     }
 
     std::unique_ptr<VulkanDevice> VulkanDevice::create(const VulkanInstance &instance,
@@ -213,7 +219,7 @@ namespace retro
         auto memory = device_->allocateMemoryUnique(alloc_info);
         device_->bindBufferMemory(buffer.get(), memory.get(), 0);
         const auto mapped_ptr = device_->mapMemory(memory.get(), 0, pool_size);
-        return VulkanBufferManager(std::move(buffer), std::move(memory), mapped_ptr, pool_size);
+        return VulkanBufferManager(std::move(buffer), std::move(memory), mapped_ptr, pool_size, mem_reqs.size);
     }
 
     VulkanStagingBuffer VulkanDevice::create_staging_buffer(vk::DeviceSize size) const
@@ -115,6 +115,36 @@ namespace retro
             return present_family_index_;
         }
 
+        /**
+         * Nanoseconds per timestamp tick on the graphics queue, or zero if that queue cannot write timestamps.
+         */
+        [[nodiscard]] float timestamp_period() const noexcept
+        {
+            return timestamp_period_;
+        }
+
+        inline vk::UniqueQueryPool create_query_pool(const vk::QueryPoolCreateInfo &create_info) const
+        {
+            return device_->createQueryPoolUnique(create_info);
+        }
+
+        /**
+         * Reads 64-bit query results without waiting, returns false if any of them is not available yet.
+         */
+        inline bool get_query_results(const vk::QueryPool pool,
+                                      const std::uint32_t first_query,
+                                      const std::span<std::uint64_t> results) const
+        {
+            const auto result = device_->getQueryPoolResults(pool,
+                                                             first_query,
+                                                             static_cast<std::uint32_t>(results.size()),
+                                                             results.size_bytes(),
+                                                             results.data(),
+                                                             sizeof(std::uint64_t),
+                                                             vk::QueryResultFlagBits::e64);
+            return result == vk::Result::eSuccess;
+        }
+
         inline vk::SurfaceCapabilitiesKHR get_surface_capabilities(const vk::SurfaceKHR surface) const
         {
             return physical_device_.getSurfaceCapabilitiesKHR(surface);
@@ -276,6 +306,7 @@ namespace retro
         vk::UniqueDevice device_{};
         std::uint32_t graphics_family_index_{std::numeric_limits<std::uint32_t>::max()};
         std::uint32_t present_family_index_{std::numeric_limits<std::uint32_t>::max()};
+        float timestamp_period_ = 0;
         vk::Queue graphics_queue_{};
         vk::Queue present_queue_{};
 
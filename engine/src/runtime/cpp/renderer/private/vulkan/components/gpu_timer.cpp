@@ -0,0 +1,125 @@
+/**
+ * @file gpu_timer.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module;
+
+#if __JETBRAINS_IDE__
+#include <vulkan/vulkan.hpp>
+#endif
+
+module retro.renderer.vulkan.components.gpu_timer;
+
+import retro.core.profiling;
+
+namespace retro
+{
+    VulkanGpuTimer::VulkanGpuTimer(VulkanDevice &device, const std::uint32_t frames_in_flight)
+        : device_{device}, ns_per_tick_{device.timestamp_period()}
+    {
+        if (!is_supported())
+            return;
+
+        frames_.resize(frames_in_flight);
+        for (auto &frame : frames_)
+        {
+            frame.pool = device_.create_query_pool(
+                vk::QueryPoolCreateInfo{.queryType = vk::QueryType::eTimestamp, .queryCount = max_scopes * 2});
+            frame.scopes.reserve(max_scopes);
+        }
+    }
+
+    void VulkanGpuTimer::begin_frame(const vk::CommandBuffer cmd, const std::uint32_t frame_index)
+    {
+        if (!is_supported())
+            return;
+
+        auto &frame = frames_.at(frame_index);
+        report(frame);
+
+        cmd.resetQueryPool(frame.pool.get(), 0, max_scopes * 2);
+        current_ = &frame;
+    }
+
+    void VulkanGpuTimer::end_frame() noexcept
+    {
+        current_ = nullptr;
+    }
+
+    std::uint32_t VulkanGpuTimer::begin_scope(const vk::CommandBuffer cmd, const char *name)
+    {
+        if (current_ == nullptr || current_->scopes.size() == max_scopes)
+            return invalid_scope;
+
+        const auto scope = static_cast<std::uint32_t>(current_->scopes.size());
+        current_->scopes.push_back(Scope{.name = name});
+        cmd.writeTimestamp(vk::PipelineStageFlagBits::eTopOfPipe, current_->pool.get(), scope * 2);
+        return scope;
+    }
+
+    void VulkanGpuTimer::end_scope(const vk::CommandBuffer cmd, const std::uint32_t scope)
+    {
+        if (current_ == nullptr || scope == invalid_scope)
+            return;
+
+        current_->scopes[scope].ended = true;
+        cmd.writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe, current_->pool.get(), scope * 2 + 1);
+    }
+
+    bool VulkanGpuTimer::read_ended_scopes(const FrameQueries &frame)
+    {
+        // A scope that was begun but never ended leaves its end query unavailable, which would fail a single read of
+        // the whole range, so only runs of consecutive ended scopes are read back and the unmatched ones are dropped
+        std::size_t run_start = 0;
+        for (std::size_t index = 0; index <= frame.scopes.size(); ++index)
+        {
+            if (index < frame.scopes.size() && frame.scopes[index].ended)
+                continue;
+
+            if (index > run_start)
+            {
+                const auto results = std::span{timestamps_}.subspan(run_start * 2, (index - run_start) * 2);
+                if (!device_.get_query_results(frame.pool.get(), static_cast<std::uint32_t>(run_start * 2), results))
+                    return false;
+            }
+            run_start = index + 1;
+        }
+
+        return true;
+    }
+
+    void VulkanGpuTimer::report(FrameQueries &frame)
+    {
+        if (!frame.scopes.empty() && read_ended_scopes(frame))
+        {
+            // Scopes with the same name, like a pipeline drawn into several viewports, add up to one timing
+            std::vector<std::pair<const char *, double>> totals;
+            for (const auto [index, scope] : frame.scopes | std::views::enumerate)
+            {
+                if (!scope.ended)
+                    continue;
+
+                const auto ticks = timestamps_[index * 2 + 1] - timestamps_[index * 2];
+                const auto milliseconds = static_cast<double>(ticks) * ns_per_tick_ / 1'000'000.0;
+                if (const auto total = std::ranges::find(totals, scope.name, &std::pair<const char *, double>::first);
+                    total != totals.end())
+                {
+                    total->second += milliseconds;
+                }
+                else
+                {
+                    totals.emplace_back(scope.name, milliseconds);
+                }
+            }
+
+            for (const auto &[name, milliseconds] : totals)
+            {
+                record_gpu_timing(name, milliseconds);
+            }
+        }
+
+        frame.scopes.clear();
+    }
+} // namespace retro
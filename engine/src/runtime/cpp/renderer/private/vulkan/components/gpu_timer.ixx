@@ -0,0 +1,85 @@
+/**
+ * @file gpu_timer.ixx
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module;
+
+#if __JETBRAINS_IDE__
+#include <vulkan/vulkan.hpp>
+#endif
+
+export module retro.renderer.vulkan.components.gpu_timer;
+
+import std;
+import vulkan;
+import retro.renderer.vulkan.components.device;
+
+namespace retro
+{
+    /**
+     * Times scopes of a command buffer with timestamp queries. Every frame in flight has its own query pool, which is
+     * read back the next time that frame slot comes around, so results arrive max_frames_in_flight frames late but
+     * never stall the CPU waiting on the GPU.
+     */
+    export class VulkanGpuTimer
+    {
+      public:
+        static constexpr std::uint32_t invalid_scope = std::numeric_limits<std::uint32_t>::max();
+
+        VulkanGpuTimer(VulkanDevice &device, std::uint32_t frames_in_flight);
+
+        [[nodiscard]] bool is_supported() const noexcept
+        {
+            return ns_per_tick_ > 0;
+        }
+
+        /**
+         * Reports the timings the slot recorded last time around and resets its queries. Has to be recorded outside
+         * of a render pass, after the slot's fence has been waited on.
+         */
+        void begin_frame(vk::CommandBuffer cmd, std::uint32_t frame_index);
+
+        /**
+         * Stops timing the current frame, the slot's queries are not read back until it is begun again.
+         */
+        void end_frame() noexcept;
+
+        /**
+         * Writes the start timestamp of a scope. Returns invalid_scope while no frame is being timed or once the
+         * slot's queries are used up, which end_scope ignores.
+         */
+        std::uint32_t begin_scope(vk::CommandBuffer cmd, const char *name);
+
+        void end_scope(vk::CommandBuffer cmd, std::uint32_t scope);
+
+      private:
+        static constexpr std::uint32_t max_scopes = 64;
+
+        struct Scope
+        {
+            const char *name;
+            bool ended = false;
+        };
+
+        struct FrameQueries
+        {
+            vk::UniqueQueryPool pool;
+            std::vector<Scope> scopes;
+        };
+
+        /**
+         * Reads back the timestamps of every scope that was ended, returns false if any of them isn't available yet.
+         */
+        bool read_ended_scopes(const FrameQueries &frame);
+
+        void report(FrameQueries &frame);
+
+        VulkanDevice &device_;
+        double ns_per_tick_ = 0;
+        std::vector<FrameQueries> frames_;
+        FrameQueries *current_ = nullptr;
+        std::array<std::uint64_t, max_scopes * 2> timestamps_{};
+    };
+} // namespace retro
@@ -493,13 +493,16 @@ namespace retro
         const vk::CommandBuffer cmd,
         const Vector2u viewport_size,
         const std::span<const SmallUniquePtr<DrawCommandSource>> draw_command_sources,
-        const vk::DescriptorPool descriptor_pool)
+        const vk::DescriptorPool descriptor_pool,
+        VulkanGpuTimer &gpu_timer)
     {
         for (auto &source : draw_command_sources)
         {
             auto &pipeline = pipelines_.at(source->component_type());
             auto draw_commands = source->get_draw_commands();
+            const auto scope = gpu_timer.begin_scope(cmd, pipeline.name());
             pipeline.bind_and_render(cmd, viewport_size, draw_commands, descriptor_pool);
+            gpu_timer.end_scope(cmd, scope);
         }
     }
 } // namespace retro
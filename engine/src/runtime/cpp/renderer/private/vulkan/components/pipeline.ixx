@@ -11,6 +11,7 @@ import retro.core.math.vector;
 import vulkan;
 import retro.renderer.vulkan.components.device;
 import retro.renderer.vulkan.components.buffer_manager;
+import retro.renderer.vulkan.components.gpu_timer;
 import retro.runtime.world.viewport;
 import retro.runtime.rendering.draw_command;
 import retro.core.memory.small_unique_ptr;
@@ -33,6 +34,11 @@ namespace retro
 
         void recreate(VulkanDevice &device, vk::Extent2D extent, vk::RenderPass render_pass);
 
+        [[nodiscard]] const char *name() const
+        {
+            return pipeline_.name();
+        }
+
         void bind_and_render(vk::CommandBuffer cmd,
                              Vector2u viewport_size,
                              std::span<const DrawCommand> draw_commands,
@@ -74,10 +80,14 @@ namespace retro
 
         void destroy_pipeline(std::type_index type);
 
+        /**
+         * Renders every source with its pipeline, timing each one on the GPU while the timer has a frame going.
+         */
         void bind_and_render(vk::CommandBuffer cmd,
                              Vector2u viewport_size,
                              std::span<const SmallUniquePtr<DrawCommandSource>> draw_command_sources,
-                             vk::DescriptorPool descriptor_pool);
+                             vk::DescriptorPool descriptor_pool,
+                             VulkanGpuTimer &gpu_timer);
 
       private:
         VulkanDevice &device_;
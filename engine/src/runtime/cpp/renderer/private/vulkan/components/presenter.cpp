@@ -11,10 +11,12 @@ module;
 #endif
 
 #include <cassert>
+#include "retro/core/profiling.hpp"
 
 module retro.renderer.vulkan.components.presenter;
 
 import retro.logging;
+import retro.core.profiling;
 import retro.core.util.exceptions;
 
 namespace retro
@@ -90,7 +92,7 @@ namespace retro
                                      const vk::CommandPool command_pool,
                                      VulkanPipelineManager &pipeline_manager)
         : window_{window}, surface_{surface}, device_{device}, command_pool_{command_pool},
-          pipeline_manager_{pipeline_manager}
+          pipeline_manager_{pipeline_manager}, gpu_timer_{device, max_frames_in_flight}
     {
         auto [width, height] = window.size();
         create_swapchain(width, height);
@@ -173,6 +175,7 @@ namespace retro
     }
     void VulkanPresenter::submit_and_present(const std::stop_token &stop_token)
     {
+        RETRO_PROFILE_SCOPE("VulkanPresenter::submit_and_present");
         const auto in_flight = frame_resources_.at(current_frame_).in_flight.get();
         auto cmd = frame_resources_.at(current_frame_).command_buffer.get();
         cmd.reset();
@@ -252,6 +255,7 @@ namespace retro
 
     void VulkanPresenter::record_command_buffer(vk::CommandBuffer cmd, const std::stop_token &stop_token)
     {
+        RETRO_PROFILE_SCOPE("VulkanPresenter::record_command_buffer");
         constexpr vk::CommandBufferBeginInfo begin_info{};
 
         cmd.begin(begin_info);
@@ -260,6 +264,19 @@ namespace retro
                              cmd.end();
                          }};
 
+        if (is_gpu_timing_enabled())
+        {
+            gpu_timer_.begin_frame(cmd, current_frame_);
+        }
+
+        // Declared ahead of the render pass so its end timestamp is written after the pass has ended
+        const auto render_pass_scope = gpu_timer_.begin_scope(cmd, "RenderPass");
+        Deferred end_gpu_timing{[this, cmd, render_pass_scope]
+                                {
+                                    gpu_timer_.end_scope(cmd, render_pass_scope);
+                                    gpu_timer_.end_frame();
+                                }};
+
         // ReSharper disable once CppDFAUnusedValue
         // ReSharper disable once CppDFAUnreadVariable
         vk::ClearValue color_clear_value{.color = vk::ClearColorValue{.float32 = std::array{0.0f, 0.0f, 0.0f, 1.0f}}};
@@ -306,8 +323,14 @@ namespace retro
                     cmd.setViewport(0, vp);
                     cmd.setScissor(0, scissor);
 
-                    pipeline_manager_.bind_and_render(cmd, framebuffer_size, draw_command.sources, descriptor_pool);
+                    pipeline_manager_.bind_and_render(cmd,
+                                                      framebuffer_size,
+                                                      draw_command.sources,
+                                                      descriptor_pool,
+                                                      gpu_timer_);
                 }
+
+                frame_arena_stats_ = slot.memory_resource.stats();
             },
             stop_token);
     }
@@ -9,7 +9,9 @@ export module retro.renderer.vulkan.components.presenter;
 import vulkan;
 import retro.core.functional.delegate;
 import retro.core.memory.arena_allocator;
+import retro.core.memory.memory_tracking;
 import retro.renderer.vulkan.components.device;
+import retro.renderer.vulkan.components.gpu_timer;
 import retro.renderer.vulkan.components.pipeline;
 import retro.platform.window;
 import retro.runtime.rendering.render_pipeline;
@@ -43,9 +45,15 @@ namespace retro
 
     struct PendingFrameSlot
     {
-        static constexpr std::size_t arena_size = 20 * 1024 * 1024;
-
-        SingleArenaMemoryResource memory_resource{std::in_place, arena_size};
+        static constexpr std::size_t arena_block_size = 1024 * 1024;
+        static constexpr std::size_t retained_arena_blocks = 20;
+
+        MultiArenaMemoryResource memory_resource{std::in_place,
+                                                 arena_block_size,
+                                                 1,
+                                                 std::numeric_limits<std::size_t>::max(),
+                                                 retained_arena_blocks,
+                                                 MemoryTag::frame_arenas};
         std::pmr::vector<DrawCommandSet> pending_commands{&memory_resource};
 
         void reset() noexcept;
@@ -77,6 +85,14 @@ namespace retro
 
         void recreate_swapchain();
 
+        /**
+         * Usage of the arena behind the most recently recorded frame. Only meaningful on the render thread.
+         */
+        [[nodiscard]] const ArenaStats &frame_arena_stats() const noexcept
+        {
+            return frame_arena_stats_;
+        }
+
       private:
         void record_command_buffer(vk::CommandBuffer cmd, const std::stop_token &stop_token);
 
@@ -87,6 +103,7 @@ namespace retro
         VulkanDevice &device_;
         vk::CommandPool command_pool_;
         VulkanPipelineManager &pipeline_manager_;
+        VulkanGpuTimer gpu_timer_;
 
         vk::UniqueSwapchainKHR swapchain_;
         vk::UniqueRenderPass render_pass_;
@@ -100,5 +117,6 @@ namespace retro
         std::uint32_t current_frame_ = 0;
         std::uint32_t image_index_ = 0;
         bool frame_in_flight_ = false;
+        ArenaStats frame_arena_stats_{};
     };
 } // namespace retro
@@ -19,6 +19,7 @@ import vulkan;
 import std;
 import retro.runtime.rendering.draw_command;
 import retro.core.memory.arena_allocator;
+import retro.core.memory.memory_tracking;
 import retro.core.memory.ref_counted_ptr;
 import retro.renderer.vulkan.vulkan_render_backend;
 
@@ -29,7 +30,7 @@ namespace retro
         static constexpr std::size_t arena_size = 20 * 1024 * 1024;
 
         vk::UniqueCommandBuffer command_buffer;
-        SingleArenaMemoryResource memory_resource{std::in_place, arena_size};
+        SingleArenaMemoryResource memory_resource{std::in_place, arena_size, MemoryTag::frame_arenas};
 
         vk::UniqueSemaphore image_available;
         vk::UniqueFence in_flight;
@@ -18,6 +18,7 @@ import retro.platform.event;
 import retro.core.memory.small_unique_ptr;
 import retro.runtime.rendering.draw_command;
 import retro.core.type_traits.variant;
+import retro.core.util.exceptions;
 
 namespace retro
 {
@@ -29,14 +30,17 @@ namespace retro
 
     void Engine::wait_platform_event(const std::chrono::milliseconds timeout)
     {
+        pump_input_replay();
         if (auto event = platform_backend_.wait_for_event(timeout))
         {
             handle_platform_event(*event);
         }
+        flush_input_recording();
     }
 
     void Engine::poll_events_once()
     {
+        pump_input_replay();
         while (auto event = platform_backend_.poll_event())
         {
             if (!handle_platform_event(*event))
@@ -45,10 +49,93 @@ namespace retro
                 break;
             }
         }
+        flush_input_recording();
+    }
+
+    void Engine::start_input_recording(const std::filesystem::path &path)
+    {
+        // The file is opened and the old recording flushed outside the lock, so event handling never waits on either
+        auto recorder = std::make_unique<InputRecorder>(path);
+        {
+            std::scoped_lock lock{input_capture_mutex_};
+            std::swap(input_recorder_, recorder);
+        }
+    }
+
+    void Engine::stop_input_recording()
+    {
+        std::unique_ptr<InputRecorder> recorder;
+        {
+            std::scoped_lock lock{input_capture_mutex_};
+            std::swap(input_recorder_, recorder);
+        }
+    }
+
+    void Engine::start_input_replay(const std::filesystem::path &path, const ReplayPace pace)
+    {
+        auto replayer = std::make_unique<InputReplayer>(read_input_recording(path), pace);
+        {
+            std::scoped_lock lock{input_capture_mutex_};
+            std::swap(input_replayer_, replayer);
+        }
+    }
+
+    bool Engine::is_replaying_input() const
+    {
+        std::scoped_lock lock{input_capture_mutex_};
+        return input_replayer_ != nullptr;
+    }
+
+    void Engine::flush_input_recording()
+    {
+        // Once a frame, so a crash only loses the events of the frame it happened in
+        std::scoped_lock lock{input_capture_mutex_};
+        if (input_recorder_ == nullptr)
+            return;
+
+        try
+        {
+            input_recorder_->flush();
+        }
+        catch (const IoException &ex)
+        {
+            // A recording is a debugging aid, losing it must not take the game down with it
+            get_logger().error("Stopped input recording: {}", ex.what());
+            input_recorder_.reset();
+        }
+    }
+
+    void Engine::pump_input_replay()
+    {
+        std::scoped_lock lock{input_capture_mutex_};
+        if (input_replayer_ == nullptr)
+            return;
+
+        input_replayer_->pump(platform_backend_, input_manager_.poll_count());
+        if (input_replayer_->finished())
+        {
+            input_replayer_.reset();
+        }
     }
 
     bool Engine::handle_platform_event(const PlatformEvent &event)
     {
+        {
+            std::scoped_lock lock{input_capture_mutex_};
+            if (input_recorder_ != nullptr)
+            {
+                try
+                {
+                    input_recorder_->record(input_manager_.poll_count(), event);
+                }
+                catch (const IoException &ex)
+                {
+                    get_logger().error("Stopped input recording: {}", ex.what());
+                    input_recorder_.reset();
+                }
+            }
+        }
+
         return std::visit(
             [&]<typename T>(const T &evt)
             {
@@ -4,26 +4,35 @@
  * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
  * Licensed under the MIT License. See LICENSE file in the project root for full license information.
  */
+module;
+
+#include "retro/core/profiling.hpp"
+
 module retro.runtime.event_manager;
 import retro.core.functional.overload;
+import retro.core.profiling;
+import retro.core.memory.frame_allocator;
 
 namespace retro
 {
 
     void EventManager::push_event(const EngineEvent &event)
     {
-        std::scoped_lock lock{event_mutex_};
-        pending_events_.push_back(event);
+        pending_events_.push(event);
     }
 
     void EventManager::poll_events()
     {
+        RETRO_PROFILE_SCOPE("EventManager::poll_events");
+
+        // Drain first, events raised by the handlers themselves are left for the next poll
+        std::pmr::vector<EngineEvent> polling_events{FrameAllocator::allocator<EngineEvent>()};
+        while (auto event = pending_events_.pop())
         {
-            std::scoped_lock lock{event_mutex_};
-            polling_events_.swap(pending_events_);
+            polling_events.push_back(std::move(*event));
         }
 
-        for (auto &event : polling_events_)
+        for (auto &event : polling_events)
         {
             std::visit(Overload{[this](const WindowResizedEvent &e)
                                 {
@@ -31,7 +40,5 @@ namespace retro
                                 }},
                        event);
         }
-
-        polling_events_.clear();
     }
 } // namespace retro
@@ -15,28 +15,20 @@ namespace retro
 
     void InputManager::push_event(const InputEvent &event)
     {
-        std::scoped_lock lock{mutex_};
-        event_write_queue_.push_back(event);
+        event_queue_.push(event);
     }
 
     void InputManager::poll_events(const std::uint64_t frame_count)
     {
         state_.begin_next_frame();
 
+        while (const auto event = event_queue_.pop())
         {
-            std::scoped_lock lock{mutex_};
-            event_read_queue_.swap(event_write_queue_);
-
-            for (auto &event : event_read_queue_)
-            {
-                apply_event(event);
-            }
-
-            event_read_queue_.clear();
+            apply_event(*event);
         }
 
-        previous_ = current_;
-        current_ = state_.snapshot(frame_count);
+        state_.advance_snapshot(current_, frame_count);
+        poll_count_.fetch_add(1, std::memory_order_release);
     }
 
     std::uint8_t InputManager::find_gamepad_mapping(const std::uint32_t platform_id) const
@@ -93,10 +85,19 @@ namespace retro
                                 switch (evt.change_type)
                                 {
                                     case GamepadChangeType::connected:
-                                        add_gamepad_mapping(evt.gamepad_id);
+                                        if (const auto index = add_gamepad_mapping(evt.gamepad_id);
+                                            index != index_none<std::uint8_t>)
+                                        {
+                                            state_.enable_gamepad(index, evt.gamepad_id);
+                                        }
                                         break;
                                     case GamepadChangeType::disconnected:
-                                        remove_gamepad_mapping(evt.gamepad_id);
+                                        if (const auto index = find_gamepad_mapping(evt.gamepad_id);
+                                            index != index_none<std::uint8_t>)
+                                        {
+                                            state_.disable_gamepad(index);
+                                            remove_gamepad_mapping(evt.gamepad_id);
+                                        }
                                         break;
                                 }
                             }},
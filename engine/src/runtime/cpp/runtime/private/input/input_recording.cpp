@@ -0,0 +1,317 @@
+/**
+ * @file input_recording.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module retro.runtime.input.input_recording;
+
+import retro.core.util.exceptions;
+import retro.logging;
+
+namespace retro
+{
+    namespace
+    {
+        constexpr std::array<char, 4> recording_magic{'R', 'I', 'N', 'P'};
+        constexpr std::uint16_t recording_version = 1;
+
+        // Small enough that a crash loses little of a long session, large enough that typing doesn't write every key
+        constexpr std::size_t recorder_flush_threshold = 4096;
+
+        /**
+         * Every record starts with the index of its event type in PlatformEvent, which means new event types may only
+         * ever be appended to the variant without bumping the version.
+         */
+        struct RecordingHeader
+        {
+            std::array<char, 4> magic = recording_magic;
+            std::uint16_t version = recording_version;
+            std::uint16_t reserved = 0;
+        };
+
+        template <typename T, typename Event>
+        concept EventRef = std::same_as<std::remove_const_t<T>, Event>;
+
+        // The fields of each event in the order they are stored, shared by reading and writing
+        auto fields(EventRef<QuitEvent> auto &)
+        {
+            return std::tuple{};
+        }
+
+        auto fields(EventRef<WindowCloseRequestedEvent> auto &event)
+        {
+            return std::tie(event.window_id);
+        }
+
+        auto fields(EventRef<WindowResizedEvent> auto &event)
+        {
+            return std::tie(event.window_id, event.width, event.height);
+        }
+
+        auto fields(EventRef<MouseMovedEvent> auto &event)
+        {
+            return std::tie(event.window_id, event.x, event.y, event.dx, event.dy);
+        }
+
+        auto fields(EventRef<MouseButtonEvent> auto &event)
+        {
+            return std::tie(event.window_id, event.button, event.down, event.x, event.y);
+        }
+
+        auto fields(EventRef<MouseWheelEvent> auto &event)
+        {
+            return std::tie(event.window_id,
+                            event.x,
+                            event.y,
+                            event.direction,
+                            event.mouse_x,
+                            event.mouse_y,
+                            event.mouse_ticks_x,
+                            event.mouse_ticks_y);
+        }
+
+        auto fields(EventRef<KeyEvent> auto &event)
+        {
+            return std::tie(event.window_id, event.logical_key, event.physical_key, event.down, event.repeat);
+        }
+
+        auto fields(EventRef<GamepadDeviceEvent> auto &event)
+        {
+            return std::tie(event.change_type, event.gamepad_id);
+        }
+
+        auto fields(EventRef<GamepadButtonEvent> auto &event)
+        {
+            return std::tie(event.gamepad_id, event.button, event.down);
+        }
+
+        auto fields(EventRef<GamepadAxisEvent> auto &event)
+        {
+            return std::tie(event.gamepad_id, event.axis, event.value);
+        }
+
+        template <typename T>
+        concept RecordableEvent = requires(T &event) { fields(event); };
+
+        template <typename T>
+        void append(std::vector<std::byte> &buffer, const T &value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            const auto bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+            buffer.insert(buffer.end(), bytes.begin(), bytes.end());
+        }
+
+        void append_varint(std::vector<std::byte> &buffer, std::uint64_t value)
+        {
+            while (value >= 0x80)
+            {
+                buffer.push_back(static_cast<std::byte>(value | 0x80));
+                value >>= 7;
+            }
+
+            buffer.push_back(static_cast<std::byte>(value));
+        }
+
+        class RecordReader
+        {
+          public:
+            explicit RecordReader(const std::span<const std::byte> data) : data_{data}
+            {
+            }
+
+            [[nodiscard]] bool at_end() const noexcept
+            {
+                return offset_ == data_.size();
+            }
+
+            template <typename T>
+            T read()
+            {
+                static_assert(std::is_trivially_copyable_v<T>);
+                if (data_.size() - offset_ < sizeof(T))
+                    throw IoException{"Input recording is truncated"};
+
+                std::array<std::byte, sizeof(T)> bytes;
+                std::memcpy(bytes.data(), data_.data() + offset_, sizeof(T));
+                offset_ += sizeof(T);
+                return std::bit_cast<T>(bytes);
+            }
+
+            std::uint64_t read_varint()
+            {
+                std::uint64_t value = 0;
+                for (std::uint32_t shift = 0; shift < 64; shift += 7)
+                {
+                    const auto byte = std::to_integer<std::uint64_t>(read<std::byte>());
+                    value |= (byte & 0x7F) << shift;
+                    if ((byte & 0x80) == 0)
+                        return value;
+                }
+
+                throw IoException{"Input recording contains a malformed number"};
+            }
+
+          private:
+            std::span<const std::byte> data_;
+            std::size_t offset_ = 0;
+        };
+
+        template <std::size_t Index = 0>
+        PlatformEvent read_event(RecordReader &reader, const std::size_t type)
+        {
+            if constexpr (Index == std::variant_size_v<PlatformEvent>)
+            {
+                throw IoException{"Input recording contains an unknown event type"};
+            }
+            else
+            {
+                using Event = std::variant_alternative_t<Index, PlatformEvent>;
+                if constexpr (RecordableEvent<Event>)
+                {
+                    if (type == Index)
+                    {
+                        Event event;
+                        std::apply([&reader](auto &...field)
+                                   { ((field = reader.read<std::remove_cvref_t<decltype(field)>>()), ...); },
+                                   fields(event));
+                        return event;
+                    }
+                }
+
+                return read_event<Index + 1>(reader, type);
+            }
+        }
+
+        std::vector<std::byte> read_file(const std::filesystem::path &path)
+        {
+            std::ifstream stream{path, std::ios::binary | std::ios::ate};
+            if (!stream)
+                throw IoException{std::format("Failed to open input recording {}", path.string())};
+
+            std::vector<std::byte> data(static_cast<std::size_t>(stream.tellg()));
+            stream.seekg(0);
+            stream.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
+            if (!stream)
+                throw IoException{std::format("Failed to read input recording {}", path.string())};
+
+            return data;
+        }
+    } // namespace
+
+    InputRecorder::InputRecorder(const std::filesystem::path &path) : stream_{path, std::ios::binary | std::ios::trunc}
+    {
+        if (!stream_)
+            throw IoException{std::format("Failed to create input recording {}", path.string())};
+
+        append(buffer_, RecordingHeader{});
+        flush();
+    }
+
+    InputRecorder::~InputRecorder()
+    {
+        try
+        {
+            flush();
+        }
+        catch (const IoException &ex)
+        {
+            get_logger().error("Dropped the end of an input recording: {}", ex.what());
+        }
+    }
+
+    void InputRecorder::record(const std::uint64_t frame, const PlatformEvent &event)
+    {
+        std::visit(
+            [&]<typename T>(const T &evt)
+            {
+                if constexpr (RecordableEvent<T>)
+                {
+                    const auto time = std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - start_);
+
+                    // Both deltas are non-negative as long as frames are recorded in order, which keeps them small
+                    append(buffer_, static_cast<std::uint8_t>(event.index()));
+                    append_varint(buffer_, frame - last_frame_);
+                    append_varint(buffer_, static_cast<std::uint64_t>((time - last_time_).count()));
+                    std::apply([this](const auto &...field) { (append(buffer_, field), ...); }, fields(evt));
+
+                    last_frame_ = frame;
+                    last_time_ = time;
+                    ++event_count_;
+                }
+            },
+            event);
+
+        if (buffer_.size() >= recorder_flush_threshold)
+        {
+            flush();
+        }
+    }
+
+    void InputRecorder::flush()
+    {
+        if (buffer_.empty())
+            return;
+
+        stream_.write(reinterpret_cast<const char *>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+        stream_.flush();
+        buffer_.clear();
+
+        // A full disk or a removed drive would otherwise just leave a silently truncated recording behind
+        if (!stream_)
+            throw IoException{"Failed to write input recording"};
+    }
+
+    std::vector<RecordedPlatformEvent> read_input_recording(const std::filesystem::path &path)
+    {
+        const auto data = read_file(path);
+        RecordReader reader{data};
+
+        if (const auto header = reader.read<RecordingHeader>();
+            header.magic != recording_magic || header.version != recording_version)
+        {
+            throw IoException{std::format("{} is not a supported input recording", path.string())};
+        }
+
+        std::vector<RecordedPlatformEvent> events;
+        std::uint64_t frame = 0;
+        std::chrono::microseconds time{};
+        while (!reader.at_end())
+        {
+            const auto type = reader.read<std::uint8_t>();
+            frame += reader.read_varint();
+            time += std::chrono::microseconds{reader.read_varint()};
+            events.push_back(RecordedPlatformEvent{.frame = frame, .time = time, .event = read_event(reader, type)});
+        }
+
+        return events;
+    }
+
+    InputReplayer::InputReplayer(std::vector<RecordedPlatformEvent> events, const ReplayPace pace)
+        : events_{std::move(events)}, pace_{pace}
+    {
+    }
+
+    std::size_t InputReplayer::pump(PlatformBackend &backend, const std::uint64_t frame)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (!start_.has_value())
+        {
+            start_ = now;
+        }
+
+        const auto start = next_;
+        while (next_ < events_.size() && events_[next_].frame <= frame)
+        {
+            auto &recorded = events_[next_];
+            if (pace_ == ReplayPace::real_time && now - *start_ < recorded.time)
+                break;
+
+            backend.push_event(std::move(recorded.event));
+            ++next_;
+        }
+
+        return next_ - start;
+    }
+} // namespace retro
@@ -9,18 +9,18 @@ module retro.runtime.input.input_state;
 namespace retro
 {
 
-    InputSnapshot InputState::snapshot(const std::uint64_t frame_index) const
+    void InputState::advance_snapshot(InputSnapshot &snapshot, const std::uint64_t frame_index) const
     {
-        return InputSnapshot{
-            .frame_index = frame_index,
-            .logical_keys = logical_keys_,
-            .physical_keys = physical_keys_,
-            .mouse_buttons = mouse_buttons_,
-            .mouse_position = mouse_position_,
-            .mouse_delta = mouse_delta_,
-            .mouse_wheel_delta = mouse_wheel_delta_,
-            .gamepads = gamepads_,
-        };
+        snapshot.frame_index = frame_index;
+        snapshot.previous_down = snapshot.down;
+        snapshot.down = down_;
+        snapshot.previous_gamepad_axes = snapshot.gamepad_axes;
+        snapshot.gamepad_axes = gamepad_axes_;
+        snapshot.connected_gamepads = connected_gamepads_;
+        snapshot.gamepad_platform_ids = gamepad_platform_ids_;
+        snapshot.mouse_position = mouse_position_;
+        snapshot.mouse_delta = mouse_delta_;
+        snapshot.mouse_wheel_delta = mouse_wheel_delta_;
     }
 
     void InputState::begin_next_frame()
@@ -31,17 +31,21 @@ namespace retro
 
     void InputState::set_key_down(LogicalKey key, const bool is_down)
     {
-        logical_keys_.set(static_cast<std::size_t>(key), is_down);
+        down_.set(input_bit(key), is_down);
     }
 
     void InputState::set_key_down(PhysicalKey key, const bool is_down)
     {
-        physical_keys_.set(static_cast<std::size_t>(key), is_down);
+        down_.set(input_bit(key), is_down);
     }
 
     void InputState::set_mouse_button_down(MouseButton button, const bool is_down)
     {
-        mouse_buttons_.set(static_cast<std::size_t>(button), is_down);
+        // Unknown sorts after the real buttons and has no bit of its own
+        if (button == MouseButton::unknown)
+            return;
+
+        down_.set(input_bit(button), is_down);
     }
 
     void InputState::set_mouse_position(const float x, const float y)
@@ -53,8 +57,8 @@ namespace retro
 
     void InputState::add_mouse_delta(const float x, const float y)
     {
-        mouse_wheel_delta_.x += x;
-        mouse_wheel_delta_.y += y;
+        mouse_delta_.x += x;
+        mouse_delta_.y += y;
     }
 
     void InputState::add_mouse_wheel_delta(const float x, const float y)
@@ -65,21 +69,40 @@ namespace retro
 
     void InputState::enable_gamepad(const std::size_t index, const std::uint32_t platform_id)
     {
-        gamepads_[index].emplace(platform_id);
+        connected_gamepads_.set(index);
+        gamepad_platform_ids_[index] = platform_id;
     }
 
     void InputState::disable_gamepad(const std::size_t index)
     {
-        gamepads_[index].reset();
+        connected_gamepads_.reset(index);
+        gamepad_platform_ids_[index] = 0;
+
+        // A disconnected slot reads as released and centered, just like an empty one
+        for (std::size_t button = 0; button < gamepad_button_max; ++button)
+        {
+            down_.reset(input_bit(index, static_cast<GamepadButton>(button)));
+        }
+
+        for (auto &axis : gamepad_axes_)
+        {
+            axis[index] = 0.0f;
+        }
     }
 
     void InputState::set_gamepad_button_down(const std::size_t index, GamepadButton button, const bool is_down)
     {
-        gamepads_[index]->buttons.set(static_cast<std::size_t>(button), is_down);
+        if (connected_gamepads_.test(index))
+        {
+            down_.set(input_bit(index, button), is_down);
+        }
     }
 
     void InputState::set_gamepad_axis(const std::size_t index, GamepadAxis axis, const float value)
     {
-        gamepads_[index]->axes[static_cast<std::size_t>(axis)] = value;
+        if (connected_gamepads_.test(index))
+        {
+            gamepad_axes_[static_cast<std::size_t>(axis)][index] = value;
+        }
     }
 } // namespace retro
@@ -21,6 +21,7 @@ import retro.core.interop.interop_error;
 import retro.runtime.rendering.pipeline_manager.render_manager;
 import retro.runtime.event_manager;
 import retro.runtime.input.input_manager;
+import retro.runtime.input.input_recording;
 
 using namespace retro;
 
@@ -55,6 +56,36 @@ extern "C"
         engine->poll_events_once();
     }
 
+    RETRO_API void retro_engine_start_input_recording(Engine *engine,
+                                                      const char16_t *path,
+                                                      const std::int32_t length,
+                                                      InteropError *error)
+    {
+        try_execute([&] { engine->start_input_recording(std::u16string_view{path, static_cast<std::size_t>(length)}); },
+                    *error);
+    }
+
+    RETRO_API void retro_engine_stop_input_recording(Engine *engine)
+    {
+        engine->stop_input_recording();
+    }
+
+    RETRO_API void retro_engine_start_input_replay(Engine *engine,
+                                                   const char16_t *path,
+                                                   const std::int32_t length,
+                                                   const ReplayPace pace,
+                                                   InteropError *error)
+    {
+        try_execute(
+            [&] { engine->start_input_replay(std::u16string_view{path, static_cast<std::size_t>(length)}, pace); },
+            *error);
+    }
+
+    RETRO_API bool retro_engine_is_replaying_input(const Engine *engine)
+    {
+        return engine->is_replaying_input();
+    }
+
     RETRO_API void retro_engine_on_shutdown_requested_add(Engine *engine,
                                                           void *user_data,
                                                           const ShutdownRequestedCallback removed_callback,
@@ -10,6 +10,7 @@ import std;
 import retro.platform.input;
 import retro.runtime.input.input_manager;
 import retro.runtime.input.input_query;
+import retro.runtime.input.input_state;
 
 using namespace retro;
 
@@ -175,13 +176,56 @@ extern "C"
         return manager->were_all_pressed(std::span{inputs, static_cast<std::size_t>(length)});
     }
 
-    RETRO_API bool retro_input_manager_wre_none_pressed(const InputManager *manager,
+    RETRO_API bool retro_input_manager_were_none_pressed(const InputManager *manager,
                                                         const InteropDigitalInput *inputs,
                                                         const std::int32_t length)
     {
         return manager->were_none_pressed(std::span{inputs, static_cast<std::size_t>(length)});
     }
 
+    RETRO_API InputBinding *retro_input_binding_create(const InteropDigitalInput *inputs, const std::int32_t length)
+    {
+        return new InputBinding(std::span{inputs, static_cast<std::size_t>(length)});
+    }
+
+    RETRO_API void retro_input_binding_destroy(const InputBinding *binding)
+    {
+        delete binding;
+    }
+
+    RETRO_API bool retro_input_manager_is_any_down_binding(const InputManager *manager, const InputBinding *binding)
+    {
+        return manager->is_any_down(*binding);
+    }
+
+    RETRO_API bool retro_input_manager_are_all_down_binding(const InputManager *manager, const InputBinding *binding)
+    {
+        return manager->are_all_down(*binding);
+    }
+
+    RETRO_API bool retro_input_manager_are_none_down_binding(const InputManager *manager, const InputBinding *binding)
+    {
+        return manager->are_none_down(*binding);
+    }
+
+    RETRO_API bool retro_input_manager_was_any_pressed_binding(const InputManager *manager,
+                                                               const InputBinding *binding)
+    {
+        return manager->was_any_pressed(*binding);
+    }
+
+    RETRO_API bool retro_input_manager_were_all_pressed_binding(const InputManager *manager,
+                                                                const InputBinding *binding)
+    {
+        return manager->were_all_pressed(*binding);
+    }
+
+    RETRO_API bool retro_input_manager_were_none_pressed_binding(const InputManager *manager,
+                                                                 const InputBinding *binding)
+    {
+        return manager->were_none_pressed(*binding);
+    }
+
     RETRO_API void retro_input_manager_get_mouse_position(const InputManager *manager,
                                                           float *position_x,
                                                           float *position_y,
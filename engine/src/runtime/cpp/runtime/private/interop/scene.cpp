@@ -15,6 +15,8 @@ import retro.core.memory.ref_counted_ptr;
 import retro.runtime.world.scene;
 import retro.runtime.world.viewport;
 import retro.runtime.world.scene_node;
+import retro.runtime.world.scene_commands;
+import retro.runtime.world.transform_table;
 import retro.runtime.rendering.objects.geometry;
 import retro.runtime.rendering.objects.sprite;
 import retro.runtime.engine;
@@ -34,13 +36,6 @@ using namespace retro;
 
 namespace retro
 {
-    struct NativeTransform2f
-    {
-        Vector2f position{};
-        float rotation = 0;
-        Vector2f scale{};
-    };
-
     struct NativeCameraLayout
     {
         Vector2f position{};
@@ -51,15 +46,6 @@ namespace retro
 
     namespace
     {
-        Transform2f from_c(const NativeTransform2f &transform)
-        {
-            const Scale2f scale{transform.scale};
-            const Quaternion2f rotation{transform.rotation};
-
-            const auto matrix = Matrix2x2f{rotation} * Matrix2x2f{scale};
-            return Transform2f{matrix, transform.position};
-        }
-
         CameraLayout from_c(const NativeCameraLayout &layout)
         {
             return CameraLayout{.position = layout.position,
@@ -171,9 +157,53 @@ extern "C"
         scene->destroy_node(*node);
     }
 
+    RETRO_API void retro_nodes_dispose_many(Scene *scene, SceneNode *const *nodes, const std::int32_t count)
+    {
+        scene->destroy_nodes(std::span{nodes, static_cast<std::size_t>(count)});
+    }
+
+    RETRO_API void retro_scene_apply_commands(const SceneCommand *commands, const std::int32_t count)
+    {
+        apply_scene_commands(std::span{commands, static_cast<std::size_t>(count)});
+    }
+
+    RETRO_API std::uint32_t retro_scene_transform_allocate(Scene *scene, SceneNode *node, InteropError *error)
+    {
+        std::uint32_t slot = 0;
+        try_execute([&] { slot = scene->transforms().allocate(*node); }, *error);
+        return slot;
+    }
+
+    RETRO_API void retro_scene_transform_allocate_many(Scene *scene,
+                                                       SceneNode *const *nodes,
+                                                       const std::int32_t count,
+                                                       std::uint32_t *out_slots,
+                                                       InteropError *error)
+    {
+        try_execute(
+            [&]
+            {
+                for (std::int32_t i = 0; i < count; ++i)
+                {
+                    out_slots[i] = scene->transforms().allocate(*nodes[i]);
+                }
+            },
+            *error);
+    }
+
+    RETRO_API void retro_scene_transform_get_chunk(Scene *scene, const std::uint32_t index, TransformChunkView *view)
+    {
+        *view = scene->transforms().chunk(index);
+    }
+
+    RETRO_API std::int32_t retro_scene_manager_apply_transforms(SceneManager *manager)
+    {
+        return static_cast<std::int32_t>(manager->apply_transforms());
+    }
+
     RETRO_API void retro_node_set_transform(SceneNode *node, const NativeTransform2f *transform)
     {
-        node->set_transform(from_c(*transform));
+        node->set_transform(from_native(*transform));
     }
 
     RETRO_API std::int32_t retro_node_set_z_order(SceneNode *node, const std::int32_t z_order)
@@ -233,6 +263,11 @@ extern "C"
         return std::addressof(scene->create_node<Sprite>());
     }
 
+    RETRO_API void retro_sprite_create_many(Scene *scene, const std::int32_t count, Sprite **out_handles)
+    {
+        scene->create_nodes<Sprite>(std::span{out_handles, static_cast<std::size_t>(count)});
+    }
+
     RETRO_API void retro_sprite_set_texture(Sprite *node, Texture *texture)
     {
         node->set_texture(RefCountPtr<Texture>::ref(texture));
@@ -273,6 +308,11 @@ extern "C"
         return std::addressof(scene->create_node<TextBlock>());
     }
 
+    RETRO_API void retro_text_block_create_many(Scene *scene, const std::int32_t count, TextBlock **out_handles)
+    {
+        scene->create_nodes<TextBlock>(std::span{out_handles, static_cast<std::size_t>(count)});
+    }
+
     RETRO_API void retro_text_block_set_text_utf8(TextBlock *text_block, const char *text, const std::int32_t length)
     {
         text_block->set_text(std::string{text, static_cast<std::size_t>(length)});
@@ -6,19 +6,21 @@
  */
 module retro.runtime.rendering.headless_render_backend;
 import retro.runtime.rendering.headless_renderer2d;
+import retro.runtime.rendering.recording_renderer2d;
 import retro.core.async.task;
+import retro.core.memory.memory_tracking;
 
 namespace retro
 {
     class HeadlessTexture final : public Texture
     {
       public:
-        HeadlessTexture(std::vector<std::byte> data,
+        HeadlessTexture(const std::span<const std::byte> data,
                         const std::int32_t width,
                         const std::int32_t height,
                         const TextureFormat format,
                         const TextureFilter filter)
-            : Texture{width, height, format, filter}, data_(std::move(data))
+            : Texture{width, height, format, filter}, data_(data.begin(), data.end())
         {
         }
 
@@ -28,11 +30,20 @@ namespace retro
         }
 
       private:
-        std::vector<std::byte> data_;
+        std::vector<std::byte, TaggedAllocator<std::byte, MemoryTag::textures>> data_;
     };
 
+    HeadlessRenderBackend::HeadlessRenderBackend(const HeadlessRenderMode mode) noexcept : mode_{mode}
+    {
+    }
+
     std::shared_ptr<Renderer2D> HeadlessRenderBackend::create_renderer(std::shared_ptr<Window> window)
     {
+        if (mode_ == HeadlessRenderMode::record)
+        {
+            return std::make_shared<RecordingRenderer2D>(std::move(window));
+        }
+
         return std::make_shared<HeadlessRenderer2D>(std::move(window));
     }
 
@@ -44,10 +55,6 @@ namespace retro
                                                                      std::stop_token stop_token)
     {
         return Task<RefCountPtr<Texture>>::from_result(
-            make_ref_counted<HeadlessTexture>(bytes | std::ranges::to<std::vector>(),
-                                              width,
-                                              height,
-                                              format,
-                                              filtering));
+            make_ref_counted<HeadlessTexture>(bytes, width, height, format, filtering));
     }
 } // namespace retro
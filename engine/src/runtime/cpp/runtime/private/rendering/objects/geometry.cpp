@@ -7,9 +7,11 @@
 module;
 
 #include <cstddef>
+#include "retro/core/profiling.hpp"
 
 module retro.runtime.rendering.objects.geometry;
 
+import retro.core.profiling;
 import retro.logging;
 import retro.runtime.rendering.shaders;
 
@@ -71,6 +73,11 @@ namespace retro
         return typeid(GeometryObject);
     }
 
+    const char *GeometryRenderPipeline::name() const
+    {
+        return "Geometry";
+    }
+
     const ShaderLayout &GeometryRenderPipeline::shaders() const
     {
         static const ShaderLayout layout{
@@ -127,6 +134,8 @@ namespace retro
         const Viewport &viewport,
         std::pmr::memory_resource &memory_resource)
     {
+        RETRO_PROFILE_SCOPE("GeometryRenderPipeline::collect_draw_calls_source");
+
         std::pmr::unordered_map<const Geometry *, GeometryBatch> geometry_batches{&memory_resource};
         for (const auto *node : nodes.nodes_of_type<GeometryObject>())
         {
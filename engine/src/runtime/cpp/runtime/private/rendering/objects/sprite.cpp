@@ -7,9 +7,11 @@
 module;
 
 #include <cstddef>
+#include "retro/core/profiling.hpp"
 
 module retro.runtime.rendering.objects.sprite;
 
+import retro.core.profiling;
 import retro.runtime.rendering.shaders;
 
 namespace retro
@@ -186,6 +188,11 @@ namespace retro
         return typeid(Sprite);
     }
 
+    const char *SpriteRenderPipeline::name() const
+    {
+        return "Sprite";
+    }
+
     const ShaderLayout &SpriteRenderPipeline::shaders() const
     {
         static const ShaderLayout layout{
@@ -244,6 +251,8 @@ namespace retro
         const Viewport &viewport,
         std::pmr::memory_resource &memory_resource)
     {
+        RETRO_PROFILE_SCOPE("SpriteRenderPipeline::collect_draw_calls_source");
+
         std::pmr::unordered_map<const Texture *, SpriteBatch> batches{&memory_resource};
         for (auto *node : nodes.nodes_of_type<Sprite>())
         {
@@ -7,11 +7,14 @@
 module;
 
 #include <cstddef>
+#include "retro/core/profiling.hpp"
 
 module retro.runtime.rendering.objects.text_block;
 
+import retro.core.profiling;
 import retro.runtime.rendering.shaders;
 import retro.core.strings.encoding;
+import retro.core.memory.frame_allocator;
 
 namespace retro
 {
@@ -22,6 +25,7 @@ namespace retro
             Vector2f position{};
             Vector2f size{};
             UVs uvs{};
+            std::uint32_t page{};
         };
     } // namespace
 
@@ -73,16 +77,22 @@ namespace retro
 
         auto &font_atlas = font_->atlas();
 
-        if (!dirty_)
+        // A recycled atlas page invalidates the UVs of every quad that was placed on it
+        if (!dirty_ && atlas_generation_ == font_atlas.generation())
             return font_atlas;
 
         cached_quads_.clear();
 
-        const auto codepoints = convert_string<char32_t>(text_);
+        // Both the decoded text and the unplaced quads are throwaway, so they come out of the frame scratch
+        const auto codepoints = convert_string<char32_t>(text_, FrameAllocator::allocator<char32_t>());
+
+        // Read before adding: if making room recycles a page holding some of this block's glyphs they are skipped
+        // below, and the changed generation gets them placed again next frame
+        atlas_generation_ = font_atlas.generation();
         font_->add_glyphs_if_missing(codepoints);
         cached_quads_.reserve(codepoints.size());
 
-        std::vector<PendingGlyphQuad> pending_quads;
+        std::pmr::vector<PendingGlyphQuad> pending_quads{FrameAllocator::allocator<PendingGlyphQuad>()};
         pending_quads.reserve(codepoints.size());
 
         const auto &font_metrics = font_atlas.metrics();
@@ -130,6 +140,7 @@ namespace retro
                     .position = glyph_position,
                     .size = glyph_size,
                     .uvs = glyph_metrics.uvs,
+                    .page = glyph_metrics.page,
                 });
 
                 const auto glyph_min = glyph_position;
@@ -173,7 +184,8 @@ namespace retro
             cached_quads_.push_back({.transform = Transform2f{world_matrix, transformed_position},
                                      .uvs = quad.uvs,
                                      .pivot = Vector2f::zero(),
-                                     .size = quad.size});
+                                     .size = quad.size,
+                                     .page = quad.page});
         }
 
         dirty_ = false;
@@ -185,6 +197,11 @@ namespace retro
         return typeid(TextBlock);
     }
 
+    const char *TextBlockRenderPipeline::name() const
+    {
+        return "TextBlock";
+    }
+
     const ShaderLayout &TextBlockRenderPipeline::shaders() const
     {
         static const ShaderLayout
@@ -250,7 +267,10 @@ namespace retro
         const Viewport &viewport,
         std::pmr::memory_resource &memory_resource)
     {
+        RETRO_PROFILE_SCOPE("TextBlockRenderPipeline::collect_draw_calls_source");
+
         std::pmr::unordered_map<const Texture *, TextBlockBatch> batches{&memory_resource};
+        const auto draw_info = viewport.camera_layout().get_draw_info(viewport_size);
         for (auto *node : nodes.nodes_of_type<TextBlock>())
         {
             auto atlas_result = node->refresh_cached_quads();
@@ -259,39 +279,36 @@ namespace retro
 
             auto &font_atlas = *atlas_result;
 
-            auto pending_data =
-                node->cached_quads_ | std::views::transform(
-                                          [node, &font_atlas](const TextQuad &quad)
-                                          {
-                                              return TextBlockInstanceData{.transform = quad.transform.matrix(),
-                                                                           .translation = quad.transform.translation(),
-                                                                           .z_order = node->z_order(),
-                                                                           .pivot = quad.pivot,
-                                                                           .size = quad.size,
-                                                                           .min_uv = quad.uvs.min,
-                                                                           .max_uv = quad.uvs.max,
-                                                                           .tint = node->tint_,
-                                                                           .pixel_range = font_atlas.distance_range()};
-                                          });
-
-            if (auto it = batches.find(font_atlas.texture().get()); it == batches.end())
+            // Every atlas page is its own texture, so glyphs are batched by the page they live on
+            auto current_page = std::numeric_limits<std::uint32_t>::max();
+            TextBlockBatch *batch = nullptr;
+            for (const auto &quad : node->cached_quads_)
             {
-                auto [pair, inserted] =
-                    batches.emplace(font_atlas.texture().get(),
-                                    TextBlockBatch{
-                                        .font_texture = font_atlas.texture(),
-                                        .instances = std::pmr::vector<TextBlockInstanceData>{&memory_resource},
-                                        .viewport_draw_info = viewport.camera_layout().get_draw_info(viewport_size),
-                                    });
-
-                pair->second.instances.append_range(pending_data);
-            }
-            else
-            {
-                auto &[draw_texture, instances, viewport_draw_info] = batches[font_atlas.texture().get()];
-                draw_texture = font_atlas.texture();
-                viewport_draw_info = viewport.camera_layout().get_draw_info(viewport_size);
-                instances.append_range(pending_data);
+                if (quad.page != current_page)
+                {
+                    current_page = quad.page;
+                    font_atlas.mark_page_used(current_page);
+
+                    const auto texture = font_atlas.texture(current_page);
+                    auto [it, inserted] =
+                        batches.try_emplace(texture.get(),
+                                            TextBlockBatch{
+                                                .font_texture = texture,
+                                                .instances = std::pmr::vector<TextBlockInstanceData>{&memory_resource},
+                                                .viewport_draw_info = draw_info,
+                                            });
+                    batch = &it->second;
+                }
+
+                batch->instances.push_back(TextBlockInstanceData{.transform = quad.transform.matrix(),
+                                                                 .translation = quad.transform.translation(),
+                                                                 .z_order = node->z_order(),
+                                                                 .pivot = quad.pivot,
+                                                                 .size = quad.size,
+                                                                 .min_uv = quad.uvs.min,
+                                                                 .max_uv = quad.uvs.max,
+                                                                 .tint = node->tint_,
+                                                                 .pixel_range = font_atlas.distance_range()});
             }
         }
 
@@ -0,0 +1,134 @@
+/**
+ * @file recording_renderer2d.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module;
+
+#include "retro/core/profiling.hpp"
+
+module retro.runtime.rendering.recording_renderer2d;
+
+import retro.core.containers.inline_list;
+import retro.core.memory.memory_tracking;
+import retro.core.profiling;
+
+namespace retro
+{
+    namespace
+    {
+        std::size_t buffer_bytes(const InlineList<std::span<const std::byte>, draw_array_size> &buffers)
+        {
+            std::size_t bytes = 0;
+            for (const auto &buffer : buffers)
+            {
+                bytes += buffer.size();
+            }
+            return bytes;
+        }
+    } // namespace
+
+    RecordingRenderer2D::RecordingRenderer2D(std::shared_ptr<Window> window)
+        : window_{std::move(window)}, memory_resource_{std::in_place,
+                                                       arena_block_size,
+                                                       1,
+                                                       std::numeric_limits<std::size_t>::max(),
+                                                       retained_arena_blocks,
+                                                       MemoryTag::frame_arenas}
+    {
+    }
+
+    void RecordingRenderer2D::request_stop()
+    {
+        std::scoped_lock lock{mutex_};
+        pending_commands_.clear();
+        has_pending_frame_ = false;
+    }
+
+    void RecordingRenderer2D::wait_for_current_frame()
+    {
+        // Frames are recorded synchronously, so there is never one in flight
+    }
+
+    void RecordingRenderer2D::queue_frame_for_render(const RenderQueueFn factory)
+    {
+        RETRO_PROFILE_SCOPE("RecordingRenderer2D::queue_frame_for_render");
+        std::scoped_lock lock{mutex_};
+
+        // A frame that was never rendered is dropped, everything it allocated has to be gone before the arena resets
+        std::pmr::vector<DrawCommandSet>{&memory_resource_}.swap(pending_commands_);
+        memory_resource_.reset();
+
+        pending_commands_ = factory(memory_resource_);
+        std::ranges::sort(pending_commands_,
+                          [](const DrawCommandSet &lhs, const DrawCommandSet &rhs)
+                          { return lhs.z_order < rhs.z_order; });
+        has_pending_frame_ = true;
+    }
+
+    void RecordingRenderer2D::render_next_available_frame()
+    {
+        RETRO_PROFILE_SCOPE("RecordingRenderer2D::render_next_available_frame");
+        std::scoped_lock lock{mutex_};
+        if (!has_pending_frame_)
+            return;
+
+        RecordedFrameStats stats{.draw_command_sets = pending_commands_.size()};
+        for (const auto &command_set : pending_commands_)
+        {
+            for (const auto &source : command_set.sources)
+            {
+                if (!pipelines_.contains(source->component_type()))
+                {
+                    throw std::out_of_range{"RecordingRenderer2D: no pipeline registered for a draw command source"};
+                }
+
+                ++stats.draw_command_sources;
+                for (const auto &command : source->get_draw_commands())
+                {
+                    ++stats.draw_commands;
+                    stats.instances += command.instance_count;
+                    stats.indices += command.index_count;
+                    stats.uploaded_bytes += buffer_bytes(command.vertex_buffers) +
+                                            buffer_bytes(command.instance_buffers) + command.index_buffer.size() +
+                                            command.push_constants.size();
+                }
+            }
+        }
+
+        pending_commands_.clear();
+        has_pending_frame_ = false;
+        last_frame_ = stats;
+        ++frames_rendered_;
+    }
+
+    void RecordingRenderer2D::add_new_render_pipeline(const std::type_index type, RenderPipeline &)
+    {
+        std::scoped_lock lock{mutex_};
+        pipelines_.insert(type);
+    }
+
+    void RecordingRenderer2D::remove_render_pipeline(const std::type_index type)
+    {
+        std::scoped_lock lock{mutex_};
+        pipelines_.erase(type);
+    }
+
+    Window &RecordingRenderer2D::window() const
+    {
+        return *window_;
+    }
+
+    RecordedFrameStats RecordingRenderer2D::last_frame() const
+    {
+        std::scoped_lock lock{mutex_};
+        return last_frame_;
+    }
+
+    std::uint64_t RecordingRenderer2D::frames_rendered() const
+    {
+        std::scoped_lock lock{mutex_};
+        return frames_rendered_;
+    }
+} // namespace retro
@@ -6,12 +6,16 @@
  */
 module;
 
+#include "retro/core/profiling.hpp"
+
 module retro.runtime.rendering.pipeline_manager.render_manager;
 
 import retro.logging;
+import retro.core.profiling;
 #include "retro/core/macros.hpp"
 import retro.runtime.rendering.draw_command;
 import retro.runtime.world.scene;
+import retro.core.memory.frame_allocator;
 
 namespace retro
 {
@@ -154,6 +158,8 @@ namespace retro
 
     void RenderManager::sync_renderer_state()
     {
+        RETRO_PROFILE_SCOPE("RenderManager::sync_renderer_state");
+
         // ReSharper disable once CppDFAUnreadVariable
         // ReSharper disable once CppDFAUnusedValue
         constexpr auto get_scene_data =
@@ -251,12 +257,12 @@ namespace retro
         }
     }
 
-    std::vector<std::weak_ptr<Renderer2D>> RenderManager::get_current_renderers() const
+    std::pmr::vector<std::weak_ptr<Renderer2D>> RenderManager::get_current_renderers() const
     {
         std::shared_lock lock{renderers_mutex_};
         return renderers_ | std::views::values |
                std::views::transform([](const auto &ptr) { return std::weak_ptr{ptr}; }) |
-               std::ranges::to<std::vector>();
+               std::ranges::to<std::pmr::vector>(FrameAllocator::allocator<std::weak_ptr<Renderer2D>>());
     }
 
     Optional<std::shared_ptr<Renderer2D>> RenderManager::get_renderer(std::uint64_t window_id) const
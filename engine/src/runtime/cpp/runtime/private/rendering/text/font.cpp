@@ -4,20 +4,63 @@
  * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
  * Licensed under the MIT License. See LICENSE file in the project root for full license information.
  */
+module;
+
+#include "retro/core/profiling.hpp"
+
 module retro.runtime.rendering.text.font;
 
+import retro.core.profiling;
 import retro.core.util.enum_class_flags;
 import retro.core.util.exceptions;
 import retro.runtime.rendering.text.async_atlas_generator;
+import retro.core.async.task_scheduler;
 
 import sdl;
 
 namespace retro
 {
+    namespace
+    {
+        GlyphMetrics create_glyph_metrics(const msdf_atlas::GlyphGeometry &glyph,
+                                          const std::size_t page,
+                                          const double scale,
+                                          const std::int32_t width,
+                                          const std::int32_t height)
+        {
+            msdfgen::Shape::Bounds bounds{};
+            glyph.getQuadAtlasBounds(bounds.l, bounds.b, bounds.r, bounds.t);
+            auto total_width = bounds.r - bounds.l;
+            auto total_height = bounds.t - bounds.b;
+            msdfgen::Shape::Bounds bearing_bounds{};
+            glyph.getQuadPlaneBounds(bearing_bounds.l, bearing_bounds.b, bearing_bounds.r, bearing_bounds.t);
+            return GlyphMetrics{.codepoint = static_cast<char32_t>(glyph.getCodepoint()),
+                                .glyph_index = glyph.getGlyphIndex().getIndex(),
+                                .advance_x = static_cast<float>(glyph.getAdvance() * scale),
+                                .bearing_x = static_cast<float>(bearing_bounds.l * scale),
+                                .bearing_y = static_cast<float>(bearing_bounds.t * scale),
+                                .width = static_cast<float>(total_width),
+                                .height = static_cast<float>(total_height),
+                                .page = static_cast<std::uint32_t>(page),
+                                .uvs = {.min = {static_cast<float>(bounds.l) / static_cast<float>(width),
+                                                static_cast<float>(bounds.t) / static_cast<float>(height)},
+                                        .max = {static_cast<float>(bounds.r) / static_cast<float>(width),
+                                                static_cast<float>(bounds.b) / static_cast<float>(height)}}};
+        }
+
+        std::span<const std::byte> page_pixels(const msdfgen::BitmapConstRef<msdfgen::byte, 4> &storage)
+        {
+            return std::span{reinterpret_cast<const std::byte *>(storage.pixels),
+                             static_cast<std::size_t>(storage.width * storage.height * 4)};
+        }
+    } // namespace
+
     FontAtlas::FontAtlas(FontAtlas &&other) noexcept
         : source_pixel_size_{other.source_pixel_size_}, distance_range_{other.distance_range_},
-          metrics_{other.metrics_}, glyphs_{std::move(other.glyphs_)}, texture_{std::move(other.texture_)},
-          atlas_{std::move(other.atlas_)}
+          metrics_{other.metrics_}, glyphs_{std::move(other.glyphs_)}, textures_{std::move(other.textures_)},
+          page_last_used_{std::move(other.page_last_used_)}, use_clock_{other.use_clock_.load()},
+          generation_{other.generation_.load()}, atlas_{std::move(other.atlas_)},
+          page_memory_{std::move(other.page_memory_)}
     {
     }
 
@@ -29,16 +72,32 @@ namespace retro
             distance_range_ = other.distance_range_;
             metrics_ = other.metrics_;
             glyphs_ = std::move(other.glyphs_);
-            texture_ = std::move(other.texture_);
+            textures_ = std::move(other.textures_);
+            page_last_used_ = std::move(other.page_last_used_);
+            use_clock_ = other.use_clock_.load();
+            generation_ = other.generation_.load();
             atlas_ = std::move(other.atlas_);
+            page_memory_ = std::move(other.page_memory_);
         }
         return *this;
     }
 
+    void FontAtlas::mark_page_used(const std::size_t page) const noexcept
+    {
+        std::shared_lock guard{mutex_};
+        if (page >= page_last_used_.size())
+            return;
+
+        // The vector is only resized under the exclusive lock, so concurrent readers may safely update the stamps
+        std::atomic_ref{page_last_used_[page]}.store(use_clock_.fetch_add(1, std::memory_order_relaxed) + 1,
+                                                     std::memory_order_relaxed);
+    }
+
     void FontAtlas::add_glyphs(RenderBackend &render_backend,
                                msdfgen::FontHandle &handle,
                                std::u32string_view codepoints)
     {
+        RETRO_PROFILE_SCOPE("FontAtlas::add_glyphs");
         SemaphoreGuard guard{atlas_semaphore_};
         auto new_chars = get_new_chars(codepoints);
         if (new_chars.empty())
@@ -55,61 +114,27 @@ namespace retro
         packer.setMiterLimit(1.0);
         packer.pack(glyphs.data(), static_cast<std::int32_t>(glyphs.size()));
 
-        msdfgen::BitmapConstRef<msdfgen::byte, 4> old_storage = atlas_.atlas_generator().atlas_storage();
-        auto old_width = old_storage.width;
-        auto old_height = old_storage.height;
+        sync_page_usage();
+        const auto updates = atlas_.add(glyphs);
 
-        auto result = atlas_.add(glyphs);
-
-        msdfgen::BitmapConstRef<msdfgen::byte, 4> storage = atlas_.atlas_generator().atlas_storage();
-        auto width = storage.width;
-        auto height = storage.height;
-
-        if (has_any_flags(result, AtlasChangeFlag::resized))
+        // Only the pages that actually changed get uploaded again, the rest keep their existing textures
+        std::vector<RefCountPtr<Texture>> page_textures;
+        page_textures.reserve(updates.size());
+        for (const auto &update : updates)
         {
-            auto width_ratio = static_cast<float>(old_width) / static_cast<float>(width);
-            auto height_ratio = static_cast<float>(old_height) / static_cast<float>(height);
-            for (auto &glyph_metrics : glyphs_ | std::views::values)
-            {
-                glyph_metrics.uvs.min.x *= width_ratio;
-                glyph_metrics.uvs.min.y *= height_ratio;
-                glyph_metrics.uvs.max.x *= width_ratio;
-                glyph_metrics.uvs.max.y *= height_ratio;
-            }
+            msdfgen::BitmapConstRef<msdfgen::byte, 4> storage = atlas_.page_generator(update.page).atlas_storage();
+            page_textures.push_back(render_backend
+                                        .upload_texture(page_pixels(storage),
+                                                        storage.width,
+                                                        storage.height,
+                                                        TextureFormat::unorm,
+                                                        TextureFilter::linear)
+                                        .configure_await(false)
+                                        .get());
         }
 
         std::unique_lock write_lock{mutex_};
-        for (const auto &glyph : glyphs)
-        {
-            auto code_point = static_cast<char32_t>(glyph.getCodepoint());
-            msdfgen::Shape::Bounds bounds{};
-            glyph.getQuadAtlasBounds(bounds.l, bounds.b, bounds.r, bounds.t);
-            auto total_width = bounds.r - bounds.l;
-            auto total_height = bounds.t - bounds.b;
-            msdfgen::Shape::Bounds bearing_bounds{};
-            glyph.getQuadPlaneBounds(bearing_bounds.l, bearing_bounds.b, bearing_bounds.r, bearing_bounds.t);
-            glyphs_.emplace(glyph.getCodepoint(),
-                            GlyphMetrics{.codepoint = code_point,
-                                         .glyph_index = glyph.getGlyphIndex().getIndex(),
-                                         .advance_x = static_cast<float>(glyph.getAdvance() * packer.getScale()),
-                                         .bearing_x = static_cast<float>(bearing_bounds.l * packer.getScale()),
-                                         .bearing_y = static_cast<float>(bearing_bounds.t * packer.getScale()),
-                                         .width = static_cast<float>(total_width),
-                                         .height = static_cast<float>(total_height),
-                                         .uvs = {.min = {static_cast<float>(bounds.l) / static_cast<float>(width),
-                                                         static_cast<float>(bounds.t) / static_cast<float>(height)},
-                                                 .max = {static_cast<float>(bounds.r) / static_cast<float>(width),
-                                                         static_cast<float>(bounds.b) / static_cast<float>(height)}}});
-        }
-
-        std::span pixels{reinterpret_cast<const std::byte *>(storage.pixels),
-                         static_cast<std::size_t>(storage.width * storage.height * 4)};
-
-        texture_ =
-            render_backend
-                .upload_texture(pixels, storage.width, storage.height, TextureFormat::unorm, TextureFilter::linear)
-                .configure_await(false)
-                .get();
+        commit_page_updates(glyphs, updates, page_textures, packer.getScale());
     }
 
     Task<> FontAtlas::add_glyphs_async(RefCountPtr<RenderBackend> render_backend,
@@ -133,68 +158,90 @@ namespace retro
         packer.setMiterLimit(1.0);
         packer.pack(glyphs.data(), static_cast<std::int32_t>(glyphs.size()));
 
-        msdfgen::BitmapConstRef<msdfgen::byte, 4> old_storage = atlas_.atlas_generator().atlas_storage();
-        auto old_width = old_storage.width;
-        auto old_height = old_storage.height;
+        sync_page_usage();
+        const auto updates = co_await atlas_.add_async(glyphs, stop_token).configure_await(false);
 
-        auto result = co_await atlas_.add_async(glyphs).configure_await(false);
+        // In the async context we need to upload the textures first so that the mutex lock does not cross a thread
+        // boundary due to a coroutine suspension point
+        std::vector<RefCountPtr<Texture>> page_textures;
+        page_textures.reserve(updates.size());
+        for (const auto &update : updates)
+        {
+            msdfgen::BitmapConstRef<msdfgen::byte, 4> storage = atlas_.page_generator(update.page).atlas_storage();
+            page_textures.push_back(co_await render_backend
+                                        ->upload_texture(page_pixels(storage),
+                                                         storage.width,
+                                                         storage.height,
+                                                         TextureFormat::unorm,
+                                                         TextureFilter::linear,
+                                                         stop_token)
+                                        .configure_await(false));
+        }
 
-        msdfgen::BitmapConstRef<msdfgen::byte, 4> storage = atlas_.atlas_generator().atlas_storage();
-        auto width = storage.width;
-        auto height = storage.height;
+        std::unique_lock write_lock{mutex_};
+        commit_page_updates(glyphs, updates, page_textures, packer.getScale());
+    }
 
-        if (has_any_flags(result, AtlasChangeFlag::resized))
+    void FontAtlas::sync_page_usage()
+    {
+        std::shared_lock guard{mutex_};
+        for (const auto [page, stamp] : page_last_used_ | std::views::enumerate)
         {
-            auto width_ratio = static_cast<float>(old_width) / static_cast<float>(width);
-            auto height_ratio = static_cast<float>(old_height) / static_cast<float>(height);
-            for (auto &glyph_metrics : glyphs_ | std::views::values)
-            {
-                glyph_metrics.uvs.min.x *= width_ratio;
-                glyph_metrics.uvs.min.y *= height_ratio;
-                glyph_metrics.uvs.max.x *= width_ratio;
-                glyph_metrics.uvs.max.y *= height_ratio;
-            }
+            atlas_.touch(static_cast<std::size_t>(page), std::atomic_ref{stamp}.load(std::memory_order_relaxed));
         }
+    }
 
-        // In the async context we need to upload the texture first so that the mutex lock does not cross a thread
-        // boundary due to a coroutine suspension point
-        std::span pixels{reinterpret_cast<const std::byte *>(storage.pixels),
-                         static_cast<std::size_t>(storage.width * storage.height * 4)};
-
-        auto new_texture = co_await render_backend
-                               ->upload_texture(pixels,
-                                                storage.width,
-                                                storage.height,
-                                                TextureFormat::unorm,
-                                                TextureFilter::linear,
-                                                stop_token)
-                               .configure_await(false);
+    void FontAtlas::commit_page_updates(const std::span<const msdf_atlas::GlyphGeometry> glyphs,
+                                        const std::span<const AtlasPageUpdate> updates,
+                                        const std::span<RefCountPtr<Texture>> page_textures,
+                                        const double scale)
+    {
+        textures_.resize(atlas_.page_count());
+        page_last_used_.resize(atlas_.page_count());
 
-        std::unique_lock write_lock{mutex_};
-        for (const auto &glyph : glyphs)
+        // The page bitmaps are owned by msdf-atlas-gen, so their CPU-side size is followed rather than allocated
+        std::size_t page_bytes = 0;
+        for (std::size_t page = 0; page < atlas_.page_count(); ++page)
         {
-            auto code_point = static_cast<char32_t>(glyph.getCodepoint());
-            msdfgen::Shape::Bounds bounds{};
-            glyph.getQuadAtlasBounds(bounds.l, bounds.b, bounds.r, bounds.t);
-            auto total_width = bounds.r - bounds.l;
-            auto total_height = bounds.t - bounds.b;
-            msdfgen::Shape::Bounds bearing_bounds{};
-            glyph.getQuadPlaneBounds(bearing_bounds.l, bearing_bounds.b, bearing_bounds.r, bearing_bounds.t);
-            glyphs_.emplace(glyph.getCodepoint(),
-                            GlyphMetrics{.codepoint = code_point,
-                                         .glyph_index = glyph.getGlyphIndex().getIndex(),
-                                         .advance_x = static_cast<float>(glyph.getAdvance() * packer.getScale()),
-                                         .bearing_x = static_cast<float>(bearing_bounds.l * packer.getScale()),
-                                         .bearing_y = static_cast<float>(bearing_bounds.t * packer.getScale()),
-                                         .width = static_cast<float>(total_width),
-                                         .height = static_cast<float>(total_height),
-                                         .uvs = {.min = {static_cast<float>(bounds.l) / static_cast<float>(width),
-                                                         static_cast<float>(bounds.t) / static_cast<float>(height)},
-                                                 .max = {static_cast<float>(bounds.r) / static_cast<float>(width),
-                                                         static_cast<float>(bounds.b) / static_cast<float>(height)}}});
+            msdfgen::BitmapConstRef<msdfgen::byte, 4> storage = atlas_.page_generator(page).atlas_storage();
+            page_bytes += page_pixels(storage).size();
         }
+        page_memory_.resize(page_bytes);
+
+        for (auto &&[update, texture] : std::views::zip(updates, page_textures))
+        {
+            if (has_any_flags(update.change, AtlasChangeFlag::evicted))
+            {
+                std::erase_if(glyphs_, [&update](const auto &pair) { return pair.second.page == update.page; });
+                generation_.fetch_add(1, std::memory_order_release);
+            }
+            else if (has_any_flags(update.change, AtlasChangeFlag::resized) && textures_[update.page] != nullptr)
+            {
+                const auto &old_texture = *textures_[update.page];
+                auto width_ratio = static_cast<float>(old_texture.width()) / static_cast<float>(texture->width());
+                auto height_ratio = static_cast<float>(old_texture.height()) / static_cast<float>(texture->height());
+                for (auto &glyph_metrics : glyphs_ | std::views::values)
+                {
+                    if (glyph_metrics.page != update.page)
+                        continue;
+
+                    glyph_metrics.uvs.min.x *= width_ratio;
+                    glyph_metrics.uvs.min.y *= height_ratio;
+                    glyph_metrics.uvs.max.x *= width_ratio;
+                    glyph_metrics.uvs.max.y *= height_ratio;
+                }
+            }
+
+            for (const auto &glyph : glyphs.subspan(update.first_glyph, update.glyph_count))
+            {
+                glyphs_.emplace(glyph.getCodepoint(),
+                                create_glyph_metrics(glyph, update.page, scale, texture->width(), texture->height()));
+            }
 
-        texture_ = new_texture;
+            textures_[update.page] = std::move(texture);
+            std::atomic_ref{page_last_used_[update.page]}.store(use_clock_.fetch_add(1, std::memory_order_relaxed) + 1,
+                                                                std::memory_order_relaxed);
+        }
     }
 
     msdf_atlas::Charset FontAtlas::get_new_chars(std::u32string_view codepoints) const
@@ -243,13 +290,18 @@ namespace retro
     }
 
     Task<RefCountPtr<Font>> FontService::load_font(std::vector<std::byte> bytes, const std::stop_token stop_token) const
+    {
+        return load_font(std::move(bytes), FontMsdfAtlasConfig{.pixel_size = 24, .distance_range = 2.0f}, stop_token);
+    }
+
+    Task<RefCountPtr<Font>> FontService::load_font(std::vector<std::byte> bytes,
+                                                   const FontMsdfAtlasConfig atlas_config,
+                                                   const std::stop_token stop_token) const
     {
         const auto bytes_span = SDL::IOFromConstMem(bytes);
         const SDL::Font font{bytes_span, 16};
         FontFace font_face{library_, std::move(bytes), font.GetFamilyName(), font.GetStyleName()};
 
-        constexpr FontMsdfAtlasConfig atlas_config{.pixel_size = 24, .distance_range = 2.0f};
-
         auto atlas = co_await generate_font_atlas(font_face, atlas_config, stop_token);
 
         co_return RefCountPtr<Font>::ref(
@@ -282,56 +334,41 @@ namespace retro
         packer.setPixelRange(atlas_config.distance_range);
         packer.setMiterLimit(1.0);
         packer.pack(glyphs.data(), static_cast<std::int32_t>(glyphs.size()));
-        auto &generator = output.atlas_.atlas_generator();
 
+        output.atlas_ = FontAtlasData{atlas_config.min_page_side, atlas_config.max_page_side, atlas_config.max_pages};
+        auto &generator = output.atlas_.generator_prototype();
+
+        // Glyph generation runs on the low priority lane and yields between glyphs, so it can safely be spread across
+        // every worker without starving gameplay work
         msdf_atlas::GeneratorAttributes attributes;
         generator.set_attributes(attributes);
-        generator.set_thread_count(4);
-        co_await output.atlas_.add_async(glyphs, stop_token).configure_await(false);
-
-        msdfgen::BitmapConstRef<msdfgen::byte, 4> storage = output.atlas_.atlas_generator().atlas_storage();
-        auto width = storage.width;
-        auto height = storage.height;
+        generator.set_thread_count(static_cast<std::int32_t>(TaskScheduler::default_scheduler().concurrency()));
+        generator.set_priority(TaskPriority::low);
+        const auto updates = co_await output.atlas_.add_async(glyphs, stop_token).configure_await(false);
 
-        output.glyphs_.reserve(glyphs.size());
-        for (const auto &glyph : glyphs)
+        std::vector<RefCountPtr<Texture>> page_textures;
+        page_textures.reserve(updates.size());
+        for (const auto &update : updates)
         {
-            auto code_point = static_cast<char32_t>(glyph.getCodepoint());
-            msdfgen::Shape::Bounds bounds{};
-            glyph.getQuadAtlasBounds(bounds.l, bounds.b, bounds.r, bounds.t);
-            auto total_width = bounds.r - bounds.l;
-            auto total_height = bounds.t - bounds.b;
-            msdfgen::Shape::Bounds bearing_bounds{};
-            glyph.getQuadPlaneBounds(bearing_bounds.l, bearing_bounds.b, bearing_bounds.r, bearing_bounds.t);
-            output.glyphs_.emplace(
-                glyph.getCodepoint(),
-                GlyphMetrics{.codepoint = code_point,
-                             .glyph_index = glyph.getGlyphIndex().getIndex(),
-                             .advance_x = static_cast<float>(glyph.getAdvance() * packer.getScale()),
-                             .bearing_x = static_cast<float>(bearing_bounds.l * packer.getScale()),
-                             .bearing_y = static_cast<float>(bearing_bounds.t * packer.getScale()),
-                             .width = static_cast<float>(total_width),
-                             .height = static_cast<float>(total_height),
-                             .uvs = {.min = {static_cast<float>(bounds.l) / static_cast<float>(width),
-                                             static_cast<float>(bounds.t) / static_cast<float>(height)},
-                                     .max = {static_cast<float>(bounds.r) / static_cast<float>(width),
-                                             static_cast<float>(bounds.b) / static_cast<float>(height)}}});
+            msdfgen::BitmapConstRef<msdfgen::byte, 4> storage =
+                output.atlas_.page_generator(update.page).atlas_storage();
+            page_textures.push_back(co_await render_backend_
+                                        .upload_texture(page_pixels(storage),
+                                                        storage.width,
+                                                        storage.height,
+                                                        TextureFormat::unorm,
+                                                        TextureFilter::linear,
+                                                        stop_token)
+                                        .configure_await(false));
         }
 
-        msdfgen::BitmapConstSection<msdf_atlas::byte, 4> section = generator.atlas_storage();
-
-        std::span pixels{reinterpret_cast<const std::byte *>(section.pixels),
-                         static_cast<std::size_t>(section.width * section.height * 4)};
-
         output.source_pixel_size_ = static_cast<float>(packer.getScale());
-        output.texture_ = co_await render_backend_
-                              .upload_texture(pixels,
-                                              section.width,
-                                              section.height,
-                                              TextureFormat::unorm,
-                                              TextureFilter::linear,
-                                              stop_token)
-                              .configure_await(false);
+        output.glyphs_.reserve(glyphs.size());
+
+        {
+            std::unique_lock write_lock{output.mutex_};
+            output.commit_page_updates(glyphs, updates, page_textures, packer.getScale());
+        }
 
         co_return output;
     }
@@ -11,9 +11,21 @@ namespace retro
     void Scene::destroy_node(SceneNode &node)
     {
         node.detach_from_parent();
+        transforms_.release(node);
         nodes_.remove(node);
     }
 
+    void Scene::destroy_nodes(const std::span<SceneNode *const> nodes)
+    {
+        for (auto *node : nodes)
+        {
+            node->detach_from_parent();
+            transforms_.release(*node);
+        }
+
+        nodes_.remove_all(nodes);
+    }
+
     std::span<SceneNode *const> Scene::nodes_of_type(const std::type_index type) const noexcept
     {
         return nodes_.nodes_of_type(type);
@@ -26,6 +38,17 @@ namespace retro
         return *created_scene;
     }
 
+    std::size_t SceneManager::apply_transforms()
+    {
+        std::size_t updated = 0;
+        for (const auto &scene : scenes_)
+        {
+            updated += scene->transforms().apply_dirty();
+        }
+
+        return updated;
+    }
+
     void SceneManager::destroy_scene(Scene &scene)
     {
         const auto it = std::ranges::find_if(scenes_,
@@ -0,0 +1,77 @@
+/**
+ * @file scene_commands.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module retro.runtime.world.scene_commands;
+
+import retro.runtime.rendering.objects.geometry;
+import retro.runtime.rendering.objects.text_block;
+
+namespace retro
+{
+    namespace
+    {
+        void apply_scene_command(const SceneCommand &command)
+        {
+            auto &node = *command.node;
+            switch (command.type)
+            {
+                case SceneCommandType::set_transform:
+                    node.set_transform(from_native(command.transform));
+                    break;
+                case SceneCommandType::set_z_order:
+                    node.set_z_order(command.z_order);
+                    break;
+                case SceneCommandType::attach_to_parent:
+                    node.attach_to_parent(command.parent);
+                    break;
+                case SceneCommandType::detach_from_parent:
+                    node.detach_from_parent();
+                    break;
+                case SceneCommandType::set_sprite_tint:
+                    static_cast<Sprite &>(node).set_tint(command.color);
+                    break;
+                case SceneCommandType::set_sprite_pivot:
+                    static_cast<Sprite &>(node).set_pivot(command.vector);
+                    break;
+                case SceneCommandType::set_sprite_size:
+                    static_cast<Sprite &>(node).set_size(command.vector);
+                    break;
+                case SceneCommandType::set_sprite_uv_rect:
+                    static_cast<Sprite &>(node).set_uvs(command.uvs);
+                    break;
+                case SceneCommandType::set_sprite_draw_mode:
+                    static_cast<Sprite &>(node).set_draw_mode(command.draw_mode);
+                    break;
+                case SceneCommandType::set_sprite_margin:
+                    static_cast<Sprite &>(node).set_margin(command.margin);
+                    break;
+                case SceneCommandType::set_geometry_color:
+                    static_cast<GeometryObject &>(node).set_color(command.color);
+                    break;
+                case SceneCommandType::set_geometry_pivot:
+                    static_cast<GeometryObject &>(node).set_pivot(command.vector);
+                    break;
+                case SceneCommandType::set_geometry_size:
+                    static_cast<GeometryObject &>(node).set_size(command.vector);
+                    break;
+                case SceneCommandType::set_text_block_tint:
+                    static_cast<TextBlock &>(node).set_tint(command.color);
+                    break;
+                case SceneCommandType::set_text_block_pivot:
+                    static_cast<TextBlock &>(node).set_pivot(command.vector);
+                    break;
+            }
+        }
+    } // namespace
+
+    void apply_scene_commands(const std::span<const SceneCommand> commands)
+    {
+        for (const auto &command : commands)
+        {
+            apply_scene_command(command);
+        }
+    }
+} // namespace retro
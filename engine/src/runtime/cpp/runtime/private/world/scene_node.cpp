@@ -11,9 +11,23 @@ module;
 module retro.runtime.world.scene_node;
 
 import retro.core.math.operations;
+import retro.core.memory.memory_tracking;
 
 namespace retro
 {
+    void *SceneNode::operator new(const std::size_t size)
+    {
+        auto *ptr = ::operator new(size);
+        track_allocation(MemoryTag::scene_nodes, size);
+        return ptr;
+    }
+
+    void SceneNode::operator delete(void *ptr, const std::size_t size) noexcept
+    {
+        track_deallocation(MemoryTag::scene_nodes, size);
+        ::operator delete(ptr, size);
+    }
+
     void SceneNode::set_transform(const Transform2f &transform)
     {
         transform_ = transform;
@@ -94,6 +108,14 @@ namespace retro
         return it->second;
     }
 
+    void SceneNodeList::reserve(const std::type_index type, const std::size_t additional)
+    {
+        storage_.reserve(storage_.size() + additional);
+
+        auto &nodes_list = nodes_by_type_[type];
+        nodes_list.reserve(nodes_list.size() + additional);
+    }
+
     void SceneNodeList::add(std::unique_ptr<SceneNode> node) noexcept
     {
         index_node(node.get());
@@ -113,6 +135,74 @@ namespace retro
         storage_.pop_back();
     }
 
+    void SceneNodeList::remove_all(const std::span<SceneNode *const> nodes)
+    {
+        // Nodes of one type are usually destroyed together, so a flat list of the types involved stays tiny. It is
+        // the only allocation here and is built before any node is marked, so running out of memory leaves the list
+        // untouched.
+        using FirstRemoved = std::pair<std::type_index, std::size_t>;
+        std::vector<FirstRemoved> first_removed_by_type;
+        for (auto *node : nodes)
+        {
+            if (node->hook_.master_index == std::dynamic_extent)
+                continue;
+
+            const std::type_index type{typeid(*node)};
+            const auto it = std::ranges::find(first_removed_by_type, type, &FirstRemoved::first);
+            if (it != first_removed_by_type.end())
+            {
+                it->second = std::min(it->second, node->hook_.internal_index);
+            }
+            else
+            {
+                first_removed_by_type.emplace_back(type, node->hook_.internal_index);
+            }
+        }
+
+        auto first_removed = storage_.size();
+        for (auto *node : nodes)
+        {
+            if (node->hook_.master_index == std::dynamic_extent)
+                continue;
+
+            // A cleared master index marks the node for removal during compaction
+            first_removed = std::min(first_removed, node->hook_.master_index);
+            node->hook_.master_index = std::dynamic_extent;
+        }
+
+        for (const auto &[type, first] : first_removed_by_type)
+        {
+            auto &vec = nodes_by_type_[type];
+            auto kept = first;
+            for (auto i = first; i < vec.size(); ++i)
+            {
+                auto *node = vec[i];
+                if (node->hook_.master_index == std::dynamic_extent)
+                {
+                    node->hook_.internal_index = std::dynamic_extent;
+                    continue;
+                }
+
+                node->hook_.internal_index = kept;
+                vec[kept++] = node;
+            }
+
+            vec.resize(kept);
+        }
+
+        auto kept = first_removed;
+        for (auto i = first_removed; i < storage_.size(); ++i)
+        {
+            if (storage_[i]->hook_.master_index == std::dynamic_extent)
+                continue;
+
+            storage_[i]->hook_.master_index = kept;
+            std::swap(storage_[kept++], storage_[i]);
+        }
+
+        storage_.erase(storage_.begin() + static_cast<std::ptrdiff_t>(kept), storage_.end());
+    }
+
     void SceneNodeList::index_node(SceneNode *node) noexcept
     {
         auto &nodes_list = nodes_by_type_[std::type_index{typeid(*node)}];
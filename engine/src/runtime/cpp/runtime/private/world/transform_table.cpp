@@ -0,0 +1,204 @@
+/**
+ * @file transform_table.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module retro.runtime.world.transform_table;
+
+import retro.core.math.matrix;
+
+namespace retro
+{
+    struct TransformTable::Chunk
+    {
+        alignas(64) std::array<float, chunk_size> position_x{};
+        alignas(64) std::array<float, chunk_size> position_y{};
+        alignas(64) std::array<float, chunk_size> rotation{};
+        alignas(64) std::array<float, chunk_size> scale_x{};
+        alignas(64) std::array<float, chunk_size> scale_y{};
+        alignas(64) std::array<std::uint64_t, dirty_words_per_chunk> dirty{};
+        std::array<SceneNode *, chunk_size> nodes{};
+    };
+
+    namespace
+    {
+        constexpr std::uint32_t chunk_of(const std::uint32_t slot) noexcept
+        {
+            return slot / TransformTable::chunk_size;
+        }
+
+        constexpr std::uint32_t index_in_chunk(const std::uint32_t slot) noexcept
+        {
+            return slot % TransformTable::chunk_size;
+        }
+
+        /**
+         * Below this many dirty slots in a word, converting just those slots is cheaper than the vectorized pass over
+         * the whole word.
+         */
+        constexpr std::int32_t dense_dirty_threshold = 16;
+
+        NativeTransform2f read_native(const auto &chunk, const std::uint32_t index) noexcept
+        {
+            return NativeTransform2f{.position = {chunk.position_x[index], chunk.position_y[index]},
+                                     .rotation = chunk.rotation[index],
+                                     .scale = {chunk.scale_x[index], chunk.scale_y[index]}};
+        }
+    } // namespace
+
+    Transform2f from_native(const NativeTransform2f &transform)
+    {
+        const Scale2f scale{transform.scale};
+        const Quaternion2f rotation{transform.rotation};
+
+        const auto matrix = Matrix2x2f{rotation} * Matrix2x2f{scale};
+        return Transform2f{matrix, transform.position};
+    }
+
+    TransformTable::TransformTable() = default;
+
+    TransformTable::TransformTable(TransformTable &&) noexcept = default;
+
+    TransformTable::~TransformTable() = default;
+
+    TransformTable &TransformTable::operator=(TransformTable &&) noexcept = default;
+
+    std::uint32_t TransformTable::allocate(SceneNode &node)
+    {
+        // A node keeps the slot it already has, handing out a second one would leak it
+        if (const auto it = slots_by_node_.find(&node); it != slots_by_node_.end())
+            return it->second;
+
+        if (free_slots_.empty())
+        {
+            const auto first = static_cast<std::uint32_t>(chunks_.size()) * chunk_size;
+            chunks_.push_back(std::make_unique<Chunk>());
+
+            // Handed out from the back, so the lowest slots are used first
+            free_slots_.reserve(free_slots_.size() + chunk_size);
+            for (auto slot = first + chunk_size; slot > first; --slot)
+            {
+                free_slots_.push_back(slot - 1);
+            }
+        }
+
+        const auto slot = free_slots_.back();
+        free_slots_.pop_back();
+        slots_by_node_.emplace(&node, slot);
+
+        auto &chunk = *chunks_[chunk_of(slot)];
+        const auto index = index_in_chunk(slot);
+        chunk.nodes[index] = &node;
+        chunk.position_x[index] = 0;
+        chunk.position_y[index] = 0;
+        chunk.rotation[index] = 0;
+        chunk.scale_x[index] = 1;
+        chunk.scale_y[index] = 1;
+        return slot;
+    }
+
+    void TransformTable::release(const std::uint32_t slot)
+    {
+        auto &chunk = *chunks_[chunk_of(slot)];
+        const auto index = index_in_chunk(slot);
+        if (chunk.nodes[index] == nullptr)
+            return;
+
+        slots_by_node_.erase(chunk.nodes[index]);
+        chunk.nodes[index] = nullptr;
+        chunk.dirty[index / 64] &= ~(std::uint64_t{1} << (index % 64));
+        free_slots_.push_back(slot);
+    }
+
+    void TransformTable::release(const SceneNode &node)
+    {
+        if (const auto it = slots_by_node_.find(&node); it != slots_by_node_.end())
+        {
+            release(it->second);
+        }
+    }
+
+    void TransformTable::write(const std::uint32_t slot, const NativeTransform2f &transform)
+    {
+        auto &chunk = *chunks_[chunk_of(slot)];
+        const auto index = index_in_chunk(slot);
+        chunk.position_x[index] = transform.position.x;
+        chunk.position_y[index] = transform.position.y;
+        chunk.rotation[index] = transform.rotation;
+        chunk.scale_x[index] = transform.scale.x;
+        chunk.scale_y[index] = transform.scale.y;
+        chunk.dirty[index / 64] |= std::uint64_t{1} << (index % 64);
+    }
+
+    NativeTransform2f TransformTable::read(const std::uint32_t slot) const
+    {
+        return read_native(*chunks_[chunk_of(slot)], index_in_chunk(slot));
+    }
+
+    TransformChunkView TransformTable::chunk(const std::uint32_t index) const
+    {
+        auto &chunk = *chunks_[index];
+        return TransformChunkView{.position_x = chunk.position_x.data(),
+                                  .position_y = chunk.position_y.data(),
+                                  .rotation = chunk.rotation.data(),
+                                  .scale_x = chunk.scale_x.data(),
+                                  .scale_y = chunk.scale_y.data(),
+                                  .dirty = chunk.dirty.data()};
+    }
+
+    std::size_t TransformTable::apply_dirty()
+    {
+        std::size_t updated = 0;
+        for (const auto &chunk : chunks_)
+        {
+            for (std::uint32_t word = 0; word < dirty_words_per_chunk; ++word)
+            {
+                auto bits = std::exchange(chunk->dirty[word], 0);
+                if (bits == 0)
+                    continue;
+
+                const auto base = word * 64;
+
+                if (std::popcount(bits) < dense_dirty_threshold)
+                {
+                    // Only a few slots changed, so just those are converted instead of paying sin/cos for all 64
+                    while (bits != 0)
+                    {
+                        const auto bit = static_cast<std::uint32_t>(std::countr_zero(bits));
+                        bits &= bits - 1;
+
+                        if (auto *node = chunk->nodes[base + bit]; node != nullptr)
+                        {
+                            node->set_transform(from_native(read_native(*chunk, base + bit)));
+                            ++updated;
+                        }
+                    }
+                    continue;
+                }
+
+                // The whole word is converted in one straight loop over the columns so the compiler can vectorize
+                // it, only the nodes that actually changed are then told about their new transform
+                std::array<Transform2f, 64> converted;
+                for (std::uint32_t i = 0; i < 64; ++i)
+                {
+                    converted[i] = from_native(read_native(*chunk, base + i));
+                }
+
+                while (bits != 0)
+                {
+                    const auto bit = static_cast<std::uint32_t>(std::countr_zero(bits));
+                    bits &= bits - 1;
+
+                    if (auto *node = chunk->nodes[base + bit]; node != nullptr)
+                    {
+                        node->set_transform(converted[bit]);
+                        ++updated;
+                    }
+                }
+            }
+        }
+
+        return updated;
+    }
+} // namespace retro
@@ -11,6 +11,7 @@ import retro.core.containers.optional;
 import retro.runtime.ecs.entity;
 import retro.core.util.noncopyable;
 import retro.core.type_traits.range;
+import retro.core.memory.memory_tracking;
 
 namespace retro
 {
@@ -28,6 +29,9 @@ namespace retro
         [[nodiscard]] virtual std::span<const Entity> entities() const noexcept = 0;
     };
 
+    template <typename T>
+    using PoolVector = std::vector<T, TaggedAllocator<T, MemoryTag::ecs_pools>>;
+
     export template <std::movable T>
     class ComponentPoolImpl final : public ComponentPool
     {
@@ -129,8 +133,8 @@ namespace retro
         }
 
       private:
-        std::vector<T> components_;
-        std::vector<Entity> entities_;
-        std::vector<std::uint32_t> sparse_;
+        PoolVector<T> components_;
+        PoolVector<Entity> entities_;
+        PoolVector<std::uint32_t> sparse_;
     };
 } // namespace retro
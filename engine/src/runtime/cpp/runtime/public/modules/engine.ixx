@@ -28,6 +28,7 @@ import retro.core.type_traits.range;
 import retro.runtime.event_manager;
 import retro.core.util.noncopyable;
 import retro.runtime.input.input_manager;
+import retro.runtime.input.input_recording;
 
 namespace retro
 {
@@ -43,6 +44,22 @@ namespace retro
 
         void poll_events_once();
 
+        /**
+         * Starts writing every platform event the engine handles to the given file, replacing any recording that is
+         * already running.
+         */
+        void start_input_recording(const std::filesystem::path &path);
+
+        void stop_input_recording();
+
+        /**
+         * Starts feeding a recording back through the platform backend. Each event is pushed just before the
+         * platform events are handled once the input manager has been polled as many times as when it was recorded.
+         */
+        void start_input_replay(const std::filesystem::path &path, ReplayPace pace = ReplayPace::full_speed);
+
+        [[nodiscard]] bool is_replaying_input() const;
+
         inline OnWindowCloseRequested::Event on_window_close_requested()
         {
             return on_window_close_requested_;
@@ -56,9 +73,18 @@ namespace retro
       private:
         bool handle_platform_event(const PlatformEvent &event);
 
+        void pump_input_replay();
+
+        void flush_input_recording();
+
         PlatformBackend &platform_backend_;
         EventManager &event_manager_;
         InputManager &input_manager_;
+
+        // Recordings are started and stopped from the game thread while platform events are handled on their own
+        mutable std::mutex input_capture_mutex_;
+        std::unique_ptr<InputRecorder> input_recorder_;
+        std::unique_ptr<InputReplayer> input_replayer_;
         OnWindowCloseRequested on_window_close_requested_;
         OnShutdownRequested on_shutdown_requested_;
     };
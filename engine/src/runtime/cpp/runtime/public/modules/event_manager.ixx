@@ -13,6 +13,7 @@ export module retro.runtime.event_manager;
 import std;
 import retro.platform.event;
 import retro.core.functional.delegate;
+import retro.core.containers.mpsc_queue;
 
 namespace retro
 {
@@ -33,9 +34,7 @@ namespace retro
         }
 
       private:
-        std::vector<EngineEvent> pending_events_;
-        std::vector<EngineEvent> polling_events_;
-        std::mutex event_mutex_;
+        MpscQueue<EngineEvent> pending_events_;
 
         WindowResizedDelegate window_resized_;
     };
@@ -19,6 +19,7 @@ import retro.core.containers.optional;
 import retro.runtime.input.input_query;
 import retro.core.type_traits.variant;
 import retro.core.functional.overload;
+import retro.core.containers.mpsc_queue;
 
 namespace retro
 {
@@ -32,25 +33,18 @@ namespace retro
 
         void poll_events(std::uint64_t frame_count);
 
+        /**
+         * How many times poll_events has run. Safe to read from any thread, the engine stamps platform events with
+         * it when recording input.
+         */
+        [[nodiscard]] std::uint64_t poll_count() const noexcept
+        {
+            return poll_count_.load(std::memory_order_acquire);
+        }
+
         [[nodiscard]] constexpr bool is_down(const DigitalInput input) const
         {
-            return std::visit(
-                Overload{[this](const LogicalKey key) { return current_.is_down(key); },
-                         [this](const PhysicalKey key) { return current_.is_down(key); },
-                         [this](const MouseButton button) { return current_.is_down(button); },
-                         [this](const GamepadButtonInput button)
-                         { return current_.is_down(button.gamepad_index, button.button); },
-                         [this](const AnyGamepadButtonInput button) { return current_.is_down_on_any(button.button); },
-                         [this](const GamepadAxisThreshold &threshold) {
-                             return current_.axis_over_threshold(threshold.gamepad_index,
-                                                                 threshold.axis,
-                                                                 threshold.threshold);
-                         },
-                         [this](const AnyGamepadAxisThreshold &threshold)
-                         {
-                             return current_.axis_over_threshold_on_any(threshold.axis, threshold.threshold);
-                         }},
-                input);
+            return current_.is_down(input);
         }
 
         template <std::ranges::input_range Range>
@@ -79,28 +73,7 @@ namespace retro
 
         [[nodiscard]] constexpr bool was_pressed(const DigitalInput input) const
         {
-            return std::visit(Overload{[this](const LogicalKey key) { return current_.was_pressed(key, previous_); },
-                                       [this](const PhysicalKey key) { return current_.was_pressed(key, previous_); },
-                                       [this](const MouseButton button)
-                                       { return current_.was_pressed(button, previous_); },
-                                       [this](const GamepadButtonInput button)
-                                       { return current_.was_pressed(button.gamepad_index, button.button, previous_); },
-                                       [this](const AnyGamepadButtonInput button)
-                                       { return current_.was_pressed_on_any(button.button, previous_); },
-                                       [this](const GamepadAxisThreshold &threshold)
-                                       {
-                                           return current_.axis_just_passed_threshold(threshold.gamepad_index,
-                                                                                      threshold.axis,
-                                                                                      threshold.threshold,
-                                                                                      previous_);
-                                       },
-                                       [this](const AnyGamepadAxisThreshold &threshold)
-                                       {
-                                           return current_.axis_just_passed_threshold_on_any(threshold.axis,
-                                                                                             threshold.threshold,
-                                                                                             previous_);
-                                       }},
-                              input);
+            return current_.was_pressed(input);
         }
 
         template <std::ranges::input_range Range>
@@ -127,6 +100,41 @@ namespace retro
                                         [this](const DigitalInput button) { return was_pressed(button); });
         }
 
+        [[nodiscard]] bool is_any_down(const InputBinding &binding) const
+        {
+            return current_.is_any_down(binding);
+        }
+
+        [[nodiscard]] bool are_all_down(const InputBinding &binding) const
+        {
+            return current_.are_all_down(binding);
+        }
+
+        [[nodiscard]] bool are_none_down(const InputBinding &binding) const
+        {
+            return current_.are_none_down(binding);
+        }
+
+        [[nodiscard]] bool was_any_pressed(const InputBinding &binding) const
+        {
+            return current_.was_any_pressed(binding);
+        }
+
+        [[nodiscard]] bool were_all_pressed(const InputBinding &binding) const
+        {
+            return current_.were_all_pressed(binding);
+        }
+
+        [[nodiscard]] bool were_none_pressed(const InputBinding &binding) const
+        {
+            return current_.were_none_pressed(binding);
+        }
+
+        [[nodiscard]] constexpr const InputSnapshot &snapshot() const noexcept
+        {
+            return current_;
+        }
+
         [[nodiscard]] constexpr Vector2f mouse_position() const
         {
             return current_.mouse_position;
@@ -182,14 +190,12 @@ namespace retro
 
         void apply_event(const InputEvent &event);
 
-        std::mutex mutex_;
-        std::vector<InputEvent> event_write_queue_;
-        std::vector<InputEvent> event_read_queue_;
+        MpscQueue<InputEvent> event_queue_;
 
         std::array<Optional<std::uint32_t>, max_gamepads> gamepad_mappings_;
 
         InputState state_;
-        InputSnapshot previous_;
         InputSnapshot current_;
+        std::atomic<std::uint64_t> poll_count_{0};
     };
 } // namespace retro
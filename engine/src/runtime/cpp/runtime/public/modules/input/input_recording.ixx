@@ -0,0 +1,123 @@
+/**
+ * @file input_recording.ixx
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module;
+
+#include "retro/core/exports.h"
+
+export module retro.runtime.input.input_recording;
+
+import std;
+import retro.core.containers.optional;
+import retro.platform.backend;
+import retro.platform.event;
+
+namespace retro
+{
+    /**
+     * A platform event together with when it arrived. The frame is the number of input polls that had run at the
+     * time, so pushing the event back in once the same number of polls have run applies it on the same frame.
+     */
+    export struct RecordedPlatformEvent
+    {
+        std::uint64_t frame = 0;
+        std::chrono::microseconds time{};
+        PlatformEvent event;
+    };
+
+    /**
+     * Appends platform events to a compact binary log. Callback events can't be serialized and are skipped. Records are
+     * buffered and written out once a few kilobytes have built up, or whenever flush is called.
+     */
+    export class RETRO_API InputRecorder
+    {
+      public:
+        explicit InputRecorder(const std::filesystem::path &path);
+
+        InputRecorder(const InputRecorder &) = delete;
+        InputRecorder(InputRecorder &&) = delete;
+
+        ~InputRecorder();
+
+        InputRecorder &operator=(const InputRecorder &) = delete;
+        InputRecorder &operator=(InputRecorder &&) = delete;
+
+        void record(std::uint64_t frame, const PlatformEvent &event);
+
+        /**
+         * Writes out the buffered records. Throws IoException if the file could not be written.
+         */
+        void flush();
+
+        [[nodiscard]] std::size_t event_count() const noexcept
+        {
+            return event_count_;
+        }
+
+      private:
+        std::ofstream stream_;
+        std::vector<std::byte> buffer_;
+        std::chrono::steady_clock::time_point start_ = std::chrono::steady_clock::now();
+        std::uint64_t last_frame_ = 0;
+        std::chrono::microseconds last_time_{};
+        std::size_t event_count_ = 0;
+    };
+
+    export RETRO_API std::vector<RecordedPlatformEvent> read_input_recording(const std::filesystem::path &path);
+
+    export enum class ReplayPace : std::uint8_t
+    {
+        /**
+         * Events are released as soon as their frame comes up.
+         */
+        full_speed,
+
+        /**
+         * Events also wait until as much time has passed since the replay started as had passed in the recording.
+         */
+        real_time
+    };
+
+    /**
+     * Feeds a recording back into a platform backend, typically the headless one, a frame at a time.
+     */
+    export class RETRO_API InputReplayer
+    {
+      public:
+        explicit InputReplayer(std::vector<RecordedPlatformEvent> events, ReplayPace pace = ReplayPace::full_speed);
+
+        /**
+         * Pushes every event recorded up to the given frame that is due into the backend.
+         *
+         * @return The number of events that were pushed.
+         */
+        std::size_t pump(PlatformBackend &backend, std::uint64_t frame);
+
+        [[nodiscard]] bool finished() const noexcept
+        {
+            return next_ == events_.size();
+        }
+
+        [[nodiscard]] std::size_t remaining() const noexcept
+        {
+            return events_.size() - next_;
+        }
+
+        /**
+         * The frame of the last recorded event, or zero for an empty recording.
+         */
+        [[nodiscard]] std::uint64_t last_frame() const noexcept
+        {
+            return events_.empty() ? 0 : events_.back().frame;
+        }
+
+      private:
+        std::vector<RecordedPlatformEvent> events_;
+        std::size_t next_ = 0;
+        ReplayPace pace_;
+        Optional<std::chrono::steady_clock::time_point> start_;
+    };
+} // namespace retro
@@ -13,155 +13,395 @@ export module retro.runtime.input.input_state;
 import std;
 import retro.core.math.vector;
 import retro.platform.input;
-import retro.core.containers.optional;
+import retro.core.functional.overload;
+import retro.runtime.input.input_query;
 
 namespace retro
 {
-    export struct GamepadSnapshot
+    export constexpr inline std::size_t max_gamepads = 8;
+
+    /**
+     * Every digital input lives in one bit array: logical keys, then physical keys, then mouse buttons, then gamepad
+     * buttons. Gamepad buttons are stored button-major, so the bits for one button on every gamepad are adjacent.
+     */
+    constexpr std::size_t physical_key_bits_offset = logical_key_max;
+    constexpr std::size_t mouse_button_bits_offset = physical_key_bits_offset + physical_key_max;
+    constexpr std::size_t gamepad_button_bits_offset = mouse_button_bits_offset + mouse_button_max;
+
+    export constexpr inline std::size_t digital_input_bit_count =
+        gamepad_button_bits_offset + gamepad_button_max * max_gamepads;
+
+    export using DigitalInputBits = std::bitset<digital_input_bit_count>;
+
+    export constexpr std::size_t input_bit(const LogicalKey key) noexcept
     {
-        using ButtonStorage = std::bitset<gamepad_button_max>;
-        using AxisStorage = std::array<float, gamepad_axis_max>;
+        return static_cast<std::size_t>(key);
+    }
 
-        std::uint32_t platform_id = 0;
-        ButtonStorage buttons{};
-        AxisStorage axes{};
+    export constexpr std::size_t input_bit(const PhysicalKey key) noexcept
+    {
+        return physical_key_bits_offset + static_cast<std::size_t>(key);
+    }
+
+    export constexpr std::size_t input_bit(const MouseButton button) noexcept
+    {
+        return mouse_button_bits_offset + static_cast<std::size_t>(button);
+    }
+
+    export constexpr std::size_t input_bit(const std::size_t gamepad_index, const GamepadButton button) noexcept
+    {
+        return gamepad_button_bits_offset + static_cast<std::size_t>(button) * max_gamepads + gamepad_index;
+    }
 
-        [[nodiscard]] constexpr bool is_down(GamepadButton button) const
+    constexpr auto any_gamepad_button_masks = []
+    {
+        std::array<DigitalInputBits, gamepad_button_max> masks{};
+        for (std::size_t button = 0; button < gamepad_button_max; ++button)
         {
-            return buttons.test(static_cast<std::size_t>(button));
+            for (std::size_t gamepad = 0; gamepad < max_gamepads; ++gamepad)
+            {
+                masks[button].set(input_bit(gamepad, static_cast<GamepadButton>(button)));
+            }
         }
+        return masks;
+    }();
+
+    /**
+     * The bits of one button across every gamepad slot.
+     */
+    export constexpr const DigitalInputBits &any_gamepad_button_mask(const GamepadButton button) noexcept
+    {
+        return any_gamepad_button_masks[static_cast<std::size_t>(button)];
+    }
+
+    /**
+     * A set of digital inputs compiled into bit masks once, so checking the whole set is a handful of masked word
+     * operations on the snapshot instead of one variant dispatch per input. Axis thresholds have no bit to test and are
+     * kept aside to be checked one by one.
+     */
+    export class InputBinding
+    {
+      public:
+        InputBinding() = default;
 
-        [[nodiscard]] constexpr bool was_pressed(const GamepadButton button, const GamepadSnapshot &previous) const
+        template <std::ranges::input_range Range>
+            requires std::convertible_to<std::ranges::range_reference_t<Range>, DigitalInput>
+        explicit InputBinding(Range &&inputs)
         {
-            return is_down(button) && !previous.is_down(button);
+            for (const DigitalInput input : inputs)
+            {
+                add(input);
+            }
         }
 
-        [[nodiscard]] constexpr float axis(const GamepadAxis axis) const
+        void add(const DigitalInput &input)
         {
-            return axes[static_cast<std::size_t>(axis)];
+            std::visit(Overload{[this](const LogicalKey key) { exact_.set(input_bit(key)); },
+                                [this](const PhysicalKey key) { exact_.set(input_bit(key)); },
+                                [this](const MouseButton button)
+                                {
+                                    // Unknown has no bit of its own, its index would land on the first gamepad bit
+                                    if (button != MouseButton::unknown)
+                                        exact_.set(input_bit(button));
+                                },
+                                [this](const GamepadButtonInput button)
+                                { exact_.set(input_bit(button.gamepad_index, button.button)); },
+                                [this](const AnyGamepadButtonInput button)
+                                {
+                                    any_gamepad_buttons_.set(static_cast<std::size_t>(button.button));
+                                    any_gamepad_ |= any_gamepad_button_mask(button.button);
+                                },
+                                [this](const GamepadAxisThreshold &threshold) { thresholds_.emplace_back(threshold); },
+                                [this](const AnyGamepadAxisThreshold &threshold)
+                                { thresholds_.emplace_back(threshold); }},
+                       input);
         }
-    };
 
-    export constexpr inline std::size_t max_gamepads = 8;
+        /**
+         * Inputs with a single bit of their own.
+         */
+        [[nodiscard]] constexpr const DigitalInputBits &exact() const noexcept
+        {
+            return exact_;
+        }
 
+        /**
+         * The gamepad buttons that count when held on any gamepad, as the union of their bits on every slot.
+         */
+        [[nodiscard]] constexpr const DigitalInputBits &any_gamepad() const noexcept
+        {
+            return any_gamepad_;
+        }
+
+        [[nodiscard]] constexpr const std::bitset<gamepad_button_max> &any_gamepad_buttons() const noexcept
+        {
+            return any_gamepad_buttons_;
+        }
+
+        [[nodiscard]] constexpr std::span<const DigitalInput> thresholds() const noexcept
+        {
+            return thresholds_;
+        }
+
+      private:
+        DigitalInputBits exact_{};
+        DigitalInputBits any_gamepad_{};
+        std::bitset<gamepad_button_max> any_gamepad_buttons_{};
+        std::vector<DigitalInput> thresholds_;
+    };
+
+    /**
+     * The input for one frame together with the digital and axis state of the frame before it, which is all any
+     * pressed or just-passed query needs.
+     */
     export struct InputSnapshot
     {
-        using LogicalKeyStorage = std::bitset<logical_key_max>;
-        using PhysicalKeyStorage = std::bitset<physical_key_max>;
-        using MouseButtonStorage = std::bitset<mouse_button_max>;
-        using GamepadStorage = std::array<Optional<GamepadSnapshot>, max_gamepads>;
+        using GamepadAxisStorage = std::array<std::array<float, max_gamepads>, gamepad_axis_max>;
 
         std::uint64_t frame_index{};
-        LogicalKeyStorage logical_keys{};
-        PhysicalKeyStorage physical_keys{};
-        MouseButtonStorage mouse_buttons{};
+        DigitalInputBits down{};
+        DigitalInputBits previous_down{};
+        std::bitset<max_gamepads> connected_gamepads{};
+        std::array<std::uint32_t, max_gamepads> gamepad_platform_ids{};
+        GamepadAxisStorage gamepad_axes{};
+        GamepadAxisStorage previous_gamepad_axes{};
         Vector2f mouse_position{};
         Vector2f mouse_delta{};
         Vector2f mouse_wheel_delta{};
-        GamepadStorage gamepads{};
 
-        [[nodiscard]] constexpr bool is_down(LogicalKey key) const
+        [[nodiscard]] constexpr bool is_down(const LogicalKey key) const
         {
-            return logical_keys.test(static_cast<std::size_t>(key));
+            return down.test(input_bit(key));
         }
 
-        [[nodiscard]] constexpr bool is_down(PhysicalKey key) const
+        [[nodiscard]] constexpr bool is_down(const PhysicalKey key) const
         {
-            return physical_keys.test(static_cast<std::size_t>(key));
+            return down.test(input_bit(key));
         }
 
-        [[nodiscard]] constexpr bool is_down(MouseButton button) const
+        [[nodiscard]] constexpr bool is_down(const MouseButton button) const
         {
-            return mouse_buttons.test(static_cast<std::size_t>(button));
+            return button != MouseButton::unknown && down.test(input_bit(button));
         }
 
         [[nodiscard]] constexpr bool is_down(const std::uint8_t gamepad_id, const GamepadButton button) const
         {
-            auto &gamepad = gamepads[gamepad_id];
-            return gamepad.has_value() && gamepad->is_down(button);
+            return down.test(input_bit(gamepad_id, button));
         }
 
         [[nodiscard]] constexpr bool is_down_on_any(const GamepadButton button) const
         {
-            return std::ranges::any_of(gamepads | std::views::join,
-                                       [button](const GamepadSnapshot &snapshot) { return snapshot.is_down(button); });
+            return (down & any_gamepad_button_mask(button)).any();
         }
 
-        [[nodiscard]] constexpr bool was_pressed(const LogicalKey key, const InputSnapshot &previous) const
+        [[nodiscard]] constexpr bool was_pressed(const LogicalKey key) const
         {
-            return is_down(key) && !previous.is_down(key);
+            return was_bit_pressed(input_bit(key));
         }
 
-        [[nodiscard]] constexpr bool was_pressed(const PhysicalKey key, const InputSnapshot &previous) const
+        [[nodiscard]] constexpr bool was_pressed(const PhysicalKey key) const
         {
-            return is_down(key) && !previous.is_down(key);
+            return was_bit_pressed(input_bit(key));
         }
 
-        [[nodiscard]] constexpr bool was_pressed(const MouseButton button, const InputSnapshot &previous) const
+        [[nodiscard]] constexpr bool was_pressed(const MouseButton button) const
         {
-            return is_down(button) && !previous.is_down(button);
+            return button != MouseButton::unknown && was_bit_pressed(input_bit(button));
         }
 
-        [[nodiscard]] constexpr bool was_pressed(const std::uint8_t gamepad_id,
-                                                 const GamepadButton button,
-                                                 const InputSnapshot &previous) const
+        [[nodiscard]] constexpr bool was_pressed(const std::uint8_t gamepad_id, const GamepadButton button) const
         {
-            return is_down(gamepad_id, button) && !previous.is_down(gamepad_id, button);
+            return was_bit_pressed(input_bit(gamepad_id, button));
         }
 
-        [[nodiscard]] constexpr bool was_pressed_on_any(const GamepadButton button, const InputSnapshot &previous) const
+        [[nodiscard]] constexpr bool was_pressed_on_any(const GamepadButton button) const
         {
-            return is_down_on_any(button) && !previous.is_down_on_any(button);
+            const auto &mask = any_gamepad_button_mask(button);
+            return (down & mask).any() && (previous_down & mask).none();
         }
 
         [[nodiscard]] constexpr float axis(const std::uint8_t gamepad_id, const GamepadAxis axis) const
         {
-            auto &gamepad = gamepads[gamepad_id];
-            return gamepad.has_value() ? gamepad->axis(axis) : 0.0f;
+            return gamepad_axes[static_cast<std::size_t>(axis)][gamepad_id];
         }
 
         [[nodiscard]] constexpr bool axis_over_threshold(const std::uint8_t gamepad_id,
                                                          const GamepadAxis axis,
                                                          const float threshold) const
         {
-            return threshold > 0.0f ? this->axis(gamepad_id, axis) >= threshold
-                                    : this->axis(gamepad_id, axis) <= threshold;
+            return over_threshold(this->axis(gamepad_id, axis), threshold);
         }
 
         [[nodiscard]] constexpr bool axis_just_passed_threshold(const std::uint8_t gamepad_id,
                                                                 const GamepadAxis axis,
-                                                                const float threshold,
-                                                                const InputSnapshot &previous) const
+                                                                const float threshold) const
         {
             return axis_over_threshold(gamepad_id, axis, threshold) &&
-                   !previous.axis_over_threshold(gamepad_id, axis, threshold);
+                   !over_threshold(previous_gamepad_axes[static_cast<std::size_t>(axis)][gamepad_id], threshold);
         }
 
         [[nodiscard]] constexpr float axis_on_any(const GamepadAxis axis) const
         {
-            return std::ranges::fold_left(gamepads | std::views::join |
-                                              std::views::transform([axis](const auto &s) { return s.axis(axis); }),
-                                          0.0f,
-                                          std::plus<float>{});
+            return sum_connected(gamepad_axes[static_cast<std::size_t>(axis)]);
         }
 
         [[nodiscard]] constexpr bool axis_over_threshold_on_any(const GamepadAxis axis, const float threshold) const
         {
-            return threshold > 0.0f ? axis_on_any(axis) >= threshold : axis_on_any(axis) <= threshold;
+            return over_threshold(axis_on_any(axis), threshold);
         }
 
         [[nodiscard]] constexpr bool axis_just_passed_threshold_on_any(const GamepadAxis axis,
-                                                                       const float threshold,
-                                                                       const InputSnapshot &previous) const
+                                                                       const float threshold) const
+        {
+            return axis_over_threshold_on_any(axis, threshold) &&
+                   !over_threshold(sum_connected(previous_gamepad_axes[static_cast<std::size_t>(axis)]), threshold);
+        }
+
+        [[nodiscard]] constexpr bool is_down(const DigitalInput &input) const
+        {
+            return std::visit(
+                Overload{[this](const LogicalKey key) { return is_down(key); },
+                         [this](const PhysicalKey key) { return is_down(key); },
+                         [this](const MouseButton button) { return is_down(button); },
+                         [this](const GamepadButtonInput button)
+                         { return is_down(button.gamepad_index, button.button); },
+                         [this](const AnyGamepadButtonInput button) { return is_down_on_any(button.button); },
+                         [this](const GamepadAxisThreshold &threshold)
+                         { return axis_over_threshold(threshold.gamepad_index, threshold.axis, threshold.threshold); },
+                         [this](const AnyGamepadAxisThreshold &threshold)
+                         { return axis_over_threshold_on_any(threshold.axis, threshold.threshold); }},
+                input);
+        }
+
+        [[nodiscard]] constexpr bool was_pressed(const DigitalInput &input) const
+        {
+            return std::visit(
+                Overload{[this](const LogicalKey key) { return was_pressed(key); },
+                         [this](const PhysicalKey key) { return was_pressed(key); },
+                         [this](const MouseButton button) { return was_pressed(button); },
+                         [this](const GamepadButtonInput button)
+                         { return was_pressed(button.gamepad_index, button.button); },
+                         [this](const AnyGamepadButtonInput button) { return was_pressed_on_any(button.button); },
+                         [this](const GamepadAxisThreshold &threshold) {
+                             return axis_just_passed_threshold(threshold.gamepad_index,
+                                                               threshold.axis,
+                                                               threshold.threshold);
+                         },
+                         [this](const AnyGamepadAxisThreshold &threshold)
+                         { return axis_just_passed_threshold_on_any(threshold.axis, threshold.threshold); }},
+                input);
+        }
+
+        [[nodiscard]] bool is_any_down(const InputBinding &binding) const
+        {
+            if ((down & (binding.exact() | binding.any_gamepad())).any())
+                return true;
+
+            return std::ranges::any_of(binding.thresholds(),
+                                       [this](const DigitalInput &input) { return is_down(input); });
+        }
+
+        [[nodiscard]] bool are_all_down(const InputBinding &binding) const
+        {
+            if ((down & binding.exact()) != binding.exact())
+                return false;
+
+            if (!all_any_gamepad_buttons(binding,
+                                         [this](const GamepadButton button) { return is_down_on_any(button); }))
+                return false;
+
+            return std::ranges::all_of(binding.thresholds(),
+                                       [this](const DigitalInput &input) { return is_down(input); });
+        }
+
+        [[nodiscard]] bool are_none_down(const InputBinding &binding) const
+        {
+            return !is_any_down(binding);
+        }
+
+        [[nodiscard]] bool was_any_pressed(const InputBinding &binding) const
+        {
+            if ((down & ~previous_down & binding.exact()).any())
+                return true;
+
+            if (any_any_gamepad_button(binding,
+                                       [this](const GamepadButton button) { return was_pressed_on_any(button); }))
+                return true;
+
+            return std::ranges::any_of(binding.thresholds(),
+                                       [this](const DigitalInput &input) { return was_pressed(input); });
+        }
+
+        [[nodiscard]] bool were_all_pressed(const InputBinding &binding) const
+        {
+            if ((down & ~previous_down & binding.exact()) != binding.exact())
+                return false;
+
+            if (!all_any_gamepad_buttons(binding,
+                                         [this](const GamepadButton button) { return was_pressed_on_any(button); }))
+                return false;
+
+            return std::ranges::all_of(binding.thresholds(),
+                                       [this](const DigitalInput &input) { return was_pressed(input); });
+        }
+
+        [[nodiscard]] bool were_none_pressed(const InputBinding &binding) const
+        {
+            return !was_any_pressed(binding);
+        }
+
+      private:
+        [[nodiscard]] constexpr bool was_bit_pressed(const std::size_t bit) const
+        {
+            return down.test(bit) && !previous_down.test(bit);
+        }
+
+        static constexpr bool over_threshold(const float value, const float threshold)
+        {
+            return threshold > 0.0f ? value >= threshold : value <= threshold;
+        }
+
+        [[nodiscard]] constexpr float sum_connected(const std::array<float, max_gamepads> &values) const
+        {
+            // Slots without a gamepad always read zero, so the whole row can be summed
+            return std::ranges::fold_left(values, 0.0f, std::plus<float>{});
+        }
+
+        // "Any gamepad" buttons need at least one bit out of their group, which a single mask can't express for all-of
+        template <std::predicate<GamepadButton> Predicate>
+        static bool all_any_gamepad_buttons(const InputBinding &binding, Predicate &&predicate)
+        {
+            const auto &buttons = binding.any_gamepad_buttons();
+            for (std::size_t button = 0; button < buttons.size(); ++button)
+            {
+                if (buttons.test(button) && !predicate(static_cast<GamepadButton>(button)))
+                    return false;
+            }
+
+            return true;
+        }
+
+        template <std::predicate<GamepadButton> Predicate>
+        static bool any_any_gamepad_button(const InputBinding &binding, Predicate &&predicate)
         {
-            return axis_over_threshold_on_any(axis, threshold) && !previous.axis_over_threshold_on_any(axis, threshold);
+            const auto &buttons = binding.any_gamepad_buttons();
+            for (std::size_t button = 0; button < buttons.size(); ++button)
+            {
+                if (buttons.test(button) && predicate(static_cast<GamepadButton>(button)))
+                    return true;
+            }
+
+            return false;
         }
     };
 
     export class RETRO_API InputState
     {
       public:
-        [[nodiscard]] InputSnapshot snapshot(std::uint64_t frame_index) const;
+        /**
+         * Moves the snapshot's state into its previous frame and copies the live state over it.
+         */
+        void advance_snapshot(InputSnapshot &snapshot, std::uint64_t frame_index) const;
 
         void begin_next_frame();
 
@@ -186,12 +426,12 @@ namespace retro
         void set_gamepad_axis(std::size_t index, GamepadAxis axis, float value);
 
       private:
-        InputSnapshot::LogicalKeyStorage logical_keys_{};
-        InputSnapshot::PhysicalKeyStorage physical_keys_{};
-        InputSnapshot::MouseButtonStorage mouse_buttons_{};
+        DigitalInputBits down_{};
+        std::bitset<max_gamepads> connected_gamepads_{};
+        std::array<std::uint32_t, max_gamepads> gamepad_platform_ids_{};
+        InputSnapshot::GamepadAxisStorage gamepad_axes_{};
         Vector2f mouse_position_{};
         Vector2f mouse_delta_{};
         Vector2f mouse_wheel_delta_{};
-        InputSnapshot::GamepadStorage gamepads_{};
     };
 } // namespace retro
@@ -19,9 +19,24 @@ import retro.runtime.rendering.texture;
 
 namespace retro
 {
+    export enum class HeadlessRenderMode : std::uint8_t
+    {
+        /**
+         * Renderers drop every frame without looking at it.
+         */
+        discard,
+
+        /**
+         * Renderers collect and expand every frame like a GPU backend would, see RecordingRenderer2D.
+         */
+        record
+    };
+
     export class RETRO_API HeadlessRenderBackend final : public RenderBackend
     {
       public:
+        explicit HeadlessRenderBackend(HeadlessRenderMode mode = HeadlessRenderMode::discard) noexcept;
+
         std::shared_ptr<Renderer2D> create_renderer(std::shared_ptr<Window> window) override;
         Task<RefCountPtr<Texture>> upload_texture(std::span<const std::byte> bytes,
                                                   std::int32_t width,
@@ -29,5 +44,8 @@ namespace retro
                                                   TextureFormat format,
                                                   TextureFilter filtering,
                                                   std::stop_token stop_token) override;
+
+      private:
+        HeadlessRenderMode mode_;
     };
 } // namespace retro
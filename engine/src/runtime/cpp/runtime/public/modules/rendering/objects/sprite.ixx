@@ -150,6 +150,8 @@ namespace retro
       public:
         [[nodiscard]] std::type_index component_type() const override;
 
+        [[nodiscard]] const char *name() const override;
+
         [[nodiscard]] const ShaderLayout &shaders() const override;
 
         SmallUniquePtr<DrawCommandSource> collect_draw_calls_source(
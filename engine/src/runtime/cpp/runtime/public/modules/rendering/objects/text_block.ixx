@@ -65,6 +65,7 @@ namespace retro
         UVs uvs{};
         Vector2f pivot{};
         Vector2f size{};
+        std::uint32_t page{};
     };
 
     class TextBlock final : public SceneNode
@@ -122,6 +123,7 @@ namespace retro
         Color tint_{Color::white()};
         Vector2f pivot_{};
         bool dirty_{true};
+        std::uint64_t atlas_generation_{0};
         std::vector<TextQuad> cached_quads_;
     };
 
@@ -129,6 +131,7 @@ namespace retro
     {
       public:
         [[nodiscard]] std::type_index component_type() const override;
+        [[nodiscard]] const char *name() const override;
         [[nodiscard]] const ShaderLayout &shaders() const override;
         SmallUniquePtr<DrawCommandSource> collect_draw_calls_source(
             const SceneNodeList &nodes,
@@ -0,0 +1,76 @@
+/**
+ * @file recording_renderer2d.ixx
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module;
+
+#include "retro/core/exports.h"
+
+export module retro.runtime.rendering.recording_renderer2d;
+
+import std;
+import retro.runtime.rendering.renderer2d;
+import retro.runtime.rendering.render_pipeline;
+import retro.runtime.rendering.draw_command;
+import retro.platform.window;
+import retro.core.memory.arena_allocator;
+
+namespace retro
+{
+    /**
+     * What a frame would have handed to the GPU.
+     */
+    export struct RecordedFrameStats
+    {
+        std::size_t draw_command_sets = 0;
+        std::size_t draw_command_sources = 0;
+        std::size_t draw_commands = 0;
+        std::size_t instances = 0;
+        std::size_t indices = 0;
+        std::size_t uploaded_bytes = 0;
+    };
+
+    /**
+     * A renderer without a GPU that still runs the whole CPU side of a frame. Queuing a frame collects the draw
+     * command sets from the pipelines the same way the Vulkan presenter does, and rendering it expands every source
+     * into draw commands and records their counts instead of submitting them.
+     */
+    export class RETRO_API RecordingRenderer2D final : public Renderer2D
+    {
+      public:
+        explicit RecordingRenderer2D(std::shared_ptr<Window> window);
+
+        void request_stop() override;
+
+        void wait_for_current_frame() override;
+
+        void queue_frame_for_render(RenderQueueFn factory) override;
+
+        void render_next_available_frame() override;
+
+        void add_new_render_pipeline(std::type_index type, RenderPipeline &pipeline) override;
+
+        void remove_render_pipeline(std::type_index type) override;
+
+        [[nodiscard]] Window &window() const override;
+
+        [[nodiscard]] RecordedFrameStats last_frame() const;
+
+        [[nodiscard]] std::uint64_t frames_rendered() const;
+
+      private:
+        static constexpr std::size_t arena_block_size = 1024 * 1024;
+        static constexpr std::size_t retained_arena_blocks = 20;
+
+        std::shared_ptr<Window> window_;
+        std::set<std::type_index> pipelines_;
+        mutable std::mutex mutex_;
+        MultiArenaMemoryResource memory_resource_;
+        std::pmr::vector<DrawCommandSet> pending_commands_{&memory_resource_};
+        bool has_pending_frame_ = false;
+        RecordedFrameStats last_frame_{};
+        std::uint64_t frames_rendered_ = 0;
+    };
+} // namespace retro
@@ -68,7 +68,7 @@ namespace retro
         }
 
       private:
-        [[nodiscard]] std::vector<std::weak_ptr<Renderer2D>> get_current_renderers() const;
+        [[nodiscard]] std::pmr::vector<std::weak_ptr<Renderer2D>> get_current_renderers() const;
         [[nodiscard]] Optional<std::shared_ptr<Renderer2D>> get_renderer(std::uint64_t window_id) const;
 
         bool auto_assign_viewports_;
@@ -23,6 +23,11 @@ namespace retro
 
         [[nodiscard]] virtual std::type_index component_type() const = 0;
 
+        /**
+         * Display name used for the pipeline's GPU timings, has to outlive the pipeline.
+         */
+        [[nodiscard]] virtual const char *name() const = 0;
+
         [[nodiscard]] virtual const ShaderLayout &shaders() const = 0;
 
         virtual SmallUniquePtr<DrawCommandSource> collect_draw_calls_source(
@@ -11,6 +11,7 @@ import msdfgen;
 import msdf_atlas;
 import retro.core.async.task;
 import retro.core.async.workload;
+import retro.core.async.task_scheduler;
 
 namespace retro
 {
@@ -105,7 +106,8 @@ namespace retro
                     }
                     return true;
                 },
-                glyphs.size()}
+                glyphs.size(),
+                priority_}
                 .finish_async(thread_count_, stop_token);
         }
 
@@ -145,6 +147,11 @@ namespace retro
             thread_count_ = thread_count;
         }
 
+        void set_priority(const TaskPriority priority)
+        {
+            priority_ = priority;
+        }
+
         [[nodiscard]] const AtlasStorage &atlas_storage() const
         {
             return storage_;
@@ -162,5 +169,6 @@ namespace retro
         std::vector<msdfgen::byte> error_correction_buffer_;
         msdf_atlas::GeneratorAttributes attributes_;
         std::int32_t thread_count_{1};
+        TaskPriority priority_{TaskPriority::low};
     };
 } // namespace retro
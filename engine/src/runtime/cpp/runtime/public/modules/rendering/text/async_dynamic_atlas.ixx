@@ -21,7 +21,8 @@ namespace retro
     {
         no_change = 0,
         resized = 1 << 0,
-        rearranged = 1 << 1
+        rearranged = 1 << 1,
+        evicted = 1 << 2
     };
 
     template <>
@@ -182,4 +183,274 @@ namespace retro
         std::vector<msdf_atlas::Rectangle> rectangles_{};
         std::vector<msdf_atlas::Remap> remap_buffer_{};
     };
+
+    /**
+     * Describes what happened to a single page of an AsyncPagedDynamicAtlas during an add. The glyphs that were placed
+     * on the page occupy the range [first_glyph, first_glyph + glyph_count) of the span that was passed in.
+     */
+    export struct AtlasPageUpdate
+    {
+        std::size_t page{};
+        std::size_t first_glyph{};
+        std::size_t glyph_count{};
+        AtlasChangeFlag change = AtlasChangeFlag::no_change;
+    };
+
+    /**
+     * A dynamic atlas that never grows a single page past a fixed side length. Once the open page is full a new page is
+     * started, so existing pages never need to be rearranged or re-uploaded when glyphs are added elsewhere. If a page
+     * budget is set the least recently used page is recycled instead of allocating past the budget.
+     */
+    export template <ValidAtlasGenerator AtlasGenerator>
+        requires std::copyable<AtlasGenerator>
+    class AsyncPagedDynamicAtlas
+    {
+        struct Page
+        {
+            std::int32_t side = 0;
+            std::int32_t glyph_count = 0;
+            std::uint64_t last_used = 0;
+            msdf_atlas::RectanglePacker packer{};
+            AtlasGenerator generator{};
+        };
+
+      public:
+        static constexpr std::int32_t default_min_page_side = 256;
+        static constexpr std::int32_t default_max_page_side = 1024;
+
+        AsyncPagedDynamicAtlas() = default;
+
+        explicit AsyncPagedDynamicAtlas(const std::int32_t min_page_side,
+                                        const std::int32_t max_page_side,
+                                        const std::size_t max_pages = 0)
+            : min_page_side_{msdf_atlas::ceilToPOT(std::max(min_page_side, 1))},
+              max_page_side_{std::max(msdf_atlas::ceilToPOT(std::max(max_page_side, 1)), min_page_side_)},
+              max_pages_{max_pages}
+        {
+        }
+
+        /**
+         * Places the glyphs and renders them into their pages. The glyphs are reordered so that every glyph sharing a
+         * page is contiguous, the returned updates describe those ranges in page order.
+         */
+        std::vector<AtlasPageUpdate> add(std::span<msdf_atlas::GlyphGeometry> glyphs)
+        {
+            auto updates = place_glyphs(glyphs);
+            for (const auto &update : updates)
+            {
+                pages_[update.page].generator.generate(glyphs.subspan(update.first_glyph, update.glyph_count));
+            }
+            return updates;
+        }
+
+        Task<std::vector<AtlasPageUpdate>> add_async(std::span<msdf_atlas::GlyphGeometry> glyphs,
+                                                     std::stop_token stop_token = {})
+        {
+            auto updates = place_glyphs(glyphs);
+            for (const auto &update : updates)
+            {
+                co_await pages_[update.page].generator.generate_async(
+                    glyphs.subspan(update.first_glyph, update.glyph_count),
+                    stop_token);
+            }
+            co_return updates;
+        }
+
+        /**
+         * Records that a page was last sampled at the given point in time. Pages with the smallest stamp are the first
+         * to be recycled once the page budget is exhausted.
+         */
+        void touch(const std::size_t page, const std::uint64_t stamp)
+        {
+            pages_[page].last_used = stamp;
+            clock_ = std::max(clock_, stamp);
+        }
+
+        [[nodiscard]] std::size_t page_count() const noexcept
+        {
+            return pages_.size();
+        }
+
+        [[nodiscard]] std::int32_t max_page_side() const noexcept
+        {
+            return max_page_side_;
+        }
+
+        [[nodiscard]] std::size_t max_pages() const noexcept
+        {
+            return max_pages_;
+        }
+
+        AtlasGenerator &page_generator(const std::size_t page)
+        {
+            return pages_[page].generator;
+        }
+
+        const AtlasGenerator &page_generator(const std::size_t page) const
+        {
+            return pages_[page].generator;
+        }
+
+        /**
+         * The generator that every new page is copied from, configure this before adding any glyphs.
+         */
+        AtlasGenerator &generator_prototype() noexcept
+        {
+            return prototype_;
+        }
+
+        const AtlasGenerator &generator_prototype() const noexcept
+        {
+            return prototype_;
+        }
+
+      private:
+        std::vector<AtlasPageUpdate> place_glyphs(std::span<msdf_atlas::GlyphGeometry> glyphs)
+        {
+            ++clock_;
+            std::vector<AtlasPageUpdate> updates;
+            if (glyphs.empty())
+                return updates;
+
+            if (pages_.empty())
+                open_page_ = create_page();
+
+            // Whitespace has no box, so it simply rides along with whichever page is open
+            std::vector glyph_pages(glyphs.size(), open_page_);
+            pages_[open_page_].last_used = clock_;
+            update_for(updates, open_page_);
+
+            std::vector<std::size_t> pending;
+            std::vector<msdf_atlas::Rectangle> rectangles;
+            for (const auto [i, glyph] : glyphs | std::views::enumerate)
+            {
+                if (glyph.isWhitespace())
+                    continue;
+
+                std::int32_t w;
+                std::int32_t h;
+                glyph.getBoxSize(w, h);
+                pending.push_back(static_cast<std::size_t>(i));
+                rectangles.push_back(msdf_atlas::Rectangle{-1, -1, w + spacing_, h + spacing_});
+            }
+
+            while (!pending.empty())
+            {
+                auto &page = pages_[open_page_];
+                page.last_used = clock_;
+                auto &update = update_for(updates, open_page_);
+
+                while (true)
+                {
+                    page.packer.pack(rectangles.data(), static_cast<std::int32_t>(rectangles.size()));
+
+                    std::size_t kept = 0;
+                    for (std::size_t i = 0; i < pending.size(); ++i)
+                    {
+                        if (const auto &rect = rectangles[i]; rect.x >= 0)
+                        {
+                            glyphs[pending[i]].placeBox(rect.x, rect.y);
+                            glyph_pages[pending[i]] = open_page_;
+                            ++page.glyph_count;
+                        }
+                        else
+                        {
+                            pending[kept] = pending[i];
+                            rectangles[kept] = rect;
+                            ++kept;
+                        }
+                    }
+                    pending.resize(kept);
+                    rectangles.resize(kept);
+
+                    // An empty page is allowed to grow past the limit so that an oversized glyph still gets placed
+                    if (pending.empty() || (page.side >= max_page_side_ && page.glyph_count > 0))
+                        break;
+
+                    page.side *= 2;
+                    page.packer.expand(page.side + spacing_, page.side + spacing_);
+                    update.change |= AtlasChangeFlag::resized;
+                }
+
+                if (has_any_flags(update.change, AtlasChangeFlag::resized))
+                    page.generator.resize(page.side, page.side);
+
+                if (!pending.empty())
+                    open_page_ = begin_next_page(updates);
+            }
+
+            std::vector<std::size_t> order(glyphs.size());
+            std::ranges::iota(order, 0);
+            std::ranges::stable_sort(order, std::less{}, [&glyph_pages](const std::size_t i) { return glyph_pages[i]; });
+
+            std::vector<msdf_atlas::GlyphGeometry> sorted;
+            sorted.reserve(glyphs.size());
+            for (const auto i : order)
+            {
+                sorted.push_back(std::move(glyphs[i]));
+            }
+            std::ranges::move(sorted, glyphs.begin());
+
+            std::ranges::sort(updates, std::less{}, &AtlasPageUpdate::page);
+            std::size_t offset = 0;
+            for (auto &update : updates)
+            {
+                update.first_glyph = offset;
+                update.glyph_count = static_cast<std::size_t>(
+                    std::ranges::count(glyph_pages, update.page));
+                offset += update.glyph_count;
+            }
+
+            return updates;
+        }
+
+        std::size_t begin_next_page(std::vector<AtlasPageUpdate> &updates)
+        {
+            if (max_pages_ == 0 || pages_.size() < max_pages_)
+                return create_page();
+
+            // Pages that received glyphs during this add are never recycled, even if that means going over budget
+            auto candidates =
+                std::views::iota(std::size_t{0}, pages_.size()) |
+                std::views::filter([this](const std::size_t i) { return pages_[i].last_used != clock_; });
+            const auto victim =
+                std::ranges::min_element(candidates, std::less{}, [this](const std::size_t i) { return pages_[i].last_used; });
+            if (victim == candidates.end())
+                return create_page();
+
+            auto &page = pages_[*victim];
+            page.packer = msdf_atlas::RectanglePacker{page.side + spacing_, page.side + spacing_};
+            page.glyph_count = 0;
+            update_for(updates, *victim).change |= AtlasChangeFlag::evicted;
+            return *victim;
+        }
+
+        std::size_t create_page()
+        {
+            auto &page = pages_.emplace_back(Page{
+                .side = min_page_side_,
+                .packer = msdf_atlas::RectanglePacker{min_page_side_ + spacing_, min_page_side_ + spacing_},
+                .generator = prototype_,
+            });
+            page.generator.resize(page.side, page.side);
+            return pages_.size() - 1;
+        }
+
+        static AtlasPageUpdate &update_for(std::vector<AtlasPageUpdate> &updates, const std::size_t page)
+        {
+            if (const auto it = std::ranges::find(updates, page, &AtlasPageUpdate::page); it != updates.end())
+                return *it;
+
+            return updates.emplace_back(AtlasPageUpdate{.page = page});
+        }
+
+        std::int32_t min_page_side_ = default_min_page_side;
+        std::int32_t max_page_side_ = default_max_page_side;
+        std::int32_t spacing_ = 0;
+        std::size_t max_pages_ = 0;
+        std::size_t open_page_ = 0;
+        std::uint64_t clock_ = 0;
+        AtlasGenerator prototype_{};
+        std::vector<Page> pages_{};
+    };
 } // namespace retro
@@ -27,6 +27,7 @@ import sdl;
 import retro.runtime.rendering.text.async_atlas_generator;
 import retro.runtime.rendering.text.async_dynamic_atlas;
 import retro.core.async.semaphore;
+import retro.core.memory.memory_tracking;
 
 namespace retro
 {
@@ -47,6 +48,9 @@ namespace retro
     {
         float pixel_size{64};
         float distance_range{2.0f};
+        std::int32_t min_page_side{256};
+        std::int32_t max_page_side{1024};
+        std::size_t max_pages{16};
     };
 
     export struct FontMetrics
@@ -70,10 +74,11 @@ namespace retro
         float width{};
         float height{};
 
+        std::uint32_t page{};
         UVs uvs{};
     };
 
-    using FontAtlasData = AsyncDynamicAtlas<
+    using FontAtlasData = AsyncPagedDynamicAtlas<
         AsyncAtlasGenerator<float, 4, msdf_atlas::mtsdfGenerator, msdf_atlas::BitmapAtlasStorage<msdf_atlas::byte, 4>>>;
 
     export class RETRO_API FontAtlas
@@ -112,12 +117,32 @@ namespace retro
             return glyphs_;
         }
 
-        [[nodiscard]] inline const RefCountPtr<Texture> &texture() const noexcept
+        [[nodiscard]] inline std::size_t page_count() const noexcept
         {
             std::shared_lock guard{mutex_};
-            return texture_;
+            return textures_.size();
         }
 
+        /**
+         * Returned by value, pages can be added by the generator thread as soon as the lock is released.
+         */
+        [[nodiscard]] inline RefCountPtr<Texture> texture(const std::size_t page) const noexcept
+        {
+            std::shared_lock guard{mutex_};
+            return textures_[page];
+        }
+
+        /**
+         * Incremented every time a page is recycled. Anything caching glyph placements needs to rebuild them whenever
+         * this changes.
+         */
+        [[nodiscard]] inline std::uint64_t generation() const noexcept
+        {
+            return generation_.load(std::memory_order_acquire);
+        }
+
+        void mark_page_used(std::size_t page) const noexcept;
+
       private:
         friend FontService;
         friend Font;
@@ -131,13 +156,24 @@ namespace retro
 
         [[nodiscard]] msdf_atlas::Charset get_new_chars(std::u32string_view codepoints) const;
 
+        void sync_page_usage();
+
+        void commit_page_updates(std::span<const msdf_atlas::GlyphGeometry> glyphs,
+                                 std::span<const AtlasPageUpdate> updates,
+                                 std::span<RefCountPtr<Texture>> page_textures,
+                                 double scale);
+
         float source_pixel_size_{64};
         float distance_range_{8.0f};
 
         FontMetrics metrics_{};
         std::unordered_map<char32_t, GlyphMetrics> glyphs_{};
-        RefCountPtr<Texture> texture_{};
+        std::vector<RefCountPtr<Texture>> textures_{};
+        mutable std::vector<std::uint64_t> page_last_used_{};
+        mutable std::atomic<std::uint64_t> use_clock_{0};
+        std::atomic<std::uint64_t> generation_{0};
         FontAtlasData atlas_{};
+        TrackedMemory page_memory_{MemoryTag::font_atlases};
         mutable std::shared_mutex mutex_;
         mutable Semaphore atlas_semaphore_{1, 1};
     };
@@ -220,6 +256,13 @@ namespace retro
         [[nodiscard]] Task<RefCountPtr<Font>> load_font(std::vector<std::byte> bytes,
                                                         std::stop_token stop_token = {}) const;
 
+        /**
+         * Loads a font whose atlas uses the given page sizes and page budget instead of the defaults.
+         */
+        [[nodiscard]] Task<RefCountPtr<Font>> load_font(std::vector<std::byte> bytes,
+                                                        FontMsdfAtlasConfig atlas_config,
+                                                        std::stop_token stop_token = {}) const;
+
       private:
         Task<FontAtlas> generate_font_atlas(FontFace &face,
                                             const FontMsdfAtlasConfig &atlas_config,
@@ -16,6 +16,7 @@ import retro.core.util.noncopyable;
 import retro.core.math.transform;
 import retro.core.math.vector;
 import retro.runtime.world.scene_node;
+import retro.runtime.world.transform_table;
 
 namespace retro
 {
@@ -34,8 +35,38 @@ namespace retro
             return ref;
         }
 
+        /**
+         * Creates one node per element of the span and writes them into it, reserving space for all of them up front.
+         */
+        template <std::derived_from<SceneNode> T>
+            requires std::default_initializable<T>
+        void create_nodes(std::span<T *> created)
+        {
+            nodes_.reserve(std::type_index{typeid(T)}, created.size());
+            for (auto &node : created)
+            {
+                auto owned = std::make_unique<T>();
+                node = owned.get();
+                nodes_.add(std::move(owned));
+            }
+        }
+
+        template <std::derived_from<SceneNode> T>
+            requires std::default_initializable<T>
+        std::vector<T *> create_nodes(const std::size_t count)
+        {
+            std::vector<T *> created(count);
+            create_nodes<T>(std::span{created});
+            return created;
+        }
+
         void destroy_node(SceneNode &node);
 
+        /**
+         * Destroys a batch of nodes with a single compaction of the scene's storage.
+         */
+        void destroy_nodes(std::span<SceneNode *const> nodes);
+
         [[nodiscard]] inline const SceneNodeList &nodes() const noexcept
         {
             return nodes_;
@@ -43,6 +74,14 @@ namespace retro
 
         [[nodiscard]] std::span<SceneNode *const> nodes_of_type(std::type_index type) const noexcept;
 
+        /**
+         * Node transforms written directly by the managed side, applied by SceneManager::apply_transforms.
+         */
+        [[nodiscard]] inline TransformTable &transforms() noexcept
+        {
+            return transforms_;
+        }
+
         template <std::derived_from<SceneNode> T>
             requires(!std::is_abstract_v<T>)
         [[nodiscard]] std::span<T *const> nodes_of_type() const noexcept
@@ -52,6 +91,7 @@ namespace retro
 
       private:
         SceneNodeList nodes_;
+        TransformTable transforms_;
     };
 
     export using OnSceneDelegate = MulticastDelegate<void(Scene &)>;
@@ -63,6 +103,11 @@ namespace retro
 
         void destroy_scene(Scene &scene);
 
+        /**
+         * Hands every transform written into the scenes' transform tables since the last call to its node.
+         */
+        std::size_t apply_transforms();
+
         [[nodiscard]] inline std::span<const std::unique_ptr<Scene>> scenes() const noexcept
         {
             return scenes_;
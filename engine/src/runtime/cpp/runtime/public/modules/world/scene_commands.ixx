@@ -0,0 +1,81 @@
+/**
+ * @file scene_commands.ixx
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module;
+
+#include <cstddef>
+#include "retro/core/exports.h"
+
+export module retro.runtime.world.scene_commands;
+
+import std;
+import retro.core.math.vector;
+import retro.core.util.color;
+import retro.runtime.rendering.layout.margin;
+import retro.runtime.rendering.layout.uvs;
+import retro.runtime.rendering.objects.sprite;
+import retro.runtime.world.scene_node;
+import retro.runtime.world.transform_table;
+
+namespace retro
+{
+    /**
+     * Values are part of the managed ABI, new commands may only be appended.
+     */
+    export enum class SceneCommandType : std::uint32_t
+    {
+        set_transform,
+        set_z_order,
+        attach_to_parent,
+        detach_from_parent,
+        set_sprite_tint,
+        set_sprite_pivot,
+        set_sprite_size,
+        set_sprite_uv_rect,
+        set_sprite_draw_mode,
+        set_sprite_margin,
+        set_geometry_color,
+        set_geometry_pivot,
+        set_geometry_size,
+        set_text_block_tint,
+        set_text_block_pivot
+    };
+
+    /**
+     * One fixed-size record in a command stream. The node has to be of the type the command is for, exactly as with
+     * the matching per-node interop call.
+     */
+    export struct SceneCommand
+    {
+        SceneNode *node = nullptr;
+        SceneCommandType type = SceneCommandType::set_transform;
+        std::uint32_t reserved = 0;
+
+        union
+        {
+            NativeTransform2f transform{};
+            std::int32_t z_order;
+            SceneNode *parent;
+            Color color;
+            Vector2f vector;
+            UVs uvs;
+            SpriteDrawMode draw_mode;
+            Margin margin;
+        };
+    };
+
+    // SceneCommandBuffer.cs declares the same layout with explicit field offsets
+    static_assert(sizeof(SceneCommand) == 40, "The managed side mirrors this layout");
+    static_assert(offsetof(SceneCommand, node) == 0, "The managed side mirrors this layout");
+    static_assert(offsetof(SceneCommand, type) == 8, "The managed side mirrors this layout");
+    static_assert(offsetof(SceneCommand, transform) == 16, "The managed side mirrors this layout");
+
+    /**
+     * Replays a stream of commands in order, so a whole frame's worth of node updates crosses the interop boundary
+     * in a single call.
+     */
+    export RETRO_API void apply_scene_commands(std::span<const SceneCommand> commands);
+} // namespace retro
@@ -31,6 +31,13 @@ namespace retro
       public:
         virtual ~SceneNode() = default;
 
+        /**
+         * Nodes are accounted to MemoryTag::scene_nodes. The destructor is virtual, so the sized delete sees the size
+         * of the most derived node.
+         */
+        static void *operator new(std::size_t size);
+        static void operator delete(void *ptr, std::size_t size) noexcept;
+
         [[nodiscard]] inline SceneNode *parent() const noexcept
         {
             return parent_;
@@ -109,10 +116,21 @@ namespace retro
             return std::span{cast_data, of_types.size()};
         }
 
+        /**
+         * Makes room for a number of additional nodes of the given type, so adding them does not reallocate.
+         */
+        void reserve(std::type_index type, std::size_t additional);
+
         void add(std::unique_ptr<SceneNode> node) noexcept;
 
         void remove(SceneNode &node) noexcept;
 
+        /**
+         * Removes a batch of nodes, compacting the storage and each affected type list once at the end instead of
+         * swap-removing node by node. Unlike remove, the remaining nodes keep their relative order.
+         */
+        void remove_all(std::span<SceneNode *const> nodes);
+
       private:
         void index_node(SceneNode *node) noexcept;
 
@@ -0,0 +1,107 @@
+/**
+ * @file transform_table.ixx
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+module;
+
+#include "retro/core/exports.h"
+
+export module retro.runtime.world.transform_table;
+
+import std;
+import retro.core.math.transform;
+import retro.core.math.vector;
+import retro.runtime.world.scene_node;
+
+namespace retro
+{
+    /**
+     * A transform as the managed side lays it out, rotation in radians rather than as a matrix.
+     */
+    export struct NativeTransform2f
+    {
+        Vector2f position{};
+        float rotation = 0;
+        Vector2f scale{};
+    };
+
+    export RETRO_API Transform2f from_native(const NativeTransform2f &transform);
+
+    /**
+     * Where one chunk of a transform table lives. The arrays never move for as long as the table exists, which is what
+     * lets the managed side keep these pointers and write into them directly.
+     */
+    export struct TransformChunkView
+    {
+        float *position_x = nullptr;
+        float *position_y = nullptr;
+        float *rotation = nullptr;
+        float *scale_x = nullptr;
+        float *scale_y = nullptr;
+        std::uint64_t *dirty = nullptr;
+    };
+
+    /**
+     * Local transforms of scene nodes stored field by field, shared with the managed side. Writers fill in a slot and
+     * set its dirty bit, then apply_dirty converts every dirty slot and hands the result to its node. Storage grows a
+     * chunk at a time so that slots handed out earlier keep their address.
+     */
+    export class RETRO_API TransformTable
+    {
+      public:
+        static constexpr std::uint32_t chunk_size = 1024;
+        static constexpr std::uint32_t dirty_words_per_chunk = chunk_size / 64;
+
+        TransformTable();
+
+        TransformTable(const TransformTable &) = delete;
+        TransformTable(TransformTable &&) noexcept;
+
+        ~TransformTable();
+
+        TransformTable &operator=(const TransformTable &) = delete;
+        TransformTable &operator=(TransformTable &&) noexcept;
+
+        /**
+         * Binds a node to a free slot, seeded with the identity transform.
+         */
+        std::uint32_t allocate(SceneNode &node);
+
+        /**
+         * Unbinds the node in a slot, dropping any change that was still pending for it.
+         */
+        void release(std::uint32_t slot);
+
+        /**
+         * Releases whichever slot the node is bound to, if any.
+         */
+        void release(const SceneNode &node);
+
+        void write(std::uint32_t slot, const NativeTransform2f &transform);
+
+        [[nodiscard]] NativeTransform2f read(std::uint32_t slot) const;
+
+        [[nodiscard]] TransformChunkView chunk(std::uint32_t index) const;
+
+        [[nodiscard]] std::uint32_t chunk_count() const noexcept
+        {
+            return static_cast<std::uint32_t>(chunks_.size());
+        }
+
+        /**
+         * Pushes every pending change to its node and clears the dirty bits.
+         *
+         * @return The number of nodes that were updated.
+         */
+        std::size_t apply_dirty();
+
+      private:
+        struct Chunk;
+
+        std::vector<std::unique_ptr<Chunk>> chunks_;
+        std::vector<std::uint32_t> free_slots_;
+        std::unordered_map<const SceneNode *, std::uint32_t> slots_by_node_;
+    };
+} // namespace retro
@@ -0,0 +1,133 @@
+/**
+ * @file input_manager_test.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import std;
+import retro.platform.event;
+import retro.platform.input;
+import retro.runtime.input.input_manager;
+import retro.runtime.input.input_query;
+import retro.runtime.input.input_state;
+
+using namespace retro;
+
+namespace
+{
+    void press(InputManager &manager, const LogicalKey key, const PhysicalKey physical, const bool down)
+    {
+        manager.push_event(KeyEvent{.logical_key = key, .physical_key = physical, .down = down});
+    }
+} // namespace
+
+TEST(InputState, GamepadButtonsForOneButtonShareAContiguousRange)
+{
+    const auto &mask = any_gamepad_button_mask(GamepadButton::face_bottom);
+    EXPECT_EQ(mask.count(), max_gamepads);
+
+    for (std::size_t gamepad = 0; gamepad < max_gamepads; ++gamepad)
+    {
+        EXPECT_TRUE(mask.test(input_bit(0, GamepadButton::face_bottom) + gamepad));
+    }
+}
+
+TEST(InputManager, PressIsOnlyReportedOnTheFirstFrame)
+{
+    InputManager manager;
+    press(manager, LogicalKey::a, PhysicalKey::a, true);
+    manager.poll_events(1);
+
+    EXPECT_TRUE(manager.is_down(LogicalKey::a));
+    EXPECT_TRUE(manager.is_down(PhysicalKey::a));
+    EXPECT_TRUE(manager.was_pressed(LogicalKey::a));
+
+    manager.poll_events(2);
+    EXPECT_TRUE(manager.is_down(LogicalKey::a));
+    EXPECT_FALSE(manager.was_pressed(LogicalKey::a));
+
+    press(manager, LogicalKey::a, PhysicalKey::a, false);
+    manager.poll_events(3);
+    EXPECT_FALSE(manager.is_down(LogicalKey::a));
+}
+
+TEST(InputManager, BindingQueriesMatchRangeQueries)
+{
+    const std::array<DigitalInput, 3> inputs{LogicalKey::a, PhysicalKey::b, MouseButton::left};
+    const InputBinding binding{inputs};
+
+    InputManager manager;
+    manager.poll_events(1);
+    EXPECT_FALSE(manager.is_any_down(binding));
+    EXPECT_TRUE(manager.are_none_down(binding));
+
+    press(manager, LogicalKey::a, PhysicalKey::a, true);
+    manager.poll_events(2);
+    EXPECT_EQ(manager.is_any_down(binding), manager.is_any_down(inputs));
+    EXPECT_EQ(manager.are_all_down(binding), manager.are_all_down(inputs));
+    EXPECT_EQ(manager.was_any_pressed(binding), manager.was_any_pressed(inputs));
+    EXPECT_TRUE(manager.is_any_down(binding));
+    EXPECT_FALSE(manager.are_all_down(binding));
+
+    press(manager, LogicalKey::b, PhysicalKey::b, true);
+    manager.push_event(MouseButtonEvent{.button = MouseButton::left, .down = true});
+    manager.poll_events(3);
+    EXPECT_TRUE(manager.are_all_down(binding));
+    EXPECT_TRUE(manager.was_any_pressed(binding));
+    EXPECT_FALSE(manager.were_all_pressed(binding));
+    EXPECT_EQ(manager.were_all_pressed(binding), manager.were_all_pressed(inputs));
+}
+
+TEST(InputManager, AnyGamepadBindingsFollowConnectedGamepads)
+{
+    const std::array<DigitalInput, 2> inputs{AnyGamepadButtonInput{GamepadButton::face_bottom},
+                                             AnyGamepadAxisThreshold{GamepadAxis::left_x, 0.5f}};
+    const InputBinding binding{inputs};
+    EXPECT_EQ(binding.thresholds().size(), 1);
+
+    InputState state;
+    InputSnapshot snapshot;
+    state.enable_gamepad(3, 42);
+    state.set_gamepad_button_down(3, GamepadButton::face_bottom, true);
+    state.advance_snapshot(snapshot, 1);
+
+    EXPECT_TRUE(snapshot.is_down(3, GamepadButton::face_bottom));
+    EXPECT_TRUE(snapshot.is_any_down(binding));
+    EXPECT_TRUE(snapshot.was_any_pressed(binding));
+    EXPECT_FALSE(snapshot.are_all_down(binding));
+
+    state.set_gamepad_axis(3, GamepadAxis::left_x, 0.75f);
+    state.advance_snapshot(snapshot, 2);
+    EXPECT_TRUE(snapshot.are_all_down(binding));
+    EXPECT_TRUE(snapshot.was_any_pressed(binding));
+    EXPECT_FALSE(snapshot.were_all_pressed(binding));
+
+    state.disable_gamepad(3);
+    state.advance_snapshot(snapshot, 3);
+    EXPECT_TRUE(snapshot.are_none_down(binding));
+    EXPECT_EQ(snapshot.axis_on_any(GamepadAxis::left_x), 0.0f);
+}
+
+TEST(InputManager, UnknownMouseButtonNeverAliasesTheFirstGamepadBit)
+{
+    // Unknown sorts right after the real mouse buttons, which is where gamepad 0's first button lives
+    constexpr auto first_gamepad_button = static_cast<GamepadButton>(0);
+    ASSERT_EQ(input_bit(MouseButton::unknown), input_bit(0, first_gamepad_button));
+
+    const std::array<DigitalInput, 1> inputs{MouseButton::unknown};
+    const InputBinding binding{inputs};
+    EXPECT_TRUE(binding.exact().none());
+
+    InputState state;
+    InputSnapshot snapshot;
+    state.enable_gamepad(0, 7);
+    state.set_gamepad_button_down(0, first_gamepad_button, true);
+    state.advance_snapshot(snapshot, 1);
+
+    EXPECT_TRUE(snapshot.is_down(0, first_gamepad_button));
+    EXPECT_FALSE(snapshot.is_down(MouseButton::unknown));
+    EXPECT_FALSE(snapshot.was_pressed(MouseButton::unknown));
+    EXPECT_FALSE(snapshot.is_any_down(binding));
+}
@@ -0,0 +1,125 @@
+/**
+ * @file input_recording_test.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import std;
+import retro.core.util.exceptions;
+import retro.platform.backend;
+import retro.platform.event;
+import retro.platform.input;
+import retro.runtime.input.input_recording;
+
+using namespace retro;
+
+namespace
+{
+    class InputRecordingTest : public testing::Test
+    {
+      protected:
+        void TearDown() override
+        {
+            std::error_code error;
+            std::filesystem::remove(path_, error);
+        }
+
+        std::filesystem::path path_ = std::filesystem::temp_directory_path() /
+                                      std::format("retro_input_recording_{}.bin", std::random_device{}());
+    };
+} // namespace
+
+TEST_F(InputRecordingTest, EventsRoundTripWithTheirFrames)
+{
+    {
+        InputRecorder recorder{path_};
+        recorder.record(
+            0,
+            KeyEvent{.window_id = 1, .logical_key = LogicalKey::w, .physical_key = PhysicalKey::w, .down = true});
+        recorder.record(0, CallbackEvent{[] {}});
+        recorder.record(3, MouseMovedEvent{.window_id = 1, .x = 12.5f, .y = -4.0f, .dx = 1.0f, .dy = 2.0f});
+        recorder.record(300, QuitEvent{});
+        EXPECT_EQ(recorder.event_count(), 3);
+    }
+
+    const auto events = read_input_recording(path_);
+    ASSERT_EQ(events.size(), 3);
+
+    EXPECT_EQ(events[0].frame, 0);
+    const auto &key = std::get<KeyEvent>(events[0].event);
+    EXPECT_EQ(key.logical_key, LogicalKey::w);
+    EXPECT_EQ(key.physical_key, PhysicalKey::w);
+    EXPECT_TRUE(key.down);
+    EXPECT_FALSE(key.repeat);
+
+    EXPECT_EQ(events[1].frame, 3);
+    const auto &moved = std::get<MouseMovedEvent>(events[1].event);
+    EXPECT_EQ(moved.x, 12.5f);
+    EXPECT_EQ(moved.y, -4.0f);
+    EXPECT_EQ(moved.dy, 2.0f);
+
+    EXPECT_EQ(events[2].frame, 300);
+    EXPECT_TRUE(std::holds_alternative<QuitEvent>(events[2].event));
+    EXPECT_LE(events[0].time, events[2].time);
+}
+
+TEST_F(InputRecordingTest, LongRecordingsReachTheFileBeforeTheyEnd)
+{
+    InputRecorder recorder{path_};
+    const auto header_size = std::filesystem::file_size(path_);
+
+    for (std::uint64_t frame = 0; frame < 2000; ++frame)
+    {
+        recorder.record(frame, MouseMovedEvent{.window_id = 1, .x = 1.0f, .y = 2.0f, .dx = 3.0f, .dy = 4.0f});
+    }
+    EXPECT_GT(std::filesystem::file_size(path_), header_size);
+
+    recorder.flush();
+    EXPECT_EQ(read_input_recording(path_).size(), 2000);
+}
+
+TEST_F(InputRecordingTest, ReplayReleasesEventsFrameByFrame)
+{
+    {
+        InputRecorder recorder{path_};
+        recorder.record(1, MouseButtonEvent{.button = MouseButton::left, .down = true});
+        recorder.record(1, MouseButtonEvent{.button = MouseButton::left, .down = false});
+        recorder.record(4, GamepadDeviceEvent{.change_type = GamepadChangeType::connected, .gamepad_id = 7});
+    }
+
+    const auto backend = PlatformBackend::create({.kind = PlatformBackendKind::headless});
+    InputReplayer replayer{read_input_recording(path_)};
+    EXPECT_EQ(replayer.last_frame(), 4);
+
+    EXPECT_EQ(replayer.pump(*backend, 0), 0);
+    EXPECT_FALSE(backend->poll_event().has_value());
+
+    EXPECT_EQ(replayer.pump(*backend, 3), 2);
+    EXPECT_TRUE(std::get<MouseButtonEvent>(*backend->poll_event()).down);
+    EXPECT_FALSE(std::get<MouseButtonEvent>(*backend->poll_event()).down);
+    EXPECT_FALSE(backend->poll_event().has_value());
+
+    EXPECT_EQ(replayer.pump(*backend, 4), 1);
+    EXPECT_EQ(std::get<GamepadDeviceEvent>(*backend->poll_event()).gamepad_id, 7);
+    EXPECT_TRUE(replayer.finished());
+}
+
+TEST_F(InputRecordingTest, RejectsFilesThatAreNotRecordings)
+{
+    {
+        std::ofstream stream{path_, std::ios::binary};
+        stream << "definitely not a recording";
+    }
+
+    EXPECT_ANY_THROW(std::ignore = read_input_recording(path_));
+}
+
+#ifdef __linux__
+TEST_F(InputRecordingTest, FailedWritesAreReported)
+{
+    // Every write to /dev/full fails with ENOSPC, so even the header can't be written out
+    EXPECT_THROW(InputRecorder{"/dev/full"}, IoException);
+}
+#endif
@@ -0,0 +1,129 @@
+/**
+ * @file async_sink_test.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import std;
+import spdlog;
+import retro.logging.async_sink;
+
+using namespace retro;
+
+namespace
+{
+    /**
+     * Collects the payloads it receives, optionally holding the background thread until it is released.
+     */
+    class CollectingSink final : public spdlog::sinks::sink
+    {
+      public:
+        explicit CollectingSink(const bool hold = false) : released_{!hold}
+        {
+        }
+
+        void log(const spdlog::details::log_msg &msg) override
+        {
+            released_.wait(false);
+
+            std::scoped_lock lock{mutex_};
+            messages_.emplace_back(msg.payload.data(), msg.payload.size());
+        }
+
+        void flush() override
+        {
+        }
+
+        void set_pattern(const std::string &) override
+        {
+        }
+
+        void set_formatter(std::unique_ptr<spdlog::formatter>) override
+        {
+        }
+
+        void release()
+        {
+            released_.store(true);
+            released_.notify_all();
+        }
+
+        std::vector<std::string> messages()
+        {
+            std::scoped_lock lock{mutex_};
+            return messages_;
+        }
+
+      private:
+        std::atomic<bool> released_;
+        std::mutex mutex_;
+        std::vector<std::string> messages_;
+    };
+
+    void log(spdlog::sinks::sink &sink, const std::string_view message)
+    {
+        sink.log(spdlog::details::log_msg{spdlog::string_view_t{"test"},
+                                          spdlog::level::info,
+                                          spdlog::string_view_t{message.data(), message.size()}});
+    }
+} // namespace
+
+TEST(AsyncLogSink, FlushWaitsForEverythingLoggedBefore)
+{
+    const auto target = std::make_shared<CollectingSink>();
+    AsyncLogSink sink{target, AsyncLogOptions{.capacity = 4}};
+
+    std::vector<std::string> expected;
+    for (std::int32_t i = 0; i < 100; ++i)
+    {
+        expected.push_back(std::format("message {}", i));
+        log(sink, expected.back());
+    }
+
+    sink.flush();
+    EXPECT_EQ(target->messages(), expected);
+    EXPECT_EQ(sink.dropped_count(), 0);
+}
+
+TEST(AsyncLogSink, MessagesFromSeveralThreadsAllArrive)
+{
+    const auto target = std::make_shared<CollectingSink>();
+    {
+        AsyncLogSink sink{target, AsyncLogOptions{.capacity = 16}};
+
+        std::vector<std::jthread> threads;
+        for (std::int32_t t = 0; t < 4; ++t)
+        {
+            threads.emplace_back(
+                [&sink, t]
+                {
+                    for (std::int32_t i = 0; i < 250; ++i)
+                    {
+                        log(sink, std::format("{}:{}", t, i));
+                    }
+                });
+        }
+    }
+
+    EXPECT_EQ(target->messages().size(), 1000);
+}
+
+TEST(AsyncLogSink, DropPolicyCountsWhatDidNotFit)
+{
+    const auto target = std::make_shared<CollectingSink>(true);
+    AsyncLogSink sink{target, AsyncLogOptions{.capacity = 4, .overflow_policy = LogOverflowPolicy::drop}};
+
+    // One message may already sit in the held target, the rest of those that fit wait in the queue
+    for (std::int32_t i = 0; i < 20; ++i)
+    {
+        log(sink, "message");
+    }
+
+    target->release();
+    sink.flush();
+
+    EXPECT_GE(sink.dropped_count(), 15);
+    EXPECT_EQ(target->messages().size() + sink.dropped_count(), 20);
+}
@@ -0,0 +1,176 @@
+/**
+ * @file logger_test.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import std;
+import spdlog;
+import retro.logging;
+
+using namespace retro;
+
+namespace
+{
+    class CountingSink final : public spdlog::sinks::sink
+    {
+      public:
+        void log(const spdlog::details::log_msg &) override
+        {
+            ++count_;
+        }
+
+        void flush() override
+        {
+        }
+
+        void set_pattern(const std::string &) override
+        {
+        }
+
+        void set_formatter(std::unique_ptr<spdlog::formatter>) override
+        {
+        }
+
+        [[nodiscard]] std::int32_t count() const noexcept
+        {
+            return count_;
+        }
+
+      private:
+        std::int32_t count_ = 0;
+    };
+
+    /**
+     * Counts how many times it is formatted, to tell whether a filtered call did any formatting work.
+     */
+    struct FormatCounter
+    {
+        std::int32_t *count;
+    };
+
+    constexpr std::array all_levels{LogLevel::trace,
+                                    LogLevel::debug,
+                                    LogLevel::info,
+                                    LogLevel::warn,
+                                    LogLevel::error,
+                                    LogLevel::critical};
+
+    class LoggerTest : public testing::Test
+    {
+      protected:
+        std::shared_ptr<CountingSink> sink_ = std::make_shared<CountingSink>();
+        spdlog::logger spd_logger_{"logger_test", sink_};
+        Logger logger_{&spd_logger_};
+    };
+} // namespace
+
+template <>
+struct std::formatter<FormatCounter> : std::formatter<std::string_view>
+{
+    auto format(const FormatCounter &counter, std::format_context &context) const
+    {
+        ++*counter.count;
+        return std::formatter<std::string_view>::format("counted", context);
+    }
+};
+
+TEST_F(LoggerTest, FiltersAreCheckedBeforeTheFactoryRuns)
+{
+    spd_logger_.set_level(spdlog::level::err);
+
+    std::int32_t invocations = 0;
+    const auto factory = [&invocations]
+    {
+        ++invocations;
+        return std::string{"expensive"};
+    };
+
+    logger_.log(LogLevel::info, factory);
+    logger_.info(factory);
+    logger_.warn(factory);
+    EXPECT_EQ(invocations, 0);
+    EXPECT_EQ(sink_->count(), 0);
+
+    logger_.error(factory);
+    EXPECT_EQ(invocations, is_log_level_compiled(LogLevel::error) ? 1 : 0);
+    EXPECT_EQ(sink_->count(), invocations);
+}
+
+TEST_F(LoggerTest, FilteredMessagesAreNeverFormatted)
+{
+    spd_logger_.set_level(spdlog::level::warn);
+
+    std::int32_t formats = 0;
+    logger_.log(LogLevel::debug, "value {}", FormatCounter{&formats});
+    logger_.info("value {}", FormatCounter{&formats});
+    EXPECT_EQ(formats, 0);
+    EXPECT_EQ(sink_->count(), 0);
+
+    logger_.warn("value {}", FormatCounter{&formats});
+    EXPECT_EQ(formats, is_log_level_compiled(LogLevel::warn) ? 1 : 0);
+}
+
+TEST_F(LoggerTest, ShouldLogFollowsTheRuntimeLevel)
+{
+    for (const auto threshold : all_levels)
+    {
+        spd_logger_.set_level(to_spd_level(threshold));
+        for (const auto level : all_levels)
+        {
+            EXPECT_EQ(logger_.should_log(level), is_log_level_compiled(level) && level >= threshold)
+                << to_string(level) << " with the level set to " << to_string(threshold);
+        }
+    }
+
+    spd_logger_.set_level(spdlog::level::off);
+    EXPECT_FALSE(logger_.should_log(LogLevel::critical));
+}
+
+TEST_F(LoggerTest, DefaultLoggerCheckUsedByManagedCodeFollowsSetLevel)
+{
+    auto *default_logger = spdlog::default_logger_raw();
+    const auto previous = default_logger->level();
+
+    default_logger->set_level(spdlog::level::err);
+    EXPECT_FALSE(get_logger().should_log(LogLevel::warn));
+    EXPECT_EQ(get_logger().should_log(LogLevel::error), is_log_level_compiled(LogLevel::error));
+
+    default_logger->set_level(previous);
+}
+
+TEST_F(LoggerTest, CompiledLevelGatesThePerLevelMethods)
+{
+    static_assert(!is_log_level_compiled(LogLevel::off));
+    static_assert(is_log_level_compiled(min_compiled_log_level) || min_compiled_log_level == LogLevel::off);
+    for (const auto level : all_levels)
+    {
+        EXPECT_EQ(is_log_level_compiled(level), level >= min_compiled_log_level);
+    }
+
+    // With everything enabled at runtime, only the compiled out levels may skip the factory
+    spd_logger_.set_level(spdlog::level::trace);
+    std::array<std::int32_t, all_levels.size()> invocations{};
+    const auto factory_for = [&invocations](const LogLevel level)
+    {
+        return [&invocations, level]
+        {
+            ++invocations[std::to_underlying(level)];
+            return std::string{"message"};
+        };
+    };
+
+    logger_.trace(factory_for(LogLevel::trace));
+    logger_.debug(factory_for(LogLevel::debug));
+    logger_.info(factory_for(LogLevel::info));
+    logger_.warn(factory_for(LogLevel::warn));
+    logger_.error(factory_for(LogLevel::error));
+    logger_.critical(factory_for(LogLevel::critical));
+
+    for (const auto level : all_levels)
+    {
+        EXPECT_EQ(invocations[std::to_underlying(level)], is_log_level_compiled(level) ? 1 : 0) << to_string(level);
+    }
+}
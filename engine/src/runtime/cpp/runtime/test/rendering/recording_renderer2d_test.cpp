@@ -0,0 +1,70 @@
+/**
+ * @file recording_renderer2d_test.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import std;
+import retro.platform.backend;
+import retro.platform.window;
+import retro.runtime.rendering.draw_command;
+import retro.runtime.rendering.headless_render_backend;
+import retro.runtime.rendering.objects.sprite;
+import retro.runtime.rendering.pipeline_manager;
+import retro.runtime.rendering.recording_renderer2d;
+import retro.runtime.rendering.render_pipeline;
+import retro.runtime.rendering.texture;
+import retro.runtime.world.scene;
+import retro.runtime.world.viewport;
+
+using namespace retro;
+
+TEST(RecordingRenderer2D, ExpandsQueuedFramesIntoDrawCommands)
+{
+    const auto platform = PlatformBackend::create(PlatformBackendInfo{.kind = PlatformBackendKind::headless});
+    HeadlessRenderBackend render_backend{HeadlessRenderMode::record};
+    const auto renderer = render_backend.create_renderer(platform->create_window(WindowDesc{}));
+    auto &recorder = dynamic_cast<RecordingRenderer2D &>(*renderer);
+
+    SpriteRenderPipeline sprite_pipeline;
+    recorder.add_new_render_pipeline(sprite_pipeline.component_type(), sprite_pipeline);
+    std::array<RenderPipeline *, 1> pipelines{&sprite_pipeline};
+    PipelineManager pipeline_manager{pipelines};
+
+    constexpr std::array<std::byte, 4> pixel{};
+    const auto texture =
+        render_backend.upload_texture(pixel, 1, 1, TextureFormat::rgba8, TextureFilter::nearest, {}).get();
+
+    Scene scene;
+    for (std::int32_t i = 0; i < 3; ++i)
+    {
+        scene.create_node<Sprite>().set_texture(texture);
+    }
+    const Viewport viewport{AnchorData{}, 0};
+
+    recorder.queue_frame_for_render(
+        [&](std::pmr::memory_resource &resource)
+        {
+            std::pmr::vector<DrawCommandSet> sets{&resource};
+            sets.push_back(pipeline_manager.collect_draw_command_sources(scene.nodes(),
+                                                                         recorder.window().size(),
+                                                                         viewport,
+                                                                         resource));
+            return sets;
+        });
+    recorder.render_next_available_frame();
+
+    const auto stats = recorder.last_frame();
+    EXPECT_EQ(stats.draw_command_sets, 1);
+    EXPECT_EQ(stats.draw_command_sources, 1);
+    EXPECT_EQ(stats.draw_commands, 1);
+    EXPECT_EQ(stats.instances, 3);
+    EXPECT_GT(stats.uploaded_bytes, 0);
+    EXPECT_EQ(recorder.frames_rendered(), 1);
+
+    // Nothing new was queued, so there is nothing to record
+    recorder.render_next_available_frame();
+    EXPECT_EQ(recorder.frames_rendered(), 1);
+}
@@ -54,3 +54,76 @@ TEST(FontService, LoadFontFace)
     EXPECT_FALSE(font->family_name().empty());
     EXPECT_FALSE(font->style_name().empty());
 }
+
+TEST(FontService, GlyphsAreTaggedWithValidPages)
+{
+    HeadlessRenderBackend render_backend{};
+    const FontService service{render_backend};
+
+    auto bytes = read_test_font();
+    ASSERT_FALSE(bytes.empty());
+
+    const auto font = service.load_font(std::move(bytes)).get();
+    font->add_glyphs_if_missing(U"ÀÁÂÃÄÅÆÇÈÉ");
+
+    const auto &atlas = font->atlas();
+    ASSERT_GE(atlas.page_count(), 1);
+    for (std::size_t page = 0; page < atlas.page_count(); ++page)
+    {
+        const auto texture = atlas.texture(page);
+        ASSERT_NE(texture, nullptr);
+        EXPECT_LE(texture->width(), 1024);
+        EXPECT_LE(texture->height(), 1024);
+    }
+
+    for (const auto &glyph : atlas.glyphs() | std::views::values)
+    {
+        EXPECT_LT(glyph.page, atlas.page_count());
+    }
+}
+
+TEST(FontService, EvictedGlyphsAreRegeneratedOnAValidPage)
+{
+    HeadlessRenderBackend render_backend{};
+    const FontService service{render_backend};
+
+    auto bytes = read_test_font();
+    ASSERT_FALSE(bytes.empty());
+
+    // Pages this small only fit a handful of glyphs, so the budget is exhausted by the initial charset alone
+    constexpr FontMsdfAtlasConfig tiny_pages{.pixel_size = 24,
+                                             .distance_range = 2.0f,
+                                             .min_page_side = 64,
+                                             .max_page_side = 64,
+                                             .max_pages = 2};
+    const auto font = service.load_font(std::move(bytes), tiny_pages).get();
+    const auto &atlas = font->atlas();
+
+    const auto initial_generation = atlas.generation();
+    const auto initial_glyphs = atlas.glyphs() | std::views::keys | std::ranges::to<std::vector>();
+
+    font->add_glyphs_if_missing(U"ÀÁÂÃÄÅÆÇÈÉ");
+    const auto evicted_generation = atlas.generation();
+    ASSERT_GT(evicted_generation, initial_generation);
+
+    const auto evicted = initial_glyphs |
+                         std::views::filter([&atlas](const char32_t codepoint)
+                                            { return !atlas.glyphs().contains(codepoint); }) |
+                         std::ranges::to<std::u32string>();
+    ASSERT_FALSE(evicted.empty());
+
+    font->add_glyphs_if_missing(evicted);
+    EXPECT_GE(atlas.generation(), evicted_generation);
+
+    for (const auto codepoint : evicted)
+    {
+        const auto glyph = atlas.glyphs().find(codepoint);
+        ASSERT_NE(glyph, atlas.glyphs().end());
+        ASSERT_LT(glyph->second.page, atlas.page_count());
+
+        const auto texture = atlas.texture(glyph->second.page);
+        ASSERT_NE(texture, nullptr);
+        EXPECT_LE(texture->width(), tiny_pages.max_page_side);
+        EXPECT_LE(texture->height(), tiny_pages.max_page_side);
+    }
+}
@@ -0,0 +1,127 @@
+/**
+ * @file scene_commands_test.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import std;
+import retro.core.math.transform;
+import retro.core.math.vector;
+import retro.core.util.color;
+import retro.runtime.rendering.layout.margin;
+import retro.runtime.rendering.layout.uvs;
+import retro.runtime.rendering.objects.geometry;
+import retro.runtime.rendering.objects.sprite;
+import retro.runtime.rendering.objects.text_block;
+import retro.runtime.world.scene;
+import retro.runtime.world.scene_commands;
+import retro.runtime.world.scene_node;
+import retro.runtime.world.transform_table;
+
+using namespace retro;
+
+namespace
+{
+    SceneCommand make_command(SceneNode &node, const SceneCommandType type, const auto &set_payload)
+    {
+        SceneCommand command{.node = &node, .type = type};
+        set_payload(command);
+        return command;
+    }
+
+    SceneCommand make_command(SceneNode &node, const SceneCommandType type)
+    {
+        return SceneCommand{.node = &node, .type = type};
+    }
+
+    void expect_color(const Color actual, const Color expected)
+    {
+        EXPECT_EQ(actual.red, expected.red);
+        EXPECT_EQ(actual.green, expected.green);
+        EXPECT_EQ(actual.blue, expected.blue);
+        EXPECT_EQ(actual.alpha, expected.alpha);
+    }
+} // namespace
+
+TEST(SceneCommands, ReplayingAStreamAppliesEveryCommandInOrder)
+{
+    Scene scene;
+    auto &parent = scene.create_node<SceneNode>();
+    auto &sprite = scene.create_node<Sprite>();
+    auto &geometry = scene.create_node<GeometryObject>();
+    auto &text_block = scene.create_node<TextBlock>();
+
+    constexpr NativeTransform2f transform{.position = {3, 4}, .rotation = 0, .scale = {2, 2}};
+    const Color sprite_tint{0.25f, 0.5f, 0.75f, 1.0f};
+    const Color geometry_color{1.0f, 0.0f, 0.5f, 0.5f};
+    const Color text_tint{0.0f, 1.0f, 0.0f, 0.25f};
+    const UVs uvs{.min = {0.25f, 0.25f}, .max = {0.5f, 0.75f}};
+    const Margin margin{.left = 1, .top = 2, .right = 3, .bottom = 4};
+
+    const std::vector commands{
+        make_command(sprite, SceneCommandType::set_transform, [&](auto &c) { c.transform = transform; }),
+        make_command(sprite, SceneCommandType::set_z_order, [](auto &c) { c.z_order = 3; }),
+        make_command(sprite, SceneCommandType::set_z_order, [](auto &c) { c.z_order = 7; }),
+        make_command(sprite, SceneCommandType::attach_to_parent, [&](auto &c) { c.parent = &parent; }),
+        make_command(geometry, SceneCommandType::attach_to_parent, [&](auto &c) { c.parent = &parent; }),
+        make_command(geometry, SceneCommandType::detach_from_parent),
+        make_command(sprite, SceneCommandType::set_sprite_tint, [&](auto &c) { c.color = sprite_tint; }),
+        make_command(sprite, SceneCommandType::set_sprite_pivot, [](auto &c) { c.vector = Vector2f{0.5f, 1}; }),
+        make_command(sprite, SceneCommandType::set_sprite_size, [](auto &c) { c.vector = Vector2f{32, 16}; }),
+        make_command(sprite, SceneCommandType::set_sprite_uv_rect, [&](auto &c) { c.uvs = uvs; }),
+        make_command(sprite,
+                     SceneCommandType::set_sprite_draw_mode,
+                     [](auto &c) { c.draw_mode = SpriteDrawMode::box; }),
+        make_command(sprite, SceneCommandType::set_sprite_margin, [&](auto &c) { c.margin = margin; }),
+        make_command(geometry, SceneCommandType::set_geometry_color, [&](auto &c) { c.color = geometry_color; }),
+        make_command(geometry, SceneCommandType::set_geometry_pivot, [](auto &c) { c.vector = Vector2f{1, 0}; }),
+        make_command(geometry, SceneCommandType::set_geometry_size, [](auto &c) { c.vector = Vector2f{8, 24}; }),
+        make_command(text_block, SceneCommandType::set_text_block_tint, [&](auto &c) { c.color = text_tint; }),
+        make_command(text_block, SceneCommandType::set_text_block_pivot, [](auto &c) { c.vector = Vector2f{0, 1}; }),
+    };
+
+    apply_scene_commands(commands);
+
+    EXPECT_EQ(sprite.transform(), from_native(transform));
+    EXPECT_EQ(sprite.z_order(), 7);
+    EXPECT_EQ(sprite.parent(), &parent);
+    EXPECT_EQ(geometry.parent(), nullptr);
+    EXPECT_TRUE(std::ranges::equal(parent.children(), std::array<SceneNode *, 1>{&sprite}));
+
+    expect_color(sprite.tint(), sprite_tint);
+    EXPECT_EQ(sprite.pivot(), (Vector2f{0.5f, 1}));
+    EXPECT_EQ(sprite.size(), (Vector2f{32, 16}));
+    EXPECT_EQ(sprite.uvs().min, uvs.min);
+    EXPECT_EQ(sprite.uvs().max, uvs.max);
+    EXPECT_EQ(sprite.draw_mode(), SpriteDrawMode::box);
+    EXPECT_EQ(sprite.margin(), margin);
+
+    expect_color(geometry.color(), geometry_color);
+    EXPECT_EQ(geometry.pivot(), (Vector2f{1, 0}));
+    EXPECT_EQ(geometry.size(), (Vector2f{8, 24}));
+
+    expect_color(text_block.tint(), text_tint);
+    EXPECT_EQ(text_block.pivot(), (Vector2f{0, 1}));
+}
+
+TEST(SceneCommands, CommandsOnlyTouchTheirOwnNode)
+{
+    Scene scene;
+    auto &first = scene.create_node<SceneNode>();
+    auto &second = scene.create_node<SceneNode>();
+    second.set_z_order(5);
+
+    constexpr NativeTransform2f transform{.position = {1, 1}, .rotation = 0, .scale = {1, 1}};
+    const std::array commands{
+        make_command(first, SceneCommandType::set_z_order, [](auto &c) { c.z_order = -2; }),
+        make_command(first, SceneCommandType::set_transform, [&](auto &c) { c.transform = transform; }),
+    };
+    apply_scene_commands(commands);
+
+    EXPECT_EQ(first.z_order(), -2);
+    EXPECT_EQ(first.transform().translation(), (Vector2f{1, 1}));
+    EXPECT_EQ(second.z_order(), 5);
+    EXPECT_EQ(second.transform(), Transform2f{});
+}
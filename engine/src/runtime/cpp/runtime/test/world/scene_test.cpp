@@ -0,0 +1,67 @@
+/**
+ * @file scene_test.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import std;
+import retro.runtime.world.scene;
+import retro.runtime.world.scene_node;
+import retro.runtime.world.transform_table;
+
+using namespace retro;
+
+namespace
+{
+    class OtherNode final : public SceneNode
+    {
+    };
+} // namespace
+
+TEST(Scene, CreateNodesIndexesEveryNodeByType)
+{
+    Scene scene;
+    const auto created = scene.create_nodes<SceneNode>(16);
+
+    ASSERT_EQ(created.size(), 16);
+    EXPECT_EQ(scene.nodes().nodes().size(), 16);
+    EXPECT_TRUE(std::ranges::equal(scene.nodes_of_type<SceneNode>(), created));
+}
+
+TEST(Scene, DestroyNodesKeepsTheRemainingNodesInOrder)
+{
+    Scene scene;
+    const auto nodes = scene.create_nodes<SceneNode>(8);
+    const auto others = scene.create_nodes<OtherNode>(2);
+
+    const std::array<SceneNode *, 4> destroyed{nodes[1], others[0], nodes[4], nodes[7]};
+    scene.destroy_nodes(destroyed);
+
+    const std::array<SceneNode *, 5> expected{nodes[0], nodes[2], nodes[3], nodes[5], nodes[6]};
+    EXPECT_TRUE(std::ranges::equal(scene.nodes_of_type<SceneNode>(), expected));
+    EXPECT_TRUE(std::ranges::equal(scene.nodes_of_type<OtherNode>(), std::array{others[1]}));
+    EXPECT_EQ(scene.nodes().nodes().size(), 6);
+
+    // The indices have to be right afterward for single removal to keep working
+    scene.destroy_node(*nodes[3]);
+    scene.destroy_node(*others[1]);
+    const std::array<SceneNode *, 4> remaining{nodes[0], nodes[2], nodes[5], nodes[6]};
+    EXPECT_TRUE(std::ranges::equal(scene.nodes_of_type<SceneNode>(), remaining));
+    EXPECT_TRUE(std::ranges::equal(scene.nodes().nodes(), remaining, {}, [](const auto &node) { return node.get(); }));
+}
+
+TEST(Scene, DestroyNodesReleasesTransformsAndIgnoresDuplicates)
+{
+    Scene scene;
+    const auto nodes = scene.create_nodes<SceneNode>(2);
+    const auto slot = scene.transforms().allocate(*nodes[0]);
+    scene.transforms().write(slot, NativeTransform2f{.position = {1, 2}, .rotation = 0, .scale = {1, 1}});
+
+    const std::array<SceneNode *, 2> destroyed{nodes[0], nodes[0]};
+    scene.destroy_nodes(destroyed);
+
+    EXPECT_EQ(scene.transforms().apply_dirty(), 0);
+    EXPECT_EQ(scene.nodes().nodes().size(), 1);
+}
@@ -0,0 +1,125 @@
+/**
+ * @file transform_table_test.cpp
+ *
+ * @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ */
+#include <gtest/gtest.h>
+
+import std;
+import retro.core.math.vector;
+import retro.runtime.world.scene;
+import retro.runtime.world.scene_node;
+import retro.runtime.world.transform_table;
+
+using namespace retro;
+
+TEST(TransformTable, OnlyDirtySlotsReachTheirNodes)
+{
+    Scene scene;
+    auto &first = scene.create_node<SceneNode>();
+    auto &second = scene.create_node<SceneNode>();
+
+    auto &table = scene.transforms();
+    const auto first_slot = table.allocate(first);
+    table.allocate(second);
+
+    const NativeTransform2f moved{.position = {3, 4}, .rotation = 0, .scale = {1, 1}};
+    table.write(first_slot, moved);
+
+    EXPECT_EQ(table.apply_dirty(), 1);
+    EXPECT_EQ(first.transform().translation(), (Vector2f{3, 4}));
+    EXPECT_TRUE(second.transform().is_identity());
+
+    EXPECT_EQ(table.apply_dirty(), 0);
+}
+
+TEST(TransformTable, ChunkViewWritesAreApplied)
+{
+    Scene scene;
+    auto &node = scene.create_node<SceneNode>();
+    const auto slot = scene.transforms().allocate(node);
+
+    const auto view = scene.transforms().chunk(slot / TransformTable::chunk_size);
+    const auto index = slot % TransformTable::chunk_size;
+    view.position_x[index] = 7;
+    view.dirty[index / 64] |= std::uint64_t{1} << (index % 64);
+
+    EXPECT_EQ(scene.transforms().apply_dirty(), 1);
+    EXPECT_EQ(node.transform().translation(), (Vector2f{7, 0}));
+}
+
+TEST(TransformTable, SlotsKeepTheirAddressWhenTheTableGrows)
+{
+    Scene scene;
+    auto &table = scene.transforms();
+    const auto first = table.allocate(scene.create_node<SceneNode>());
+    const auto *position_x = table.chunk(0).position_x;
+
+    for (std::uint32_t i = 0; i < TransformTable::chunk_size; ++i)
+    {
+        table.allocate(scene.create_node<SceneNode>());
+    }
+
+    EXPECT_EQ(table.chunk_count(), 2);
+    EXPECT_EQ(table.chunk(0).position_x, position_x);
+    EXPECT_EQ(table.read(first).scale, (Vector2f{1, 1}));
+}
+
+TEST(TransformTable, DestroyingANodeDropsItsPendingTransform)
+{
+    Scene scene;
+    auto &node = scene.create_node<SceneNode>();
+    const auto slot = scene.transforms().allocate(node);
+    scene.transforms().write(slot, NativeTransform2f{.position = {1, 1}, .rotation = 0, .scale = {1, 1}});
+
+    scene.destroy_node(node);
+
+    EXPECT_EQ(scene.transforms().apply_dirty(), 0);
+}
+
+TEST(TransformTable, AllocatingABoundNodeAgainKeepsItsSlot)
+{
+    Scene scene;
+    auto &node = scene.create_node<SceneNode>();
+    auto &table = scene.transforms();
+    const auto slot = table.allocate(node);
+
+    EXPECT_EQ(table.allocate(node), slot);
+
+    table.release(node);
+    const auto next = table.allocate(scene.create_node<SceneNode>());
+    EXPECT_EQ(next, slot);
+}
+
+TEST(TransformTable, SparseAndDenseWordsApplyTheSameTransforms)
+{
+    Scene scene;
+    auto &table = scene.transforms();
+
+    std::vector<SceneNode *> nodes;
+    std::vector<std::uint32_t> slots;
+    for (std::uint32_t i = 0; i < 128; ++i)
+    {
+        auto &node = scene.create_node<SceneNode>();
+        nodes.push_back(&node);
+        slots.push_back(table.allocate(node));
+    }
+
+    // The first word only has a couple of dirty slots, the second has every slot dirty
+    const auto moved = [](const std::uint32_t i)
+    { return NativeTransform2f{.position = {static_cast<float>(i), 1}, .rotation = 0.5f, .scale = {2, 2}}; };
+    table.write(slots[3], moved(3));
+    table.write(slots[40], moved(40));
+    for (std::uint32_t i = 64; i < 128; ++i)
+    {
+        table.write(slots[i], moved(i));
+    }
+
+    EXPECT_EQ(table.apply_dirty(), 66);
+    for (const auto i : {3U, 40U, 64U, 100U, 127U})
+    {
+        EXPECT_EQ(nodes[i]->transform(), from_native(moved(i))) << i;
+    }
+    EXPECT_TRUE(nodes[4]->transform().is_identity());
+}
@@ -3,6 +3,7 @@
 // @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
 // Licensed under the MIT License. See LICENSE file in the project root for full license information.
 
+using System.Collections.Concurrent;
 using System.Runtime.InteropServices;
 using RetroEngine.Interop;
 using Serilog.Core;
@@ -12,6 +13,9 @@ namespace RetroEngine.Logging;
 
 public sealed partial class EngineLogSink : ILogEventSink
 {
+    // Native handles to the UTF-8 source locations, so names are only converted the first time a call site logs
+    private static readonly ConcurrentDictionary<(string Method, string File, int Line), IntPtr> CallSites = new();
+
     public void Emit(LogEvent logEvent)
     {
         var level = logEvent.Level switch
@@ -25,6 +29,10 @@ public sealed partial class EngineLogSink : ILogEventSink
             _ => LogLevel.Off,
         };
 
+        // Rendering the message is the expensive part, skip it for anything the engine log would discard anyway
+        if (!IsEnabled(level))
+            return;
+
         var message = logEvent.RenderMessage();
         var fullMessage = logEvent.Exception is not null ? $"{message}\n{logEvent.Exception}" : message;
 
@@ -34,7 +42,12 @@ public sealed partial class EngineLogSink : ILogEventSink
             && logEvent.Properties.GetValueOrDefault("LineNumber") is ScalarValue { Value: int line }
         )
         {
-            NativeLog(level, fullMessage, fullMessage.Length, name, name.Length, file, file.Length, line);
+            var callSite = CallSites.GetOrAdd(
+                (name, file, line),
+                static key =>
+                    NativeRegisterCallSite(key.Method, key.Method.Length, key.File, key.File.Length, key.Line)
+            );
+            NativeLogAtCallSite(level, callSite, fullMessage, fullMessage.Length);
         }
         else
         {
@@ -42,18 +55,33 @@ public sealed partial class EngineLogSink : ILogEventSink
         }
     }
 
+    /// <summary>
+    /// Whether the engine log writes messages at the given level, taking both the level compiled into the native
+    /// library and the current runtime level into account.
+    /// </summary>
+    public static bool IsEnabled(LogLevel level) => NativeShouldLog(level);
+
+    [LibraryImport(NativeLibraries.RetroLogging, EntryPoint = "retro_log_should_log")]
+    [return: MarshalAs(UnmanagedType.I1)]
+    private static partial bool NativeShouldLog(LogLevel level);
+
     [LibraryImport(NativeLibraries.RetroLogging, EntryPoint = "retro_log")]
     private static unsafe partial void NativeLog(LogLevel level, ReadOnlySpan<char> message, int length);
 
-    [LibraryImport(NativeLibraries.RetroLogging, EntryPoint = "retro_log_with_source_info")]
-    private static unsafe partial void NativeLog(
-        LogLevel level,
-        ReadOnlySpan<char> message,
-        int length,
+    [LibraryImport(NativeLibraries.RetroLogging, EntryPoint = "retro_log_register_call_site")]
+    private static partial IntPtr NativeRegisterCallSite(
         ReadOnlySpan<char> methodName,
         int methodNameLength,
         ReadOnlySpan<char> sourceFile,
         int sourceFileLength,
         int sourceLine
     );
+
+    [LibraryImport(NativeLibraries.RetroLogging, EntryPoint = "retro_log_at_call_site")]
+    private static partial void NativeLogAtCallSite(
+        LogLevel level,
+        IntPtr callSite,
+        ReadOnlySpan<char> message,
+        int length
+    );
 }
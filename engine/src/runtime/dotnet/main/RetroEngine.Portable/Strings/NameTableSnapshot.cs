@@ -0,0 +1,56 @@
+// @file NameTableSnapshot.cs
+//
+// @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+
+using System.Runtime.InteropServices;
+using RetroEngine.Interop;
+
+namespace RetroEngine.Portable.Strings;
+
+/// <summary>
+/// Saves and restores the native name table, so that the ids of cooked <see cref="Name"/> values stay the same
+/// between runs.
+/// </summary>
+public static partial class NameTableSnapshot
+{
+    /// <summary>
+    /// Writes every name currently in the table to the given file.
+    /// </summary>
+    /// <param name="path">The file to write.</param>
+    public static void Save(string path)
+    {
+        NativeSave(path.AsSpan(), path.Length, out var error);
+        error.ThrowIfError();
+    }
+
+    /// <summary>
+    /// Maps a snapshot into the name table, giving every name in it the id it was saved with.
+    /// </summary>
+    /// <remarks>
+    /// The names already in the table have to match the start of the snapshot, so this should be called at startup
+    /// before any assets are loaded.
+    /// </remarks>
+    /// <param name="path">The snapshot to load.</param>
+    /// <returns>The number of names that were added to the table.</returns>
+    public static int Load(string path)
+    {
+        var loaded = NativeLoad(path.AsSpan(), path.Length, out var error);
+        error.ThrowIfError();
+        return loaded;
+    }
+
+    [LibraryImport(NativeLibraries.RetroCore, EntryPoint = "retro_name_table_save_snapshot")]
+    private static partial void NativeSave(
+        ReadOnlySpan<char> path,
+        int pathLength,
+        out InteropError error
+    );
+
+    [LibraryImport(NativeLibraries.RetroCore, EntryPoint = "retro_name_table_load_snapshot")]
+    private static partial int NativeLoad(
+        ReadOnlySpan<char> path,
+        int pathLength,
+        out InteropError error
+    );
+}
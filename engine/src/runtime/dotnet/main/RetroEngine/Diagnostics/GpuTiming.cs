@@ -0,0 +1,20 @@
+// @file GpuTiming.cs
+//
+// @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+
+namespace RetroEngine.Diagnostics;
+
+/// <summary>
+/// GPU time spent on one render pipeline, or on the whole render pass for the entry named RenderPass.
+/// </summary>
+/// <param name="Name">The pipeline the timing is for.</param>
+/// <param name="LastMilliseconds">The most recently resolved frame.</param>
+/// <param name="AverageMilliseconds">An exponential moving average over recent frames.</param>
+/// <param name="Samples">How many frames have been folded into the average.</param>
+public readonly record struct GpuTiming(
+    string Name,
+    double LastMilliseconds,
+    double AverageMilliseconds,
+    ulong Samples
+);
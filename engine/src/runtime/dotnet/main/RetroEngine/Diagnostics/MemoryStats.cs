@@ -0,0 +1,64 @@
+// @file MemoryStats.cs
+//
+// @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+
+using System.Runtime.InteropServices;
+using RetroEngine.Interop;
+
+namespace RetroEngine.Diagnostics;
+
+/// <summary>
+/// Reads the native memory accounting. Every tagged allocation in the engine is counted against its subsystem, and
+/// the live byte counts are also recorded as counters once per frame while a <see cref="Profiler"/> capture runs.
+/// </summary>
+public static partial class MemoryStats
+{
+    public static MemoryUsage GetUsage(MemoryTag tag)
+    {
+        NativeGetTagStats(tag, out var stats);
+        return new MemoryUsage(
+            tag,
+            Marshal.PtrToStringUTF8(NativeGetTagName(tag)) ?? string.Empty,
+            stats.LiveBytes,
+            stats.PeakBytes,
+            stats.LiveAllocations,
+            stats.TotalAllocations
+        );
+    }
+
+    public static IReadOnlyList<MemoryUsage> GetAllUsage()
+    {
+        var tags = Enum.GetValues<MemoryTag>();
+        var usage = new MemoryUsage[tags.Length];
+        for (var i = 0; i < tags.Length; i++)
+        {
+            usage[i] = GetUsage(tags[i]);
+        }
+
+        return usage;
+    }
+
+    /// <summary>
+    /// Restarts every tag's peak from its current live byte count, for measuring the peak of a single section.
+    /// </summary>
+    public static void ResetPeaks() => NativeResetPeaks();
+
+    [LibraryImport(NativeLibraries.RetroCore, EntryPoint = "retro_memory_get_tag_name")]
+    private static partial IntPtr NativeGetTagName(MemoryTag tag);
+
+    [LibraryImport(NativeLibraries.RetroCore, EntryPoint = "retro_memory_get_tag_stats")]
+    private static partial void NativeGetTagStats(MemoryTag tag, out NativeMemoryTagStats stats);
+
+    [LibraryImport(NativeLibraries.RetroCore, EntryPoint = "retro_memory_reset_peaks")]
+    private static partial void NativeResetPeaks();
+
+    [StructLayout(LayoutKind.Sequential)]
+    private struct NativeMemoryTagStats
+    {
+        public nuint LiveBytes;
+        public nuint PeakBytes;
+        public nuint LiveAllocations;
+        public ulong TotalAllocations;
+    }
+}
@@ -0,0 +1,21 @@
+// @file MemoryTag.cs
+//
+// @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+
+namespace RetroEngine.Diagnostics;
+
+/// <summary>
+/// The engine subsystem native memory is accounted to. Mirrors the native enum value for value.
+/// </summary>
+public enum MemoryTag : byte
+{
+    Untagged,
+    Names,
+    EcsPools,
+    SceneNodes,
+    FontAtlases,
+    Textures,
+    GpuBuffers,
+    FrameArenas,
+}
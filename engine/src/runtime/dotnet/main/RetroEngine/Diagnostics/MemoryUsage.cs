@@ -0,0 +1,26 @@
+// @file MemoryUsage.cs
+//
+// @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+
+namespace RetroEngine.Diagnostics;
+
+/// <summary>
+/// Native memory currently accounted to one subsystem.
+/// </summary>
+/// <param name="Tag">The subsystem the memory belongs to.</param>
+/// <param name="Name">The display name of the tag, as it appears in profiler captures.</param>
+/// <param name="LiveBytes">Bytes allocated right now.</param>
+/// <param name="PeakBytes">
+/// The most bytes allocated at once since startup or the last <see cref="MemoryStats.ResetPeaks"/>.
+/// </param>
+/// <param name="LiveAllocations">How many allocations are alive right now.</param>
+/// <param name="TotalAllocations">How many allocations have been made since startup.</param>
+public readonly record struct MemoryUsage(
+    MemoryTag Tag,
+    string Name,
+    ulong LiveBytes,
+    ulong PeakBytes,
+    ulong LiveAllocations,
+    ulong TotalAllocations
+);
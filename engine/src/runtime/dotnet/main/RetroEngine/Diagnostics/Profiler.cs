@@ -0,0 +1,110 @@
+// @file Profiler.cs
+//
+// @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+
+using System.Runtime.InteropServices;
+using RetroEngine.Interop;
+
+namespace RetroEngine.Diagnostics;
+
+/// <summary>
+/// Controls the native profiler. A capture records the instrumented engine zones on every thread along with a marker
+/// per frame, and is written out as a Chrome trace that chrome://tracing or Perfetto can open.
+/// </summary>
+public static partial class Profiler
+{
+    public static bool IsCapturing => NativeIsCapturing();
+
+    public static void BeginCapture() => NativeBeginCapture();
+
+    /// <summary>
+    /// Stops the running capture and writes it to the given file.
+    /// </summary>
+    /// <param name="path">Where to write the trace, usually with a .json extension.</param>
+    public static void EndCapture(string path)
+    {
+        NativeEndCapture(path.AsSpan(), path.Length, out var error);
+        error.ThrowIfError();
+    }
+
+    /// <summary>
+    /// Whether the renderer times each render pipeline on the GPU. Results show up in <see cref="GetGpuTimings"/>
+    /// a couple of frames after the work they measure.
+    /// </summary>
+    public static bool GpuTimingEnabled
+    {
+        get => NativeIsGpuTimingEnabled();
+        set => NativeSetGpuTimingEnabled(value);
+    }
+
+    public static IReadOnlyList<GpuTiming> GetGpuTimings()
+    {
+        Span<NativeGpuTiming> buffer = stackalloc NativeGpuTiming[16];
+        var count = NativeGetGpuTimings(buffer, buffer.Length, out var error);
+        error.ThrowIfError();
+        if (count > buffer.Length)
+        {
+            buffer = new NativeGpuTiming[count];
+            count = NativeGetGpuTimings(buffer, buffer.Length, out error);
+            error.ThrowIfError();
+        }
+
+        var timings = new GpuTiming[Math.Min(count, buffer.Length)];
+        for (var i = 0; i < timings.Length; i++)
+        {
+            ref readonly var native = ref buffer[i];
+            timings[i] = new GpuTiming(
+                Marshal.PtrToStringUTF8(native.Name) ?? string.Empty,
+                native.LastMilliseconds,
+                native.AverageMilliseconds,
+                native.Samples
+            );
+        }
+
+        return timings;
+    }
+
+    public static void ResetGpuTimings()
+    {
+        NativeResetGpuTimings(out var error);
+        error.ThrowIfError();
+    }
+
+    internal static void MarkFrame(ulong frame) => NativeMarkFrame(frame);
+
+    [LibraryImport(NativeLibraries.RetroCore, EntryPoint = "retro_profiling_is_capturing")]
+    [return: MarshalAs(UnmanagedType.I1)]
+    private static partial bool NativeIsCapturing();
+
+    [LibraryImport(NativeLibraries.RetroCore, EntryPoint = "retro_profiling_begin_capture")]
+    private static partial void NativeBeginCapture();
+
+    [LibraryImport(NativeLibraries.RetroCore, EntryPoint = "retro_profiling_end_capture")]
+    private static partial void NativeEndCapture(ReadOnlySpan<char> path, int pathLength, out InteropError error);
+
+    [LibraryImport(NativeLibraries.RetroCore, EntryPoint = "retro_profiling_mark_frame")]
+    private static partial void NativeMarkFrame(ulong frame);
+
+    [LibraryImport(NativeLibraries.RetroCore, EntryPoint = "retro_profiling_is_gpu_timing_enabled")]
+    [return: MarshalAs(UnmanagedType.I1)]
+    private static partial bool NativeIsGpuTimingEnabled();
+
+    [LibraryImport(NativeLibraries.RetroCore, EntryPoint = "retro_profiling_set_gpu_timing_enabled")]
+    private static partial void NativeSetGpuTimingEnabled([MarshalAs(UnmanagedType.I1)] bool enabled);
+
+    [LibraryImport(NativeLibraries.RetroCore, EntryPoint = "retro_profiling_get_gpu_timings")]
+    private static partial int NativeGetGpuTimings(Span<NativeGpuTiming> timings, int capacity, out InteropError error);
+
+    [LibraryImport(NativeLibraries.RetroCore, EntryPoint = "retro_profiling_reset_gpu_timings")]
+    private static partial void NativeResetGpuTimings(out InteropError error);
+
+    [StructLayout(LayoutKind.Sequential)]
+    private struct NativeGpuTiming
+    {
+        public IntPtr Name;
+        public double LastMilliseconds;
+        public double AverageMilliseconds;
+        public ulong Samples;
+    }
+}
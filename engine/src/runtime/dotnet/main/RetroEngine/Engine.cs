@@ -17,6 +17,7 @@ using RetroEngine.Portable.Localization;
 using RetroEngine.Portable.Localization.Cultures;
 using RetroEngine.Rendering;
 using RetroEngine.Tickables;
+using RetroEngine.World;
 using Serilog;
 
 namespace RetroEngine;
@@ -112,6 +113,7 @@ public sealed partial class Engine : IAsyncDisposable
     {
         var tickManager = _host.Services.GetRequiredService<TickManager>();
         var renderManager = _host.Services.GetRequiredService<RenderManager>();
+        var sceneManager = _host.Services.GetRequiredService<SceneManager>();
         try
         {
             using var threadSyncScope = tickManager.BindSynchronizationContext();
@@ -128,6 +130,7 @@ public sealed partial class Engine : IAsyncDisposable
                     stopWatch.Restart();
 
                     tickManager.Tick(deltaTime);
+                    sceneManager.FlushCommands();
                     renderManager.SyncRenderState();
                 }
                 catch (Exception ex)
@@ -149,6 +152,45 @@ public sealed partial class Engine : IAsyncDisposable
         NativePollPlatformEvents(_nativeEngine);
     }
 
+    /// <summary>
+    /// Starts writing every platform event the engine handles to a binary log that can be replayed later.
+    /// </summary>
+    /// <param name="path">The file to write.</param>
+    public void StartInputRecording(string path)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        NativeStartInputRecording(_nativeEngine, path.AsSpan(), path.Length, out var error);
+        error.ThrowIfError();
+    }
+
+    public void StopInputRecording()
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        NativeStopInputRecording(_nativeEngine);
+    }
+
+    /// <summary>
+    /// Feeds a recording made with <see cref="StartInputRecording"/> back through the platform backend, applying
+    /// each event on the same frame it was recorded on.
+    /// </summary>
+    /// <param name="path">The recording to replay.</param>
+    /// <param name="pace">Whether to replay as fast as frames come or at the speed it was recorded.</param>
+    public void StartInputReplay(string path, ReplayPace pace = ReplayPace.FullSpeed)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        NativeStartInputReplay(_nativeEngine, path.AsSpan(), path.Length, pace, out var error);
+        error.ThrowIfError();
+    }
+
+    public bool IsReplayingInput
+    {
+        get
+        {
+            ObjectDisposedException.ThrowIf(_disposed, this);
+            return NativeIsReplayingInput(_nativeEngine);
+        }
+    }
+
     public void RequestShutdown()
     {
         ObjectDisposedException.ThrowIf(_disposed, this);
@@ -219,6 +261,30 @@ public sealed partial class Engine : IAsyncDisposable
     [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_engine_poll_platform_events")]
     private static partial void NativePollPlatformEvents(IntPtr engine);
 
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_engine_start_input_recording")]
+    private static partial void NativeStartInputRecording(
+        IntPtr engine,
+        ReadOnlySpan<char> path,
+        int pathLength,
+        out InteropError error
+    );
+
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_engine_stop_input_recording")]
+    private static partial void NativeStopInputRecording(IntPtr engine);
+
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_engine_start_input_replay")]
+    private static partial void NativeStartInputReplay(
+        IntPtr engine,
+        ReadOnlySpan<char> path,
+        int pathLength,
+        ReplayPace pace,
+        out InteropError error
+    );
+
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_engine_is_replaying_input")]
+    [return: MarshalAs(UnmanagedType.I1)]
+    private static partial bool NativeIsReplayingInput(IntPtr engine);
+
     [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_engine_on_shutdown_requested_add")]
     private static unsafe partial void NativeOnShutdownRequestedAdd(
         IntPtr engine,
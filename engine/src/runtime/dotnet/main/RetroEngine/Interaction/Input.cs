@@ -25,18 +25,30 @@ public static class Input
 
     public static bool IsAnyDown(params ReadOnlySpan<DigitalInput> inputs) => Manager.IsAnyDown(inputs);
 
+    public static bool IsAnyDown(InputBinding binding) => Manager.IsAnyDown(binding);
+
     public static bool AreAllDown(params ReadOnlySpan<DigitalInput> inputs) => Manager.AreAllDown(inputs);
 
+    public static bool AreAllDown(InputBinding binding) => Manager.AreAllDown(binding);
+
     public static bool AreNoneDown(params ReadOnlySpan<DigitalInput> inputs) => Manager.AreNoneDown(inputs);
 
+    public static bool AreNoneDown(InputBinding binding) => Manager.AreNoneDown(binding);
+
     public static bool WasPressed(DigitalInput input) => Manager.WasPressed(input);
 
     public static bool WasAnyPressed(params ReadOnlySpan<DigitalInput> inputs) => Manager.WasAnyPressed(inputs);
 
+    public static bool WasAnyPressed(InputBinding binding) => Manager.WasAnyPressed(binding);
+
     public static bool WereAllPressed(params ReadOnlySpan<DigitalInput> inputs) => Manager.WereAllPressed(inputs);
 
+    public static bool WereAllPressed(InputBinding binding) => Manager.WereAllPressed(binding);
+
     public static bool WereNonePressed(params ReadOnlySpan<DigitalInput> inputs) => Manager.WereNonePressed(inputs);
 
+    public static bool WereNonePressed(InputBinding binding) => Manager.WereNonePressed(binding);
+
     public static float GetAnalogueValue(AnalogueInput input) => Manager.GetAnalogueValue(input);
 
     public static float GetAnalogueValues(params ReadOnlySpan<AnalogueInput> inputs) =>
@@ -0,0 +1,44 @@
+// @file InputBinding.cs
+//
+// @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+
+using System.Runtime.InteropServices;
+using RetroEngine.Interop;
+
+namespace RetroEngine.Interaction;
+
+/// <summary>
+/// A set of inputs compiled once on the native side, so querying the whole set costs a few masked bit tests
+/// instead of checking every input on its own. Create one per action and keep it around.
+/// </summary>
+public sealed partial class InputBinding : IDisposable
+{
+    internal IntPtr NativeHandle { get; private set; }
+
+    public InputBinding(params ReadOnlySpan<DigitalInput> inputs)
+    {
+        NativeHandle = NativeCreate(inputs, inputs.Length);
+    }
+
+    internal IntPtr GetHandle()
+    {
+        ObjectDisposedException.ThrowIf(NativeHandle == IntPtr.Zero, this);
+        return NativeHandle;
+    }
+
+    public void Dispose()
+    {
+        if (NativeHandle == IntPtr.Zero)
+            return;
+
+        NativeDestroy(NativeHandle);
+        NativeHandle = IntPtr.Zero;
+    }
+
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_input_binding_create")]
+    private static partial IntPtr NativeCreate(ReadOnlySpan<DigitalInput> inputs, int length);
+
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_input_binding_destroy")]
+    private static partial void NativeDestroy(IntPtr handle);
+}
@@ -88,6 +88,42 @@ public sealed partial class InputManager : IDisposable
         return NativeWereNonePressed(NativeHandle, buttons, buttons.Length);
     }
 
+    public bool IsAnyDown(InputBinding binding)
+    {
+        ThrowIfDisposed();
+        return NativeIsAnyDownBinding(NativeHandle, binding.GetHandle());
+    }
+
+    public bool AreAllDown(InputBinding binding)
+    {
+        ThrowIfDisposed();
+        return NativeAreAllDownBinding(NativeHandle, binding.GetHandle());
+    }
+
+    public bool AreNoneDown(InputBinding binding)
+    {
+        ThrowIfDisposed();
+        return NativeAreNoneDownBinding(NativeHandle, binding.GetHandle());
+    }
+
+    public bool WasAnyPressed(InputBinding binding)
+    {
+        ThrowIfDisposed();
+        return NativeWasAnyPressedBinding(NativeHandle, binding.GetHandle());
+    }
+
+    public bool WereAllPressed(InputBinding binding)
+    {
+        ThrowIfDisposed();
+        return NativeWereAllPressedBinding(NativeHandle, binding.GetHandle());
+    }
+
+    public bool WereNonePressed(InputBinding binding)
+    {
+        ThrowIfDisposed();
+        return NativeWereNonePressedBinding(NativeHandle, binding.GetHandle());
+    }
+
     public float GetAnalogueValue(AnalogueInput input)
     {
         ThrowIfDisposed();
@@ -155,6 +191,30 @@ public sealed partial class InputManager : IDisposable
     [return: MarshalAs(UnmanagedType.I1)]
     private static partial bool NativeWereNonePressed(IntPtr handle, ReadOnlySpan<DigitalInput> keys, int length);
 
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_input_manager_is_any_down_binding")]
+    [return: MarshalAs(UnmanagedType.I1)]
+    private static partial bool NativeIsAnyDownBinding(IntPtr handle, IntPtr binding);
+
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_input_manager_are_all_down_binding")]
+    [return: MarshalAs(UnmanagedType.I1)]
+    private static partial bool NativeAreAllDownBinding(IntPtr handle, IntPtr binding);
+
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_input_manager_are_none_down_binding")]
+    [return: MarshalAs(UnmanagedType.I1)]
+    private static partial bool NativeAreNoneDownBinding(IntPtr handle, IntPtr binding);
+
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_input_manager_was_any_pressed_binding")]
+    [return: MarshalAs(UnmanagedType.I1)]
+    private static partial bool NativeWasAnyPressedBinding(IntPtr handle, IntPtr binding);
+
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_input_manager_were_all_pressed_binding")]
+    [return: MarshalAs(UnmanagedType.I1)]
+    private static partial bool NativeWereAllPressedBinding(IntPtr handle, IntPtr binding);
+
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_input_manager_were_none_pressed_binding")]
+    [return: MarshalAs(UnmanagedType.I1)]
+    private static partial bool NativeWereNonePressedBinding(IntPtr handle, IntPtr binding);
+
     [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_input_manager_get_mouse_position")]
     private static partial void NativeGetMousePosition(
         IntPtr handle,
@@ -0,0 +1,22 @@
+// @file ReplayPace.cs
+//
+// @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+
+namespace RetroEngine.Interaction;
+
+/// <summary>
+/// How quickly a recorded input session is fed back into the engine.
+/// </summary>
+public enum ReplayPace : byte
+{
+    /// <summary>
+    /// Events are released as soon as their frame comes up.
+    /// </summary>
+    FullSpeed,
+
+    /// <summary>
+    /// Events also wait until as much time has passed as had passed when they were recorded.
+    /// </summary>
+    RealTime,
+}
@@ -0,0 +1,21 @@
+// @file NativeFrameAllocator.cs
+//
+// @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+
+using System.Runtime.InteropServices;
+using RetroEngine.Interop;
+
+namespace RetroEngine.Memory;
+
+/// <summary>
+/// Drives the native per-thread frame allocator. Every thread that runs a frame loop has to begin each frame on it,
+/// otherwise native scratch allocations on that thread fall back to the heap.
+/// </summary>
+internal static partial class NativeFrameAllocator
+{
+    public static void BeginFrame() => NativeBeginFrame();
+
+    [LibraryImport(NativeLibraries.RetroCore, EntryPoint = "retro_frame_allocator_begin_frame")]
+    private static partial void NativeBeginFrame();
+}
@@ -9,6 +9,7 @@ using Microsoft.Extensions.Logging;
 using Microsoft.Extensions.Options;
 using RetroEngine.Config;
 using RetroEngine.Interop;
+using RetroEngine.Memory;
 using RetroEngine.Platform;
 using RetroEngine.World;
 using Serilog;
@@ -282,6 +283,7 @@ public sealed partial class RenderManager : IDisposable
         {
             try
             {
+                NativeFrameAllocator.BeginFrame();
                 Render();
             }
             catch (Exception ex)
@@ -5,8 +5,10 @@
 
 using System.Runtime.CompilerServices;
 using RetroEngine.Async;
+using RetroEngine.Diagnostics;
 using RetroEngine.Events;
 using RetroEngine.Interaction;
+using RetroEngine.Memory;
 using RetroEngine.Utilities.Async;
 using Serilog;
 using ZLinq;
@@ -71,6 +73,8 @@ public sealed class TickManager : IDisposable
 
     internal void Tick(float deltaTime)
     {
+        NativeFrameAllocator.BeginFrame();
+        Profiler.MarkFrame(FrameCount);
         _inputManager.PollEvents(FrameCount);
         Tick(TickGroup.Input, deltaTime);
         _eventManager.PollEvents();
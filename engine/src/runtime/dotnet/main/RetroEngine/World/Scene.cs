@@ -21,6 +21,11 @@ public sealed partial class Scene : IDisposable
 
     public IReadOnlyList<SceneObject> Objects => _objects;
 
+    internal SceneTransformTable Transforms { get; }
+
+    internal SceneCommandBuffer Commands =>
+        Manager?.Commands ?? throw new InvalidOperationException("SceneManager is not initialized.");
+
     public Scene()
     {
         if (Manager is null)
@@ -28,6 +33,7 @@ public sealed partial class Scene : IDisposable
 
         NativeHandle = NativeCreate(Manager, out var error);
         error.ThrowIfError();
+        Transforms = new SceneTransformTable(this);
         Manager.AddScene(this);
     }
 
@@ -59,6 +65,7 @@ public sealed partial class Scene : IDisposable
         DisposeManagedResources();
         if (Manager is not null)
         {
+            Manager.Commands.Flush();
             NativeDestroy(Manager, this);
             Manager.RemoveScene(this);
         }
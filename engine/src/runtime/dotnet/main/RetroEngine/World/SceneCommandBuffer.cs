@@ -0,0 +1,183 @@
+// @file SceneCommandBuffer.cs
+//
+// @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+
+using System.Runtime.InteropServices;
+using RetroEngine.Core.Drawing;
+using RetroEngine.Core.Math;
+using RetroEngine.Interop;
+
+namespace RetroEngine.World;
+
+internal enum SceneCommandType : uint
+{
+    SetTransform,
+    SetZOrder,
+    AttachToParent,
+    DetachFromParent,
+    SetSpriteTint,
+    SetSpritePivot,
+    SetSpriteSize,
+    SetSpriteUVRect,
+    SetSpriteDrawMode,
+    SetSpriteMargin,
+    SetGeometryColor,
+    SetGeometryPivot,
+    SetGeometrySize,
+    SetTextBlockTint,
+    SetTextBlockPivot,
+}
+
+/// <summary>
+/// Mirrors the native <c>SceneCommand</c> record, every payload shares the same offset.
+/// </summary>
+[StructLayout(LayoutKind.Explicit, Size = 40)]
+internal struct SceneCommand
+{
+    [FieldOffset(0)]
+    public IntPtr Node;
+
+    [FieldOffset(8)]
+    public SceneCommandType Type;
+
+    [FieldOffset(16)]
+    public Transform Transform;
+
+    [FieldOffset(16)]
+    public Color Color;
+
+    [FieldOffset(16)]
+    public Vector2F Vector;
+
+    [FieldOffset(16)]
+    public UVs UVs;
+
+    [FieldOffset(16)]
+    public SpriteDrawMode DrawMode;
+
+    [FieldOffset(16)]
+    public Margin Margin;
+}
+
+/// <summary>
+/// Collects node property changes in native memory and applies them in a single native call, instead of crossing
+/// the interop boundary once per property. When the buffer fills up it is flushed and starts over from the front.
+/// </summary>
+public sealed unsafe partial class SceneCommandBuffer : IDisposable
+{
+    public const int DefaultCapacity = 4096;
+
+    private SceneCommand* _commands;
+    private readonly int _capacity;
+
+    public int Count { get; private set; }
+
+    public SceneCommandBuffer(int capacity = DefaultCapacity)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(capacity);
+        _capacity = capacity;
+        _commands = (SceneCommand*)
+            NativeMemory.AlignedAlloc((nuint)(capacity * sizeof(SceneCommand)), (nuint)sizeof(IntPtr));
+    }
+
+    ~SceneCommandBuffer()
+    {
+        Dispose();
+    }
+
+    public void SetTransform(SceneObject node, Transform transform)
+    {
+        Push(node, SceneCommandType.SetTransform).Transform = transform;
+    }
+
+    public void SetTint(Sprite sprite, Color tint)
+    {
+        Push(sprite, SceneCommandType.SetSpriteTint).Color = tint;
+    }
+
+    public void SetPivot(Sprite sprite, Vector2F pivot)
+    {
+        Push(sprite, SceneCommandType.SetSpritePivot).Vector = pivot;
+    }
+
+    public void SetSize(Sprite sprite, Vector2F size)
+    {
+        Push(sprite, SceneCommandType.SetSpriteSize).Vector = size;
+    }
+
+    public void SetUVs(Sprite sprite, UVs uvs)
+    {
+        Push(sprite, SceneCommandType.SetSpriteUVRect).UVs = uvs;
+    }
+
+    public void SetDrawMode(Sprite sprite, SpriteDrawMode drawMode)
+    {
+        Push(sprite, SceneCommandType.SetSpriteDrawMode).DrawMode = drawMode;
+    }
+
+    public void SetMargin(Sprite sprite, Margin margin)
+    {
+        Push(sprite, SceneCommandType.SetSpriteMargin).Margin = margin;
+    }
+
+    public void SetTint(TextBlock textBlock, Color tint)
+    {
+        Push(textBlock, SceneCommandType.SetTextBlockTint).Color = tint;
+    }
+
+    public void SetPivot(TextBlock textBlock, Vector2F pivot)
+    {
+        Push(textBlock, SceneCommandType.SetTextBlockPivot).Vector = pivot;
+    }
+
+    /// <summary>
+    /// Applies every pending command on the native side.
+    /// </summary>
+    public void Flush()
+    {
+        ObjectDisposedException.ThrowIf(_commands is null, this);
+        if (Count == 0)
+            return;
+
+        NativeApplyCommands(_commands, Count);
+        Count = 0;
+    }
+
+    /// <summary>
+    /// Drops every pending command without applying it.
+    /// </summary>
+    public void Clear()
+    {
+        Count = 0;
+    }
+
+    private ref SceneCommand Push(SceneObject node, SceneCommandType type)
+    {
+        ObjectDisposedException.ThrowIf(_commands is null, this);
+        if (Count == _capacity)
+        {
+            Flush();
+        }
+
+        ref var command = ref _commands[Count++];
+        command = default;
+        command.Node = node.NativeObject;
+        command.Type = type;
+        return ref command;
+    }
+
+    public void Dispose()
+    {
+        if (_commands is null)
+            return;
+
+        NativeMemory.AlignedFree(_commands);
+        _commands = null;
+        Count = 0;
+        GC.SuppressFinalize(this);
+    }
+
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_scene_apply_commands")]
+    private static partial void NativeApplyCommands(SceneCommand* commands, int count);
+}
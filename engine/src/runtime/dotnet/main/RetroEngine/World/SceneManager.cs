@@ -16,6 +16,12 @@ public sealed partial class SceneManager : IDisposable
     internal IntPtr NativeHandle { get; private set; } = NativeCreate();
     private readonly List<Scene> _scenes = [];
 
+    /// <summary>
+    /// Node property changes made through the managed scene objects, applied in one call by
+    /// <see cref="FlushCommands"/>.
+    /// </summary>
+    public SceneCommandBuffer Commands { get; } = new();
+
     public bool Disposed => NativeHandle == IntPtr.Zero;
 
     public IReadOnlyList<Scene> Scenes
@@ -42,6 +48,17 @@ public sealed partial class SceneManager : IDisposable
         _scenes.Remove(scene);
     }
 
+    /// <summary>
+    /// Applies every pending node change to the native scenes, including the transforms written into the scenes'
+    /// transform tables. The engine does this once per frame right before the render state is synchronized.
+    /// </summary>
+    public void FlushCommands()
+    {
+        ThrowIfDisposed();
+        Commands.Flush();
+        NativeApplyTransforms(this);
+    }
+
     internal void ThrowIfDisposed()
     {
         ObjectDisposedException.ThrowIf(Disposed, this);
@@ -56,8 +73,10 @@ public sealed partial class SceneManager : IDisposable
         {
             scene.DisposeManagedResources();
         }
+        Commands.Clear();
         NativeDestroy(this);
         NativeHandle = IntPtr.Zero;
+        Commands.Dispose();
         GC.SuppressFinalize(this);
     }
 
@@ -66,6 +85,9 @@ public sealed partial class SceneManager : IDisposable
 
     [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_scene_manager_destroy")]
     private static partial void NativeDestroy(SceneManager ptr);
+
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_scene_manager_apply_transforms")]
+    private static partial int NativeApplyTransforms(SceneManager ptr);
 }
 
 [CustomMarshaller(typeof(SceneManager), MarshalMode.ManagedToUnmanagedIn, typeof(SceneManagerMarshaller))]
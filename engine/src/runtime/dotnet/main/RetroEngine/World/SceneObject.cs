@@ -20,6 +20,8 @@ public abstract partial class SceneObject : IDisposable
 
     public IntPtr NativeObject { get; }
 
+    private readonly uint _transformSlot;
+
     public bool Disposed
     {
         get => field || Scene.Disposed;
@@ -65,7 +67,7 @@ public abstract partial class SceneObject : IDisposable
                 return;
 
             field = value;
-            NativeSetTransform(this, value);
+            Scene.Transforms.Write(_transformSlot, value);
         }
     }
 
@@ -100,17 +102,58 @@ public abstract partial class SceneObject : IDisposable
         }
     }
 
+    /// <summary>
+    /// A native node that already exists, together with the transform table slot it was given.
+    /// </summary>
+    protected readonly record struct NativeNode(IntPtr Handle, uint TransformSlot);
+
     protected SceneObject(Scene scene, SceneObject? parent, Func<Scene, IntPtr> nativePtrFactory)
+        : this(scene, parent, CreateNativeNode(scene, parent, nativePtrFactory)) { }
+
+    protected SceneObject(Scene scene, SceneObject? parent, NativeNode node)
     {
-        parent?.ThrowIfDisposed();
-        scene.ThrowIfDisposed();
         Scene = scene;
-        NativeObject = nativePtrFactory(scene);
+        NativeObject = node.Handle;
+        _transformSlot = node.TransformSlot;
         Scene.AddObject(this);
         Parent = parent;
         Scale = Vector2F.One;
     }
 
+    private static NativeNode CreateNativeNode(Scene scene, SceneObject? parent, Func<Scene, IntPtr> nativePtrFactory)
+    {
+        parent?.ThrowIfDisposed();
+        scene.ThrowIfDisposed();
+        var handle = nativePtrFactory(scene);
+        return new NativeNode(handle, scene.Transforms.Allocate(handle));
+    }
+
+    /// <summary>
+    /// Creates the native side of many nodes with one call for the nodes and one for their transform slots, for
+    /// subclasses that offer bulk creation.
+    /// </summary>
+    protected static NativeNode[] CreateNativeNodes(
+        Scene scene,
+        int count,
+        Action<Scene, int, IntPtr[]> nativeCreateMany
+    )
+    {
+        scene.ThrowIfDisposed();
+        ArgumentOutOfRangeException.ThrowIfNegative(count);
+
+        var handles = new IntPtr[count];
+        nativeCreateMany(scene, count, handles);
+        var slots = scene.Transforms.AllocateMany(handles);
+
+        var nodes = new NativeNode[count];
+        for (var i = 0; i < count; i++)
+        {
+            nodes[i] = new NativeNode(handles[i], slots[i]);
+        }
+
+        return nodes;
+    }
+
     private void AddChild(SceneObject child)
     {
         _children.Add(child);
@@ -139,15 +182,53 @@ public abstract partial class SceneObject : IDisposable
             return;
 
         Parent?.RemoveChild(this);
+
+        // Pending commands may still point at this node
+        Scene.Commands.Flush();
         NativeDispose(Scene, this);
         Disposed = true;
         GC.SuppressFinalize(this);
     }
 
-    protected internal virtual void DisposeManagedResources() { }
+    /// <summary>
+    /// Disposes a batch of objects from one scene with a single native call, which compacts the scene's storage once
+    /// rather than once per object. Objects that are already disposed are skipped.
+    /// </summary>
+    public static void DisposeMany(ReadOnlySpan<SceneObject> objects)
+    {
+        if (objects.IsEmpty)
+            return;
+
+        var scene = objects[0].Scene;
+        var handles = new List<IntPtr>(objects.Length);
+        foreach (var obj in objects)
+        {
+            if (!ReferenceEquals(obj.Scene, scene))
+                throw new ArgumentException("All objects must be in the same scene", nameof(objects));
 
-    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_node_set_transform")]
-    private static partial void NativeSetTransform(SceneObject obj, in Transform transform);
+            if (!obj.Disposed)
+                handles.Add(obj.NativeObject);
+        }
+
+        if (handles.Count == 0)
+            return;
+
+        foreach (var obj in objects)
+        {
+            if (obj.Disposed)
+                continue;
+
+            obj.Parent?.RemoveChild(obj);
+            obj.Disposed = true;
+            GC.SuppressFinalize(obj);
+        }
+
+        // Pending commands may still point at these nodes
+        scene.Commands.Flush();
+        NativeDisposeMany(scene, CollectionsMarshal.AsSpan(handles), handles.Count);
+    }
+
+    protected internal virtual void DisposeManagedResources() { }
 
     [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_node_set_z_order")]
     private static partial int NativeSetZOrder(SceneObject obj, int zOrder);
@@ -160,6 +241,9 @@ public abstract partial class SceneObject : IDisposable
 
     [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_node_dispose")]
     private static partial void NativeDispose(Scene scene, SceneObject obj);
+
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_nodes_dispose_many")]
+    private static partial void NativeDisposeMany(Scene scene, ReadOnlySpan<IntPtr> nodes, int count);
 }
 
 [CustomMarshaller(typeof(SceneObject), MarshalMode.ManagedToUnmanagedIn, typeof(SceneObjectMarshaller))]
@@ -0,0 +1,85 @@
+// @file SceneTransformTable.cs
+//
+// @copyright Copyright (c) 2026 Retro & Chill. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+
+using System.Runtime.InteropServices;
+using RetroEngine.Core.Math;
+using RetroEngine.Interop;
+
+namespace RetroEngine.World;
+
+[StructLayout(LayoutKind.Sequential)]
+internal unsafe struct TransformChunkView
+{
+    public float* PositionX;
+    public float* PositionY;
+    public float* Rotation;
+    public float* ScaleX;
+    public float* ScaleY;
+    public ulong* Dirty;
+}
+
+/// <summary>
+/// Managed view of a scene's native transform table. The columns never move on the native side, so transforms are
+/// written straight into them and picked up by <see cref="SceneManager.FlushCommands"/> without any interop call.
+/// </summary>
+internal sealed unsafe partial class SceneTransformTable(Scene scene)
+{
+    private const int ChunkSize = 1024;
+
+    private readonly List<TransformChunkView> _chunks = [];
+
+    public uint Allocate(IntPtr node)
+    {
+        var slot = NativeAllocate(scene, node, out var error);
+        error.ThrowIfError();
+        return slot;
+    }
+
+    public uint[] AllocateMany(ReadOnlySpan<IntPtr> nodes)
+    {
+        var slots = new uint[nodes.Length];
+        NativeAllocateMany(scene, nodes, nodes.Length, slots, out var error);
+        error.ThrowIfError();
+        return slots;
+    }
+
+    public void Write(uint slot, Transform transform)
+    {
+        var chunk = GetChunk((int)(slot / ChunkSize));
+        var index = (int)(slot % ChunkSize);
+        chunk.PositionX[index] = transform.Position.X;
+        chunk.PositionY[index] = transform.Position.Y;
+        chunk.Rotation[index] = transform.Rotation;
+        chunk.ScaleX[index] = transform.Scale.X;
+        chunk.ScaleY[index] = transform.Scale.Y;
+        chunk.Dirty[index / 64] |= 1UL << (index % 64);
+    }
+
+    private TransformChunkView GetChunk(int index)
+    {
+        while (_chunks.Count <= index)
+        {
+            NativeGetChunk(scene, (uint)_chunks.Count, out var view);
+            _chunks.Add(view);
+        }
+
+        return _chunks[index];
+    }
+
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_scene_transform_allocate")]
+    private static partial uint NativeAllocate(Scene scene, IntPtr node, out InteropError error);
+
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_scene_transform_allocate_many")]
+    private static partial void NativeAllocateMany(
+        Scene scene,
+        ReadOnlySpan<IntPtr> nodes,
+        int count,
+        [Out] uint[] slots,
+        out InteropError error
+    );
+
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_scene_transform_get_chunk")]
+    private static partial void NativeGetChunk(Scene scene, uint index, out TransformChunkView view);
+}
@@ -54,7 +54,7 @@ public partial class Sprite : SceneObject
                 return;
 
             field = value;
-            NativeSetSize(this, value);
+            Scene.Commands.SetSize(this, value);
         }
     }
 
@@ -81,7 +81,7 @@ public partial class Sprite : SceneObject
                 return;
 
             field = value;
-            NativeSetTint(this, value);
+            Scene.Commands.SetTint(this, value);
         }
     }
 
@@ -95,7 +95,7 @@ public partial class Sprite : SceneObject
                 return;
 
             field = value;
-            NativeSetPivot(this, value);
+            Scene.Commands.SetPivot(this, value);
         }
     }
 
@@ -109,7 +109,7 @@ public partial class Sprite : SceneObject
                 return;
 
             field = value;
-            NativeSetUVs(this, value);
+            Scene.Commands.SetUVs(this, value);
         }
     }
 
@@ -123,7 +123,7 @@ public partial class Sprite : SceneObject
                 return;
 
             field = value;
-            NativeSetDrawMode(this, value);
+            Scene.Commands.SetDrawMode(this, value);
         }
     }
 
@@ -137,7 +137,7 @@ public partial class Sprite : SceneObject
                 return;
 
             field = value;
-            NativeSetMargin(this, value);
+            Scene.Commands.SetMargin(this, value);
         }
     }
 
@@ -145,6 +145,17 @@ public partial class Sprite : SceneObject
 
     private Sprite(Scene scene, SceneObject? parent, bool autoResize)
         : base(scene, parent, NativeCreate)
+    {
+        SetDefaults(autoResize);
+    }
+
+    private Sprite(Scene scene, NativeNode node, bool autoResize)
+        : base(scene, null, node)
+    {
+        SetDefaults(autoResize);
+    }
+
+    private void SetDefaults(bool autoResize)
     {
         AutoResize = autoResize;
         Size = new Vector2F(100, 100);
@@ -158,29 +169,31 @@ public partial class Sprite : SceneObject
     public Sprite(SceneObject parent, bool autoResize = true)
         : this(parent.Scene, parent, autoResize) { }
 
+    /// <summary>
+    /// Creates a batch of root-level sprites, e.g. for a particle burst, with one native call instead of one per
+    /// sprite.
+    /// </summary>
+    public static Sprite[] CreateMany(Scene scene, int count, bool autoResize = true)
+    {
+        var nodes = CreateNativeNodes(scene, count, NativeCreateMany);
+        var sprites = new Sprite[count];
+        for (var i = 0; i < count; i++)
+        {
+            sprites[i] = new Sprite(scene, nodes[i], autoResize);
+        }
+
+        return sprites;
+    }
+
     [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_sprite_create")]
     private static partial IntPtr NativeCreate(Scene scene);
 
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_sprite_create_many")]
+    private static partial void NativeCreateMany(Scene scene, int count, [Out] IntPtr[] handles);
+
     [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_sprite_set_texture")]
     private static partial void NativeSetTexture(Sprite id, Texture? texture);
 
-    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_sprite_set_tint")]
-    private static partial void NativeSetTint(Sprite id, Color color);
-
-    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_sprite_set_pivot")]
-    private static partial void NativeSetPivot(Sprite id, Vector2F pivot);
-
-    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_sprite_set_size")]
-    private static partial void NativeSetSize(Sprite id, Vector2F size);
-
-    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_sprite_set_uv_rect")]
-    private static partial void NativeSetUVs(Sprite id, UVs size);
-
-    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_sprite_set_draw_mode")]
-    private static partial void NativeSetDrawMode(Sprite id, SpriteDrawMode size);
-
-    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_sprite_set_margin")]
-    private static partial void NativeSetMargin(Sprite id, Margin margin);
 }
 
 [CustomMarshaller(typeof(Sprite), MarshalMode.ManagedToUnmanagedIn, typeof(SpriteMarshaller))]
@@ -69,7 +69,7 @@ public sealed partial class TextBlock : SceneObject
                 return;
 
             field = value;
-            NativeSetTint(this, field);
+            Scene.Commands.SetTint(this, field);
         }
     }
 
@@ -83,7 +83,7 @@ public sealed partial class TextBlock : SceneObject
                 return;
 
             field = value;
-            NativeSetPivot(this, field);
+            Scene.Commands.SetPivot(this, field);
         }
     }
 
@@ -95,14 +95,43 @@ public sealed partial class TextBlock : SceneObject
 
     private TextBlock(Scene scene, SceneObject? parent)
         : base(scene, parent, NativeCreate)
+    {
+        SetDefaults();
+    }
+
+    private TextBlock(Scene scene, NativeNode node)
+        : base(scene, null, node)
+    {
+        SetDefaults();
+    }
+
+    private void SetDefaults()
     {
         FontSize = 48;
         Tint = new Color(1, 1, 1);
     }
 
+    /// <summary>
+    /// Creates a batch of root-level text blocks with one native call instead of one per block.
+    /// </summary>
+    public static TextBlock[] CreateMany(Scene scene, int count)
+    {
+        var nodes = CreateNativeNodes(scene, count, NativeCreateMany);
+        var textBlocks = new TextBlock[count];
+        for (var i = 0; i < count; i++)
+        {
+            textBlocks[i] = new TextBlock(scene, nodes[i]);
+        }
+
+        return textBlocks;
+    }
+
     [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_text_block_create")]
     private static partial IntPtr NativeCreate(Scene scene);
 
+    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_text_block_create_many")]
+    private static partial void NativeCreateMany(Scene scene, int count, [Out] IntPtr[] handles);
+
     [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_text_block_set_text_utf16")]
     private static partial void NativeSetText(TextBlock id, ReadOnlySpan<char> text, int length);
 
@@ -111,12 +140,6 @@ public sealed partial class TextBlock : SceneObject
 
     [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_text_block_set_font_size")]
     private static partial void NativeSetFontSize(TextBlock id, uint fontSize);
-
-    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_text_block_set_tint")]
-    private static partial void NativeSetTint(TextBlock id, Color color);
-
-    [LibraryImport(NativeLibraries.RetroRuntime, EntryPoint = "retro_text_block_set_pivot")]
-    private static partial void NativeSetPivot(TextBlock id, Vector2F pivot);
 }
 
 [CustomMarshaller(typeof(TextBlock), MarshalMode.ManagedToUnmanagedIn, typeof(TextBlockMarshaller))]
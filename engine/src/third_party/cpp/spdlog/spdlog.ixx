@@ -141,6 +141,11 @@ export namespace spdlog
 
     using spdlog::custom_log_callback;
 
+    namespace details
+    {
+        using details::log_msg;
+    }
+
     namespace sinks
     {
         using sinks::base_sink;